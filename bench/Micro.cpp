@@ -0,0 +1,61 @@
+// ============================================
+// bench/Micro.cpp
+// ============================================
+#include "Micro.hpp"
+
+namespace Aurora {
+namespace Bench {
+
+// Defined next to the subsystems they measure (MicroAnimation.cpp,
+// MicroCore.cpp, ...)
+void animatorTweens(MicroResult& result);
+void springSystem(MicroResult& result);
+void easingTables(MicroResult& result);
+void keyframeTrack(MicroResult& result);
+void timelineEntries(MicroResult& result);
+void signalEmit(MicroResult& result);
+void timerWheel(MicroResult& result);
+void handleRefCount(MicroResult& result);
+
+namespace {
+
+struct Registration {
+    const char* name;
+    MicroBenchmark run;
+};
+
+const Registration s_micro[] = {
+    {"animator", animatorTweens},
+    {"springs", springSystem},
+    {"easing", easingTables},
+    {"keyframes", keyframeTrack},
+    {"timeline", timelineEntries},
+    {"signals", signalEmit},
+    {"timers", timerWheel},
+    {"handles", handleRefCount},
+};
+
+} // namespace
+
+const std::vector<std::string>& microNames() {
+    static const std::vector<std::string> names = [] {
+        std::vector<std::string> result;
+        for (const Registration& micro : s_micro) {
+            result.push_back(micro.name);
+        }
+        return result;
+    }();
+    return names;
+}
+
+MicroBenchmark findMicro(const std::string& name) {
+    for (const Registration& micro : s_micro) {
+        if (name == micro.name) {
+            return micro.run;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace Bench
+} // namespace Aurora
@@ -0,0 +1,52 @@
+// ============================================
+// bench/Micro.hpp
+// ============================================
+#pragma once
+#include <aurora/core/Timer.hpp>
+#include <aurora/core/Types.hpp>
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Aurora {
+namespace Bench {
+
+// Named measurements of one micro-benchmark, in the order they were taken
+struct MicroResult {
+    std::vector<std::pair<std::string, f64>> metrics;
+
+    void set(const std::string& name, f64 value) { metrics.emplace_back(name, value); }
+};
+
+// A CPU-only hot loop over one subsystem: no window, no GL context.
+// Counts are fixed so results compare across commits.
+using MicroBenchmark = void (*)(MicroResult& result);
+
+// Registered micro-benchmarks, in the order "all" runs them
+const std::vector<std::string>& microNames();
+MicroBenchmark findMicro(const std::string& name);
+
+// Nanoseconds per call of fn(i) over `count` calls, best of `repeats` runs
+template<typename F>
+f64 nsPerOp(u64 count, F&& fn, u32 repeats = 5) {
+    f64 best = 0.0;
+    for (u32 run = 0; run < repeats; ++run) {
+        const u64 start = TimerWheel::clock();
+        for (u64 i = 0; i < count; ++i) {
+            fn(i);
+        }
+        const f64 ns = (f64)(TimerWheel::clock() - start) / (f64)count;
+        best = run ? std::min(best, ns) : ns;
+    }
+    return best;
+}
+
+// Keep a value observable so the work producing it is not optimized out
+template<typename T>
+inline void keep(const T& value) {
+    asm volatile("" : : "g"(&value) : "memory");
+}
+
+} // namespace Bench
+} // namespace Aurora
@@ -0,0 +1,240 @@
+// ============================================
+// bench/MicroAnimation.cpp
+// ============================================
+// Tween, spring, easing and keyframe hot loops.
+#include "Micro.hpp"
+#include <aurora/animation/Animator.hpp>
+#include <aurora/animation/Keyframe.hpp>
+#include <aurora/animation/Spring.hpp>
+#include <cmath>
+
+namespace Aurora {
+namespace Bench {
+
+// 100k f32/Vec2/Color tweens spread over every curve, none finishing
+// during the measurement
+void animatorTweens(MicroResult& result) {
+    constexpr u32 kTweens = 100000;
+    constexpr u32 kTicks = 100;
+    const u32 curves = (u32)Easing::Type::Count;
+
+    std::vector<f32> floats(kTweens);
+    std::vector<Vec2> points(kTweens);
+    std::vector<Color> colors(kTweens);
+
+    Animator animator;
+    for (u32 i = 0; i < kTweens; ++i) {
+        const Easing::Type easing = (Easing::Type)(i % curves);
+        const f32 duration = 1000.0f + (f32)(i % 7);
+        switch (i % 3) {
+            case 0: {
+                Tween<f32> tween;
+                tween.target = &floats[i];
+                tween.to = 1.0f;
+                tween.duration = duration;
+                tween.easing = easing;
+                animator.start(tween);
+                break;
+            }
+            case 1: {
+                Tween<Vec2> tween;
+                tween.target = &points[i];
+                tween.to = {100.0f, 50.0f};
+                tween.duration = duration;
+                tween.easing = easing;
+                animator.start(tween);
+                break;
+            }
+            default: {
+                Tween<Color> tween;
+                tween.target = &colors[i];
+                tween.to = {1, 0.5f, 0.25f, 1};
+                tween.duration = duration;
+                tween.easing = easing;
+                animator.start(tween);
+                break;
+            }
+        }
+    }
+
+    const f64 ns = nsPerOp(kTicks, [&](u64) { animator.update(1.0f / 60.0f); });
+    keep(floats[kTweens / 2]);
+    result.set("tweens", kTweens);
+    result.set("updateMs", ns * 1e-6);
+    result.set("nsPerTween", ns / kTweens);
+}
+
+// 100k springs in four config buckets, retargeted often enough that none
+// comes to rest during the measurement
+void springSystem(MicroResult& result) {
+    constexpr u32 kSprings = 100000;
+    constexpr u32 kTicks = 100;
+
+    Spring::Config configs[4];
+    for (u32 c = 0; c < 4; ++c) {
+        configs[c].stiffness = 100.0f + 150.0f * (f32)c;
+        configs[c].damping = 4.0f + 2.0f * (f32)c;
+    }
+
+    std::vector<f32> outputs(kSprings);
+    std::vector<SpringId> ids(kSprings);
+    SpringSystem system;
+    for (u32 i = 0; i < kSprings; ++i) {
+        ids[i] = system.add(configs[i % 4], 0.0f, 100.0f + (f32)(i % 13), &outputs[i]);
+    }
+
+    u32 moving = 0;
+    f32 target = 0.0f;
+    const f64 ns = nsPerOp(kTicks, [&](u64 tick) {
+        if (tick % 30 == 0) {
+            target = target > 0.0f ? 0.0f : 100.0f;
+            for (SpringId id : ids) {
+                system.setTarget(id, target);
+            }
+        }
+        system.update(1.0f / 60.0f);
+        moving += system.movingCount();
+    }, 1);
+    keep(outputs[kSprings / 2]);
+    result.set("springs", kSprings);
+    result.set("meanMoving", (f64)moving / kTicks);
+    result.set("updateMs", ns * 1e-6);
+    result.set("nsPerSpring", ns / kSprings);
+
+    // One 250 ms hitch against 250 one-millisecond steps
+    Spring::Config stiff;
+    stiff.stiffness = 5000.0f;
+    stiff.damping = 20.0f;
+    Spring hitched(stiff), stepped(stiff);
+    hitched.reset(100.0f);
+    stepped.reset(100.0f);
+    hitched.update(0.25f);
+    for (int i = 0; i < 250; ++i) {
+        stepped.update(0.001f);
+    }
+    result.set("hitchError", std::fabs(hitched.position() - stepped.position()));
+}
+
+// Analytic curves against their 256-sample baked tables: cost of one
+// scalar evaluation each way and the table's worst error
+void easingTables(MicroResult& result) {
+    struct Curve {
+        const char* name;
+        Easing::Type type;
+    };
+    const Curve curves[] = {
+        {"quadOut", Easing::Type::QuadOut},
+        {"cubicInOut", Easing::Type::CubicInOut},
+        {"elasticOut", Easing::Type::ElasticOut},
+        {"bounceOut", Easing::Type::BounceOut},
+        {"backOut", Easing::Type::BackOut},
+    };
+    constexpr u32 kInputs = 4096;
+    constexpr u64 kEvaluations = 1000000;
+
+    // Scattered inputs so neither path sees a predictable pattern
+    std::vector<f32> inputs(kInputs);
+    u32 state = 12345;
+    for (f32& t : inputs) {
+        state = state * 1664525u + 1013904223u;
+        t = (f32)(state >> 8) / (f32)(1u << 24);
+    }
+
+    for (const Curve& curve : curves) {
+        const EasingCurve analytic(curve.type);
+        const EasingCurve baked = EasingCurve::baked(curve.type);
+
+        f32 sum = 0.0f;
+        const f64 analyticNs = nsPerOp(kEvaluations, [&](u64 i) { sum += analytic(inputs[i & (kInputs - 1)]); });
+        const f64 bakedNs = nsPerOp(kEvaluations, [&](u64 i) { sum += baked(inputs[i & (kInputs - 1)]); });
+        keep(sum);
+
+        f64 maxError = 0.0;
+        for (u32 i = 0; i <= 100000; ++i) {
+            const f32 t = (f32)i / 100000.0f;
+            maxError = std::max(maxError, (f64)std::fabs(analytic(t) - baked(t)));
+        }
+        const std::string name = curve.name;
+        result.set(name + "AnalyticNs", analyticNs);
+        result.set(name + "TableNs", bakedNs);
+        result.set(name + "MaxError", maxError);
+    }
+}
+
+// 1M samples of a 1000-key Color track: forward playback through the
+// cursor, random access through binary search, then forward playback of
+// a KeyframeAnimation driven by a Timeline
+void keyframeTrack(MicroResult& result) {
+    constexpr u32 kKeys = 1000;
+    constexpr u64 kSamples = 1000000;
+
+    KeyframeTrack<Color> track;
+    for (u32 i = 0; i < kKeys; ++i) {
+        const f32 v = (f32)(i % 10) / 10.0f;
+        track.add((f32)i * 0.1f, {v, 1.0f - v, v * 0.5f, 1.0f},
+                  i % 2 ? EasingCurve(Easing::Type::CubicInOut) : EasingCurve());
+    }
+    track.compile();
+    const f32 duration = track.duration();
+
+    Color sum;
+    const f64 forwardNs = nsPerOp(kSamples, [&](u64 i) {
+        const Color c = track.sample(duration * (f32)i / (f32)kSamples);
+        sum.r += c.r;
+    }, 3);
+
+    std::vector<f32> times(4096);
+    u32 state = 987654321;
+    for (f32& time : times) {
+        state = state * 1664525u + 1013904223u;
+        time = duration * (f32)(state >> 8) / (f32)(1u << 24);
+    }
+    const f64 randomNs = nsPerOp(kSamples, [&](u64 i) {
+        const Color c = track.sampleAt(times[i & 4095]);
+        sum.g += c.g;
+    }, 3);
+
+    // Timeline seeks its children on every update
+    Color target;
+    Timeline timeline;
+    timeline.add(makeHandle<KeyframeAnimation<Color>>(&target, track));
+    timeline.play();
+    const f32 step = duration / (f32)kSamples;
+    const f64 timelineNs = nsPerOp(kSamples, [&](u64) {
+        timeline.update(step);
+        sum.b += target.b;
+    }, 1);
+    keep(sum);
+
+    result.set("keys", kKeys);
+    result.set("samples", (f64)kSamples);
+    result.set("forwardNs", forwardNs);
+    result.set("randomNs", randomNs);
+    result.set("timelineNs", timelineNs);
+}
+
+// Timeline update cost against entry count: 0.3 s animations staggered
+// 10 ms apart keep about 30 active whatever the total
+void timelineEntries(MicroResult& result) {
+    constexpr u64 kFrames = 60;
+
+    for (u32 entries : {100u, 1000u, 10000u, 100000u}) {
+        std::vector<f32> targets(entries);
+        Timeline timeline;
+        for (u32 i = 0; i < entries; ++i) {
+            timeline.add(makeHandle<PropertyAnimation<f32>>(&targets[i], 0.0f, 1.0f, 0.3f),
+                         (f32)i * 0.01f);
+        }
+        timeline.play();
+        timeline.seek(timeline.duration() * 0.5f - 0.5f);
+
+        const f64 ns = nsPerOp(kFrames, [&](u64) { timeline.update(1.0f / 60.0f); }, 1);
+        keep(targets[entries / 2]);
+        const std::string name = std::to_string(entries);
+        result.set("update" + name + "Us", ns * 1e-3);
+        result.set("active" + name, (f64)timeline.activeCount());
+    }
+}
+
+} // namespace Bench
+} // namespace Aurora
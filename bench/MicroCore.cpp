@@ -0,0 +1,186 @@
+// ============================================
+// bench/MicroCore.cpp
+// ============================================
+// Signal, timer and reference-counting hot loops.
+#include "Micro.hpp"
+#include <aurora/core/Pool.hpp>
+#include <aurora/core/RefCounted.hpp>
+#include <aurora/core/Signal.hpp>
+#include <aurora/core/Timer.hpp>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace Aurora {
+namespace Bench {
+
+// Signal::emit with 0/1/10/100 direct slots against a plain vector of
+// std::function, plus one slot emitted from a thread that does not own
+// the signal (the atomic reader path)
+void signalEmit(MicroResult& result) {
+    constexpr u64 kEmits = 1000000;
+    const u32 slotCounts[] = {0, 1, 10, 100};
+
+    for (u32 slots : slotCounts) {
+        const u64 emits = slots >= 100 ? kEmits / 10 : kEmits;
+        u64 sum = 0;
+
+        Signal<i32> signal;
+        std::vector<std::function<void(i32)>> functions;
+        for (u32 i = 0; i < slots; ++i) {
+            signal.connect([&sum](i32 value) { sum += (u64)value; });
+            functions.push_back([&sum](i32 value) { sum += (u64)value; });
+        }
+
+        const f64 emitNs = nsPerOp(emits, [&](u64 i) { signal.emit((i32)i); });
+        const f64 functionNs = nsPerOp(emits, [&](u64 i) {
+            for (const auto& fn : functions) {
+                fn((i32)i);
+            }
+        });
+        keep(sum);
+
+        const std::string count = std::to_string(slots);
+        result.set("emit" + count + "Ns", emitNs);
+        result.set("function" + count + "Ns", functionNs);
+    }
+
+    u64 sum = 0;
+    Signal<i32> signal;
+    signal.connect([&sum](i32 value) { sum += (u64)value; });
+    f64 foreignNs = 0.0;
+    std::thread([&] {
+        foreignNs = nsPerOp(kEmits, [&](u64 i) { signal.emit((i32)i); });
+    }).join();
+    keep(sum);
+    result.set("foreignEmit1Ns", foreignNs);
+}
+
+// 1M timers with deadlines spread over 60 s: schedule all, cancel every
+// other one, then advance in 16 ms frames until the rest have fired.
+// The baseline is an ordered std::multimap of deadlines, cancelled through
+// iterators kept at insertion.
+void timerWheel(MicroResult& result) {
+    constexpr u32 kTimers = 1000000;
+    constexpr u64 kSpan = 60000000000ull;      // 60 s in ns
+    constexpr u64 kFrame = 16000000ull;        // 16 ms
+
+    std::vector<u64> delays(kTimers);
+    u64 seed = 0x9E3779B97F4A7C15ull;
+    for (u64& delay : delays) {
+        seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        delay = (seed >> 11) % kSpan + 1;
+    }
+
+    u64 fired = 0;
+    auto callback = [&fired] { ++fired; };
+
+    {
+        TimerWheel wheel(0);
+        std::vector<TimerId> ids(kTimers);
+        const f64 scheduleNs = nsPerOp(kTimers, [&](u64 i) {
+            ids[i] = wheel.schedule((f64)delays[i] * 1e-9, callback);
+        }, 1);
+        const f64 cancelNs = nsPerOp(kTimers / 2, [&](u64 i) { wheel.cancel(ids[i * 2]); }, 1);
+
+        fired = 0;
+        const u64 start = TimerWheel::clock();
+        for (u64 time = 0; time <= kSpan + kFrame; time += kFrame) {
+            wheel.advance(time);
+        }
+        const f64 expireNs = (f64)(TimerWheel::clock() - start) / (f64)std::max<u64>(fired, 1);
+
+        result.set("wheelScheduleNs", scheduleNs);
+        result.set("wheelCancelNs", cancelNs);
+        result.set("wheelExpireNs", expireNs);
+        result.set("wheelFired", (f64)fired);
+    }
+
+    {
+        std::multimap<u64, std::function<void()>> timers;
+        std::vector<std::multimap<u64, std::function<void()>>::iterator> ids(kTimers);
+        const f64 scheduleNs = nsPerOp(kTimers, [&](u64 i) {
+            ids[i] = timers.emplace(delays[i], callback);
+        }, 1);
+        const f64 cancelNs = nsPerOp(kTimers / 2, [&](u64 i) { timers.erase(ids[i * 2]); }, 1);
+
+        fired = 0;
+        const u64 start = TimerWheel::clock();
+        for (u64 time = 0; time <= kSpan + kFrame; time += kFrame) {
+            while (!timers.empty() && timers.begin()->first <= time) {
+                auto due = timers.begin()->second;
+                timers.erase(timers.begin());
+                due();
+            }
+        }
+        const f64 expireNs = (f64)(TimerWheel::clock() - start) / (f64)std::max<u64>(fired, 1);
+
+        result.set("multimapScheduleNs", scheduleNs);
+        result.set("multimapCancelNs", cancelNs);
+        result.set("multimapExpireNs", expireNs);
+        result.set("multimapFired", (f64)fired);
+    }
+}
+
+namespace {
+
+struct Payload {
+    f32 x = 0, y = 0, width = 0, height = 0;
+    u32 flags = 0;
+};
+
+struct SharedNode : Payload {};
+struct LocalNode : Payload, RefCounted<LocalNode, RefPolicy::Local>, Pooled<LocalNode> {};
+struct AtomicNode : Payload, RefCounted<AtomicNode> {};
+
+// ns per create plus destroy, in batches so the allocator sees many live
+// objects rather than one block bouncing
+template<typename Make>
+f64 createDestroyNs(Make&& make) {
+    constexpr u64 kBatch = 1000;
+    constexpr u64 kBatches = 1000;
+    using Pointer = decltype(make());
+    std::vector<Pointer> live;
+    live.reserve(kBatch);
+    return nsPerOp(kBatches, [&](u64) {
+        for (u64 i = 0; i < kBatch; ++i) {
+            live.push_back(make());
+        }
+        live.clear();
+    }) / (f64)kBatch;
+}
+
+// ns per copy plus drop of an owning pointer
+template<typename Pointer>
+f64 copyNs(const Pointer& pointer) {
+    return nsPerOp(10000000, [&](u64) {
+        Pointer copy = pointer;
+        keep(copy);
+    });
+}
+
+} // namespace
+
+// Intrusive Handle (plain and atomic counts, slab pooled or not) against
+// std::shared_ptr from make_shared
+void handleRefCount(MicroResult& result) {
+    // libstdc++ drops shared_ptr's atomics while the process has never
+    // started a thread; the application always has, so match it
+    std::thread([] {}).join();
+
+    result.set("sharedCreateNs", createDestroyNs([] { return std::make_shared<SharedNode>(); }));
+    result.set("handleCreateNs", createDestroyNs([] { return makeHandle<AtomicNode>(); }));
+    result.set("pooledHandleCreateNs", createDestroyNs([] { return makeHandle<LocalNode>(); }));
+
+    result.set("sharedCopyNs", copyNs(std::make_shared<SharedNode>()));
+    result.set("handleCopyNs", copyNs(makeHandle<AtomicNode>()));
+    result.set("localHandleCopyNs", copyNs(makeHandle<LocalNode>()));
+
+    result.set("sharedBytes", (f64)sizeof(std::shared_ptr<SharedNode>));
+    result.set("handleBytes", (f64)sizeof(Handle<AtomicNode>));
+}
+
+} // namespace Bench
+} // namespace Aurora
@@ -0,0 +1,81 @@
+// ============================================
+// bench/Scene.hpp
+// ============================================
+#pragma once
+#include <aurora/graphics/Renderer.hpp>
+#include <aurora/platform/headless/HeadlessPlatform.hpp>
+#include <string>
+#include <vector>
+
+namespace Aurora {
+namespace Bench {
+
+struct SceneConfig {
+    u32 width = 1280;
+    u32 height = 800;
+    f32 scale = 1.0f;       // Multiplies each scene's element count
+    u64 frames = 0;         // Warmup plus measured frames
+};
+
+// A scripted workload. State depends only on the frame index and the
+// scheduled input, never on wall time, so every run issues the same
+// GL command stream and renders the same pixels.
+class Scene {
+public:
+    virtual ~Scene() = default;
+
+    virtual const char* name() const = 0;
+
+    // Build the scene and schedule its input
+    virtual void setup(const SceneConfig& config) = 0;
+    virtual void event(const Event& event) {}
+    virtual void update(u64 frame, f32 deltaTime) = 0;
+    virtual void render(Renderer& renderer) = 0;
+
+    // Elements the scene models (drawn or culled)
+    virtual u32 elementCount() const = 0;
+
+    void attach(HeadlessPlatform* platform, Window* window) {
+        m_platform = platform;
+        m_window = window;
+        m_firstFrame = platform->pumpCount();
+    }
+
+protected:
+    // Input delivered by the pump of the given scene frame
+    void scheduleMouseMove(u64 frame, f32 x, f32 y) {
+        Event event(EventType::MouseMove);
+        event.window = m_window;
+        event.mouse.x = x;
+        event.mouse.y = y;
+        m_platform->scheduleEvent(m_firstFrame + frame, event);
+    }
+
+    void scheduleMouseButton(u64 frame, bool pressed) {
+        Event event(pressed ? EventType::MouseDown : EventType::MouseUp);
+        event.window = m_window;
+        event.mouseButton.button = MouseButton::Left;
+        m_platform->scheduleEvent(m_firstFrame + frame, event);
+    }
+
+    void scheduleScroll(u64 frame, f32 dx, f32 dy) {
+        Event event(EventType::MouseScroll);
+        event.window = m_window;
+        event.scroll.dx = dx;
+        event.scroll.dy = dy;
+        event.scroll.precise = false;
+        m_platform->scheduleEvent(m_firstFrame + frame, event);
+    }
+
+private:
+    HeadlessPlatform* m_platform = nullptr;
+    Window* m_window = nullptr;
+    u64 m_firstFrame = 0;
+};
+
+// Registered scenes, in the order "all" runs them
+const std::vector<std::string>& sceneNames();
+Unique<Scene> createScene(const std::string& name);
+
+} // namespace Bench
+} // namespace Aurora
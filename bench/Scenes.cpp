@@ -0,0 +1,738 @@
+// ============================================
+// bench/Scenes.cpp
+// ============================================
+#include "Scene.hpp"
+#include <aurora/animation/Animator.hpp>
+#include <aurora/animation/Spring.hpp>
+#include <aurora/ui/Widget.hpp>
+#include <algorithm>
+#include <cmath>
+
+namespace Aurora {
+namespace Bench {
+
+namespace {
+
+constexpr f32 kPi = 3.14159265358979f;
+
+u32 scaled(u32 base, f32 scale) {
+    return std::max(1u, (u32)std::lround(base * scale));
+}
+
+Color hsv(f32 hue, f32 saturation, f32 value, f32 alpha = 1.0f) {
+    hue = std::fmod(hue, 360.0f);
+    if (hue < 0.0f) hue += 360.0f;
+    const f32 c = value * saturation;
+    const f32 x = c * (1.0f - std::fabs(std::fmod(hue / 60.0f, 2.0f) - 1.0f));
+    const f32 m = value - c;
+    f32 r = 0, g = 0, b = 0;
+    if (hue < 60) { r = c; g = x; }
+    else if (hue < 120) { r = x; g = c; }
+    else if (hue < 180) { g = c; b = x; }
+    else if (hue < 240) { g = x; b = c; }
+    else if (hue < 300) { r = x; b = c; }
+    else { r = c; b = x; }
+    return {r + m, g + m, b + m, alpha};
+}
+
+Color scaleColor(const Color& color, f32 factor) {
+    return {color.r * factor, color.g * factor, color.b * factor, color.a};
+}
+
+// Deterministic noise for scene data
+u32 hash(u32 x) {
+    x ^= x >> 16;
+    x *= 0x7feb352d;
+    x ^= x >> 15;
+    x *= 0x846ca68b;
+    x ^= x >> 16;
+    return x;
+}
+
+f32 noise(u32 x) {
+    return (hash(x) & 0xFFFF) / 65535.0f;
+}
+
+// Cells of a grid that fits count items into an area
+struct Grid {
+    u32 columns = 1;
+    u32 rows = 1;
+    f32 cellWidth = 0;
+    f32 cellHeight = 0;
+
+    Grid() = default;
+    Grid(u32 count, f32 width, f32 height) {
+        columns = std::max(1u, (u32)std::ceil(std::sqrt(count * width / height)));
+        rows = (count + columns - 1) / columns;
+        cellWidth = width / columns;
+        cellHeight = height / rows;
+    }
+
+    Rect cell(u32 index, f32 inset = 0.0f) const {
+        return {(index % columns) * cellWidth + inset, (index / columns) * cellHeight + inset,
+                cellWidth - 2 * inset, cellHeight - 2 * inset};
+    }
+};
+
+// ----------------------------------------------------------------------
+// hello_window: animated clear plus a grid of flat quads (examples/01)
+
+class HelloWindowScene : public Scene {
+public:
+    const char* name() const override { return "hello_window"; }
+
+    void setup(const SceneConfig& config) override {
+        m_count = scaled(4096, config.scale);
+        m_grid = Grid(m_count, (f32)config.width, (f32)config.height);
+        m_colors.resize(m_count);
+    }
+
+    void update(u64 frame, f32 deltaTime) override {
+        m_hue = std::fmod(m_hue + deltaTime * 50.0f, 360.0f);
+        for (u32 i = 0; i < m_count; ++i) {
+            m_colors[i] = hsv(m_hue + i * 0.35f, 0.6f, 0.9f);
+        }
+    }
+
+    void render(Renderer& renderer) override {
+        renderer.clear(hsv(m_hue, 1.0f, 0.3f));
+        for (u32 i = 0; i < m_count; ++i) {
+            renderer.drawQuad(m_grid.cell(i, 1.0f), m_colors[i]);
+        }
+    }
+
+    u32 elementCount() const override { return m_count; }
+
+private:
+    u32 m_count = 0;
+    Grid m_grid;
+    std::vector<Color> m_colors;
+    f32 m_hue = 0.0f;
+};
+
+// ----------------------------------------------------------------------
+// animated_button: hover and press tweens on a field of buttons
+// (examples/02). The cursor lights up every button within a radius, so
+// tweens start and stop on every frame.
+
+class AnimatedButtonScene : public Scene {
+public:
+    const char* name() const override { return "animated_button"; }
+
+    void setup(const SceneConfig& config) override {
+        m_count = scaled(1024, config.scale);
+        m_grid = Grid(m_count, (f32)config.width, (f32)config.height);
+        m_buttons.resize(m_count);
+        for (u32 i = 0; i < m_count; ++i) {
+            m_buttons[i].rect = m_grid.cell(i, 3.0f);
+            m_buttons[i].fill = idleColor(i);
+        }
+        m_radius = std::max(m_grid.cellWidth, m_grid.cellHeight) * 2.5f;
+
+        const f32 w = (f32)config.width, h = (f32)config.height;
+        for (u64 f = 0; f < config.frames; ++f) {
+            scheduleMouseMove(f, w * (0.5f + 0.45f * std::sin(f * 0.031f)),
+                              h * (0.5f + 0.45f * std::sin(f * 0.047f)));
+            if (f % 20 == 0) scheduleMouseButton(f, true);
+            if (f % 20 == 6) scheduleMouseButton(f, false);
+        }
+    }
+
+    void event(const Event& event) override {
+        if (event.type == EventType::MouseMove) {
+            hover(event.mouse.x, event.mouse.y);
+        } else if (event.type == EventType::MouseDown) {
+            for (u32 i : m_hovered) {
+                press(i);
+            }
+        }
+    }
+
+    void update(u64 frame, f32 deltaTime) override {
+        m_animator.update(deltaTime);
+    }
+
+    void render(Renderer& renderer) override {
+        renderer.clear({0.08f, 0.09f, 0.11f, 1.0f});
+
+        Material material;
+        material.gradient = true;
+        material.borderWidth = 1.0f;
+        material.borderColor = {1.0f, 1.0f, 1.0f, 0.3f};
+
+        for (const Button& button : m_buttons) {
+            const Rect& r = button.rect;
+            const f32 w = r.width * button.scale, h = r.height * button.scale;
+            const Rect body = {r.x + (r.width - w) * 0.5f, r.y + (r.height - h) * 0.5f, w, h};
+            const f32 radius = std::min(w, h) * 0.25f;
+
+            renderer.drawRoundedRect({body.x, body.y + 2.0f, w, h}, radius, {0.0f, 0.0f, 0.0f, 0.25f});
+
+            material.color = button.fill;
+            material.gradientEnd = scaleColor(button.fill, 0.7f);
+            material.size = {w, h};
+            material.cornerRadius = radius;
+            renderer.drawQuad(body, material);
+
+            renderer.drawQuad({body.x + w * 0.25f, body.y + h * 0.5f - 2.0f, w * 0.5f, 4.0f},
+                              {1.0f, 1.0f, 1.0f, 0.85f});
+        }
+    }
+
+    u32 elementCount() const override { return m_count; }
+
+private:
+    struct Button {
+        Rect rect;
+        Color fill;
+        f32 scale = 1.0f;
+        bool hovered = false;
+        u64 stamp = 0;
+        TweenId hoverTween = 0;
+        TweenId pressTween = 0;
+    };
+
+    static Color idleColor(u32 i) { return hsv(200.0f + (i % 7) * 8.0f, 0.55f, 0.55f); }
+    static Color hoverColor(u32 i) { return hsv(200.0f + (i % 7) * 8.0f, 0.65f, 0.95f); }
+
+    void hover(f32 x, f32 y) {
+        ++m_moves;
+        const i32 c0 = std::max(0, (i32)((x - m_radius) / m_grid.cellWidth));
+        const i32 c1 = std::min((i32)m_grid.columns - 1, (i32)((x + m_radius) / m_grid.cellWidth));
+        const i32 r0 = std::max(0, (i32)((y - m_radius) / m_grid.cellHeight));
+        const i32 r1 = std::min((i32)m_grid.rows - 1, (i32)((y + m_radius) / m_grid.cellHeight));
+
+        m_next.clear();
+        for (i32 row = r0; row <= r1; ++row) {
+            for (i32 col = c0; col <= c1; ++col) {
+                const u32 i = row * m_grid.columns + col;
+                if (i >= m_count) continue;
+                const Rect& r = m_buttons[i].rect;
+                const f32 dx = r.x + r.width * 0.5f - x, dy = r.y + r.height * 0.5f - y;
+                if (dx * dx + dy * dy > m_radius * m_radius) continue;
+                m_buttons[i].stamp = m_moves;
+                m_next.push_back(i);
+                if (!m_buttons[i].hovered) animateHover(i, true);
+            }
+        }
+        for (u32 i : m_hovered) {
+            if (m_buttons[i].stamp != m_moves) animateHover(i, false);
+        }
+        m_hovered.swap(m_next);
+    }
+
+    void animateHover(u32 i, bool hovered) {
+        Button& button = m_buttons[i];
+        button.hovered = hovered;
+        m_animator.cancel(button.hoverTween);
+
+        Tween<Color> tween;
+        tween.target = &button.fill;
+        tween.from = button.fill;
+        tween.to = hovered ? hoverColor(i) : idleColor(i);
+        tween.duration = 0.15f;
+        button.hoverTween = m_animator.start(tween);
+    }
+
+    void press(u32 i) {
+        Button& button = m_buttons[i];
+        m_animator.cancel(button.pressTween);
+
+        Tween<f32> tween;
+        tween.target = &button.scale;
+        tween.from = button.scale;
+        tween.to = 0.92f;
+        tween.duration = 0.08f;
+        tween.onComplete = [this, i] {
+            Tween<f32> release;
+            release.target = &m_buttons[i].scale;
+            release.from = m_buttons[i].scale;
+            release.to = 1.0f;
+            release.duration = 0.2f;
+            release.easing = Easing::Type::BackOut;
+            m_buttons[i].pressTween = m_animator.start(release);
+        };
+        button.pressTween = m_animator.start(tween);
+    }
+
+    u32 m_count = 0;
+    Grid m_grid;
+    std::vector<Button> m_buttons;
+    std::vector<u32> m_hovered;
+    std::vector<u32> m_next;
+    f32 m_radius = 0.0f;
+    u64 m_moves = 0;
+    Animator m_animator;
+};
+
+// ----------------------------------------------------------------------
+// dock: rows of icons magnified by springs around the cursor
+// (examples/03)
+
+class DockScene : public Scene {
+public:
+    const char* name() const override { return "dock"; }
+
+    void setup(const SceneConfig& config) override {
+        m_count = scaled(1536, config.scale);
+        m_rows = (m_count + kPerRow - 1) / kPerRow;
+        m_width = (f32)config.width;
+        m_slot = m_width / (kPerRow + 8);
+        m_rowHeight = (f32)config.height / m_rows;
+
+        Spring::Config spring;
+        spring.stiffness = 300.0f;
+        spring.damping = 20.0f;
+        m_scales.assign(m_count, 1.0f);
+        m_springs.reserve(m_count);
+        for (u32 i = 0; i < m_count; ++i) {
+            m_springs.push_back(m_system.add(spring, 1.0f, 1.0f, &m_scales[i]));
+        }
+
+        // Sweep across one row, then move to the next
+        for (u64 f = 0; f < config.frames; ++f) {
+            const u32 row = (u32)(f / 90) % m_rows;
+            scheduleMouseMove(f, m_width * (0.5f + 0.48f * std::sin(f * 0.07f)),
+                              (row + 0.5f) * m_rowHeight);
+        }
+    }
+
+    void event(const Event& event) override {
+        if (event.type == EventType::MouseMove) {
+            m_cursor = {event.mouse.x, event.mouse.y};
+        }
+    }
+
+    void update(u64 frame, f32 deltaTime) override {
+        const u32 cursorRow = (u32)(m_cursor.y / m_rowHeight);
+        const f32 reach = m_slot * 3.0f;
+        for (u32 i = 0; i < m_count; ++i) {
+            f32 target = 1.0f;
+            if (i / kPerRow == cursorRow) {
+                const f32 d = std::fabs(restCenter(i) - m_cursor.x);
+                target += 0.8f * std::max(0.0f, 1.0f - d / reach);
+            }
+            m_system.setTarget(m_springs[i], target);
+        }
+        m_system.update(deltaTime);
+    }
+
+    void render(Renderer& renderer) override {
+        renderer.clear({0.16f, 0.2f, 0.3f, 1.0f});
+
+        Material background;
+        background.color = {1.0f, 1.0f, 1.0f, 0.22f};
+        background.gradient = true;
+        background.gradientEnd = {1.0f, 1.0f, 1.0f, 0.12f};
+        background.borderWidth = 1.0f;
+        background.borderColor = {1.0f, 1.0f, 1.0f, 0.35f};
+
+        Material icon;
+        icon.gradient = true;
+
+        const f32 base = std::min(m_slot, m_rowHeight) * 0.8f;
+        for (u32 row = 0; row < m_rows; ++row) {
+            const u32 first = row * kPerRow;
+            const u32 last = std::min(first + kPerRow, m_count);
+
+            // Magnified icons push their neighbours outwards
+            f32 rowWidth = 0.0f;
+            for (u32 i = first; i < last; ++i) rowWidth += m_slot * m_scales[i];
+            const f32 bottom = (row + 1) * m_rowHeight - m_rowHeight * 0.1f;
+            const f32 dockHeight = base * 1.15f;
+            const Rect dock = {(m_width - rowWidth) * 0.5f - m_slot * 0.5f, bottom - dockHeight,
+                               rowWidth + m_slot, dockHeight};
+            background.size = {dock.width, dock.height};
+            background.cornerRadius = dockHeight * 0.3f;
+            renderer.drawQuad(dock, background);
+
+            f32 x = (m_width - rowWidth) * 0.5f;
+            for (u32 i = first; i < last; ++i) {
+                const f32 size = base * m_scales[i];
+                const f32 slot = m_slot * m_scales[i];
+                const Rect r = {x + (slot - size) * 0.5f, bottom - size - base * 0.1f, size, size};
+                icon.color = hsv(i * 37.0f, 0.6f, 0.95f);
+                icon.gradientEnd = scaleColor(icon.color, 0.6f);
+                icon.size = {size, size};
+                icon.cornerRadius = size * 0.22f;
+                renderer.drawQuad(r, icon);
+
+                if (i % 3 == 0) {
+                    renderer.drawCircle({x + slot * 0.5f, bottom - base * 0.05f}, 1.5f, {1, 1, 1, 0.9f});
+                }
+                x += slot;
+            }
+        }
+    }
+
+    u32 elementCount() const override { return m_count; }
+
+private:
+    static constexpr u32 kPerRow = 48;
+
+    f32 restCenter(u32 i) const {
+        const u32 inRow = std::min(kPerRow, m_count - (i / kPerRow) * kPerRow);
+        return (m_width - inRow * m_slot) * 0.5f + ((i % kPerRow) + 0.5f) * m_slot;
+    }
+
+    u32 m_count = 0;
+    u32 m_rows = 1;
+    f32 m_width = 0.0f;
+    f32 m_slot = 0.0f;
+    f32 m_rowHeight = 0.0f;
+    Vec2 m_cursor;
+    SpringSystem m_system;
+    std::vector<SpringId> m_springs;
+    std::vector<f32> m_scales;
+};
+
+// ----------------------------------------------------------------------
+// panel: scrolling settings lists clipped by scissor, with toggles
+// (examples/04)
+
+class PanelScene : public Scene {
+public:
+    const char* name() const override { return "panel"; }
+
+    void setup(const SceneConfig& config) override {
+        m_count = scaled(4096, config.scale);
+        m_rowsPerPanel = (m_count + kPanels - 1) / kPanels;
+        m_toggles.assign(m_count, 0.0f);
+
+        const f32 margin = 16.0f;
+        const f32 width = ((f32)config.width - margin * (kPanels + 1)) / kPanels;
+        for (u32 p = 0; p < kPanels; ++p) {
+            m_panels[p] = {margin + p * (width + margin), margin, width, (f32)config.height - 2 * margin};
+        }
+
+        // Scroll down, then back up; click a toggle every 15 frames
+        for (u64 f = 0; f < config.frames; ++f) {
+            scheduleScroll(f, 0.0f, (f / 240) % 2 == 0 ? -1.0f : 1.0f);
+            if (f % 15 == 0) {
+                scheduleMouseMove(f, m_panels[0].x + m_panels[0].width - 30.0f,
+                                  m_panels[0].y + kHeader + 10.0f + (f % 400));
+                scheduleMouseButton(f, true);
+                scheduleMouseButton(f, false);
+            }
+        }
+    }
+
+    void event(const Event& event) override {
+        switch (event.type) {
+            case EventType::MouseScroll: {
+                const f32 content = m_rowsPerPanel * kRowHeight - (m_panels[0].height - kHeader);
+                m_scroll = std::clamp(m_scroll - event.scroll.dy * 24.0f, 0.0f, std::max(content, 0.0f));
+                break;
+            }
+            case EventType::MouseMove:
+                m_cursor = {event.mouse.x, event.mouse.y};
+                break;
+            case EventType::MouseDown:
+                click();
+                break;
+            default:
+                break;
+        }
+    }
+
+    void update(u64 frame, f32 deltaTime) override {
+        m_animator.update(deltaTime);
+    }
+
+    void render(Renderer& renderer) override {
+        renderer.clear({0.93f, 0.94f, 0.96f, 1.0f});
+
+        Material panel;
+        panel.color = {1.0f, 1.0f, 1.0f, 1.0f};
+        panel.cornerRadius = 10.0f;
+        panel.borderWidth = 1.0f;
+        panel.borderColor = {0.0f, 0.0f, 0.0f, 0.12f};
+
+        Material header;
+        header.color = {0.25f, 0.45f, 0.85f, 1.0f};
+        header.gradient = true;
+        header.gradientEnd = {0.2f, 0.35f, 0.75f, 1.0f};
+
+        for (u32 p = 0; p < kPanels; ++p) {
+            const Rect& r = m_panels[p];
+            panel.size = {r.width, r.height};
+            renderer.drawQuad(r, panel);
+            header.size = {r.width, kHeader};
+            renderer.drawQuad({r.x, r.y, r.width, kHeader}, header);
+            renderer.drawQuad({r.x + 12.0f, r.y + kHeader * 0.5f - 3.0f, r.width * 0.4f, 6.0f}, {1, 1, 1, 0.9f});
+
+            const Rect list = {r.x, r.y + kHeader, r.width, r.height - kHeader};
+            const f32 scroll = scrollFor(p);
+            const u32 first = (u32)(scroll / kRowHeight);
+            const u32 last = std::min(m_rowsPerPanel, (u32)((scroll + list.height) / kRowHeight) + 1);
+
+            renderer.pushState();
+            renderer.setScissor((i32)list.x, (i32)list.y, (u32)list.width, (u32)list.height);
+            for (u32 row = first; row < last; ++row) {
+                const u32 i = p * m_rowsPerPanel + row;
+                if (i >= m_count) break;
+                const f32 y = list.y + row * kRowHeight - scroll;
+                if (row % 2) {
+                    renderer.drawQuad({list.x, y, list.width, kRowHeight}, {0.0f, 0.0f, 0.0f, 0.03f});
+                }
+                renderer.drawCircle({list.x + 18.0f, y + kRowHeight * 0.5f}, 7.0f, hsv(i * 23.0f, 0.5f, 0.85f));
+                renderer.drawQuad({list.x + 34.0f, y + kRowHeight * 0.5f - 3.0f,
+                                   (0.3f + 0.3f * noise(i)) * list.width, 6.0f}, {0.2f, 0.2f, 0.25f, 0.8f});
+
+                const f32 t = m_toggles[i];
+                const Rect track = {list.x + list.width - 48.0f, y + 6.0f, 36.0f, kRowHeight - 12.0f};
+                const Color off = {0.78f, 0.78f, 0.8f, 1.0f}, on = {0.2f, 0.75f, 0.4f, 1.0f};
+                renderer.drawRoundedRect(track, track.height * 0.5f,
+                                         {off.r + (on.r - off.r) * t, off.g + (on.g - off.g) * t,
+                                          off.b + (on.b - off.b) * t, 1.0f});
+                const f32 knob = track.height * 0.5f - 2.0f;
+                renderer.drawCircle({track.x + track.height * 0.5f + t * (track.width - track.height),
+                                     track.y + track.height * 0.5f}, knob, {1, 1, 1, 1});
+            }
+            renderer.popState();
+        }
+    }
+
+    u32 elementCount() const override { return m_count; }
+
+private:
+    static constexpr u32 kPanels = 4;
+    static constexpr f32 kRowHeight = 28.0f;
+    static constexpr f32 kHeader = 36.0f;
+
+    // Panels scroll at different speeds so their visible rows differ
+    f32 scrollFor(u32 panel) const {
+        const f32 content = m_rowsPerPanel * kRowHeight - (m_panels[panel].height - kHeader);
+        return std::min(m_scroll * (1.0f + 0.25f * panel), std::max(content, 0.0f));
+    }
+
+    void click() {
+        const Rect& r = m_panels[0];
+        if (!r.contains(m_cursor) || m_cursor.y < r.y + kHeader) return;
+        const u32 row = (u32)((m_cursor.y - r.y - kHeader + scrollFor(0)) / kRowHeight);
+        if (row >= m_rowsPerPanel) return;
+
+        Tween<f32> tween;
+        tween.target = &m_toggles[row];
+        tween.from = m_toggles[row];
+        tween.to = m_toggles[row] > 0.5f ? 0.0f : 1.0f;
+        tween.duration = 0.2f;
+        tween.easing = Easing::Type::CubicOut;
+        m_animator.start(tween);
+    }
+
+    u32 m_count = 0;
+    u32 m_rowsPerPanel = 0;
+    Rect m_panels[kPanels] = {};
+    std::vector<f32> m_toggles;
+    f32 m_scroll = 0.0f;
+    Vec2 m_cursor;
+    Animator m_animator;
+};
+
+// ----------------------------------------------------------------------
+// desktop_widgets: a widget tree of clocks, graphs and meters driven by
+// properties (examples/05)
+
+class CardWidget : public Widget {
+public:
+    explicit CardWidget(u32 seed) : m_seed(seed) {
+        invalidateOn(m_time);
+    }
+
+    void setTime(f32 time) { m_time.set(time); }
+
+protected:
+    void paintCard(Renderer& renderer, Rect& content) {
+        const Vec2 origin = mapToWindow({0, 0});
+        const Rect& g = geometry();
+        Material card;
+        card.color = {0.12f, 0.13f, 0.16f, 0.85f};
+        card.gradient = true;
+        card.gradientEnd = {0.08f, 0.09f, 0.11f, 0.85f};
+        card.cornerRadius = std::min(g.width, g.height) * 0.12f;
+        card.borderWidth = 1.0f;
+        card.borderColor = {1.0f, 1.0f, 1.0f, 0.1f};
+        card.size = {g.width, g.height};
+        renderer.drawQuad({origin.x, origin.y, g.width, g.height}, card);
+
+        const f32 pad = std::min(g.width, g.height) * 0.12f;
+        content = {origin.x + pad, origin.y + pad, g.width - 2 * pad, g.height - 2 * pad};
+    }
+
+    Property<f32> m_time{0.0f};
+    u32 m_seed;
+};
+
+class ClockWidget : public CardWidget {
+public:
+    using CardWidget::CardWidget;
+
+protected:
+    void onPaint(Renderer& renderer) override {
+        Rect content;
+        paintCard(renderer, content);
+        const Vec2 c = {content.x + content.width * 0.5f, content.y + content.height * 0.5f};
+        const f32 radius = std::min(content.width, content.height) * 0.5f;
+        renderer.drawCircle(c, radius, {0.9f, 0.9f, 0.92f, 1.0f});
+
+        for (u32 tick = 0; tick < 12; ++tick) {
+            const f32 a = tick * kPi / 6.0f;
+            renderer.drawCircle({c.x + std::cos(a) * radius * 0.85f, c.y + std::sin(a) * radius * 0.85f},
+                                radius * 0.05f, {0.2f, 0.2f, 0.2f, 1.0f});
+        }
+
+        // Hands as rows of dots
+        const f32 t = m_time.get() + m_seed;
+        const f32 hands[2] = {t * 0.1f, t * 1.2f};
+        for (u32 h = 0; h < 2; ++h) {
+            const f32 a = hands[h] - kPi * 0.5f;
+            for (u32 dot = 1; dot <= 3; ++dot) {
+                const f32 d = radius * (h ? 0.22f : 0.18f) * dot;
+                renderer.drawCircle({c.x + std::cos(a) * d, c.y + std::sin(a) * d},
+                                    radius * 0.06f, h ? Color{0.85f, 0.2f, 0.2f, 1.0f} : Color{0.1f, 0.1f, 0.1f, 1.0f});
+            }
+        }
+    }
+};
+
+class GraphWidget : public CardWidget {
+public:
+    using CardWidget::CardWidget;
+
+protected:
+    void onPaint(Renderer& renderer) override {
+        Rect content;
+        paintCard(renderer, content);
+        const u32 frame = (u32)(m_time.get() * 60.0f);
+        const f32 bar = content.width / kBars;
+        for (u32 i = 0; i < kBars; ++i) {
+            const f32 h = content.height * (0.15f + 0.85f * noise(m_seed * 131 + frame + i));
+            renderer.drawQuad({content.x + i * bar, content.y + content.height - h, bar * 0.8f, h},
+                              hsv(120.0f - h / content.height * 120.0f, 0.7f, 0.9f));
+        }
+    }
+
+private:
+    static constexpr u32 kBars = 16;
+};
+
+class MeterWidget : public CardWidget {
+public:
+    using CardWidget::CardWidget;
+
+protected:
+    void onPaint(Renderer& renderer) override {
+        Rect content;
+        paintCard(renderer, content);
+        const f32 value = 0.5f + 0.5f * std::sin(m_time.get() * 1.7f + m_seed);
+        const f32 h = std::max(content.height * 0.2f, 4.0f);
+        const Rect track = {content.x, content.y + (content.height - h) * 0.5f, content.width, h};
+        renderer.drawRoundedRect(track, h * 0.5f, {1.0f, 1.0f, 1.0f, 0.15f});
+
+        Material fill;
+        fill.color = {0.3f, 0.6f, 1.0f, 1.0f};
+        fill.gradient = true;
+        fill.gradientEnd = {0.6f, 0.3f, 1.0f, 1.0f};
+        fill.gradientDirection = {1, 0};
+        fill.cornerRadius = h * 0.5f;
+        fill.size = {std::max(track.width * value, h), h};
+        renderer.drawQuad({track.x, track.y, fill.size.x, h}, fill);
+        renderer.drawCircle({track.x + fill.size.x - h * 0.5f, track.y + h * 0.5f}, h * 0.7f, {1, 1, 1, 1});
+    }
+};
+
+class DesktopWidgetsScene : public Scene {
+public:
+    const char* name() const override { return "desktop_widgets"; }
+
+    ~DesktopWidgetsScene() override {
+        m_widgets.clear();
+        m_root.reset();
+    }
+
+    void setup(const SceneConfig& config) override {
+        m_count = scaled(384, config.scale);
+        const Grid grid(m_count, (f32)config.width, (f32)config.height);
+
+        m_root = std::make_unique<Widget>();
+        m_root->setGeometry({0, 0, (f32)config.width, (f32)config.height});
+        m_widgets.reserve(m_count);
+        for (u32 i = 0; i < m_count; ++i) {
+            Unique<CardWidget> widget;
+            switch (i % 3) {
+                case 0: widget = std::make_unique<ClockWidget>(i); break;
+                case 1: widget = std::make_unique<GraphWidget>(i); break;
+                default: widget = std::make_unique<MeterWidget>(i); break;
+            }
+            widget->setParent(m_root.get());
+            widget->setGeometry(grid.cell(i, 4.0f));
+            m_widgets.push_back(std::move(widget));
+        }
+    }
+
+    void update(u64 frame, f32 deltaTime) override {
+        m_time += deltaTime;
+        for (auto& widget : m_widgets) {
+            widget->setTime(m_time);
+        }
+    }
+
+    void render(Renderer& renderer) override {
+        renderer.clear({0.2f, 0.25f, 0.32f, 1.0f});
+        for (Object* child : m_root->children()) {
+            static_cast<Widget*>(child)->paint(renderer);
+        }
+    }
+
+    u32 elementCount() const override { return m_count; }
+
+private:
+    u32 m_count = 0;
+    f32 m_time = 0.0f;
+    Unique<Widget> m_root;
+    std::vector<Unique<CardWidget>> m_widgets;
+};
+
+template<typename T>
+Unique<Scene> make() {
+    return std::make_unique<T>();
+}
+
+struct Registration {
+    const char* name;
+    Unique<Scene> (*create)();
+};
+
+const Registration s_scenes[] = {
+    {"hello_window", make<HelloWindowScene>},
+    {"animated_button", make<AnimatedButtonScene>},
+    {"dock", make<DockScene>},
+    {"panel", make<PanelScene>},
+    {"desktop_widgets", make<DesktopWidgetsScene>},
+};
+
+} // namespace
+
+const std::vector<std::string>& sceneNames() {
+    static const std::vector<std::string> names = [] {
+        std::vector<std::string> result;
+        for (const Registration& scene : s_scenes) {
+            result.push_back(scene.name);
+        }
+        return result;
+    }();
+    return names;
+}
+
+Unique<Scene> createScene(const std::string& name) {
+    for (const Registration& scene : s_scenes) {
+        if (name == scene.name) {
+            return scene.create();
+        }
+    }
+    return nullptr;
+}
+
+} // namespace Bench
+} // namespace Aurora
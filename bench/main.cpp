@@ -0,0 +1,679 @@
+// ============================================
+// bench/main.cpp
+// ============================================
+// Runs scripted scenes for a fixed number of frames on the headless
+// platform and prints one JSON document, so runs can be diffed across
+// commits:
+//
+//     aurora_bench [--scene NAME|all] [--frames N] [--warmup N]
+//                  [--scale S] [--size WxH] [--shaders DIR] [--output FILE]
+//                  [--backend gl|software] [--threads N] [--compare]
+//     aurora_bench --micro NAME[,NAME...]|all|list [--output FILE]
+//     aurora_bench --contexts N [--shaders DIR] [--output FILE]
+//
+// --compare renders every scene on both backends and reports how far the
+// software rasterizer's final frame is from the GL one, and exits 1 when any
+// channel is off by more than Difference::kTolerance. --micro runs the
+// CPU micro-benchmarks in Micro.cpp instead of scenes. --contexts opens N
+// GL contexts with and without object sharing and reports what preparing
+// the material shaders and a render target costs in each.
+#include "Micro.hpp"
+#include "Scene.hpp"
+#include <aurora/core/FrameStats.hpp>
+#include <aurora/graphics/Material.hpp>
+#include <aurora/graphics/RenderTarget.hpp>
+#include <aurora/graphics/SoftwareRenderer.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <unistd.h>
+
+#ifndef AURORA_BENCH_SHADER_DIR
+#define AURORA_BENCH_SHADER_DIR "shaders"
+#endif
+
+// ----------------------------------------------------------------------
+// Heap accounting: every allocation in the process goes through here
+
+namespace {
+
+std::atomic<Aurora::u64> s_allocations{0};
+std::atomic<Aurora::u64> s_allocatedBytes{0};
+
+void* countedAlloc(std::size_t size) {
+    s_allocations.fetch_add(1, std::memory_order_relaxed);
+    s_allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size ? size : 1)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+} // namespace
+
+void* operator new(std::size_t size) { return countedAlloc(size); }
+void* operator new[](std::size_t size) { return countedAlloc(size); }
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+namespace Aurora {
+namespace Bench {
+
+namespace {
+
+struct Options {
+    std::string scene = "all";
+    u64 frames = 300;
+    u64 warmup = 30;
+    f32 scale = 1.0f;
+    u32 width = 1280;
+    u32 height = 800;
+    std::string shaders = AURORA_BENCH_SHADER_DIR;
+    std::string output;
+    bool software = false;
+    u32 threads = 0;            // Software rasterizer threads (0 = one per core)
+    bool compare = false;
+    std::string micro;          // Micro-benchmarks to run instead of scenes
+    u32 contexts = 0;           // Context sharing comparison instead of scenes
+};
+
+// Totals over the measured frames
+struct Counters {
+    u64 drawCalls = 0;
+    u64 triangles = 0;
+    u64 stateChanges = 0;
+    u64 bytesUploaded = 0;
+    u64 allocations = 0;
+    u64 allocatedBytes = 0;
+    f64 gpuTime = 0.0;
+    u64 pixelsFilled = 0;       // Software backend only
+    u64 tiles = 0;
+    f64 rasterTime = 0.0;
+};
+
+// Channel differences between two frames of the same size, alpha ignored:
+// GL blending writes alpha differently from the premultiplied CPU path
+struct Difference {
+    u32 maxDiff = 0;
+    f64 meanDiff = 0.0;
+    f64 mismatched = 0.0;       // Fraction of pixels off by more than kTolerance
+
+    static constexpr u32 kTolerance = 8;
+};
+
+Difference compareFrames(const std::vector<u8>& a, const std::vector<u8>& b) {
+    Difference diff;
+    if (a.size() != b.size() || a.empty()) {
+        diff.maxDiff = 255;
+        diff.meanDiff = 255.0;
+        diff.mismatched = 1.0;
+        return diff;
+    }
+    u64 sum = 0, mismatched = 0;
+    for (size_t i = 0; i < a.size(); i += 4) {
+        u32 worst = 0;
+        for (size_t c = 0; c < 3; ++c) {
+            const u32 d = (u32)std::abs((int)a[i + c] - (int)b[i + c]);
+            sum += d;
+            worst = std::max(worst, d);
+        }
+        diff.maxDiff = std::max(diff.maxDiff, worst);
+        mismatched += worst > Difference::kTolerance;
+    }
+    const f64 pixels = (f64)(a.size() / 4);
+    diff.meanDiff = (f64)sum / (pixels * 3.0);
+    diff.mismatched = (f64)mismatched / pixels;
+    return diff;
+}
+
+void printUsage(std::ostream& out) {
+    out << "usage: aurora_bench [--scene NAME|all] [--frames N] [--warmup N]\n"
+           "                    [--scale S] [--size WxH] [--shaders DIR] [--output FILE]\n"
+           "                    [--backend gl|software] [--threads N] [--compare]\n"
+           "       aurora_bench --micro NAME[,NAME...]|all|list [--output FILE]\n"
+           "       aurora_bench --contexts N [--shaders DIR] [--output FILE]\n"
+           "       aurora_bench --list\n";
+}
+
+bool parseOptions(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+        if (arg == "--help" || arg == "-h") {
+            printUsage(std::cout);
+            std::exit(0);
+        }
+        if (arg == "--list") {
+            for (const std::string& name : sceneNames()) {
+                std::cout << name << "\n";
+            }
+            std::exit(0);
+        }
+        if (arg == "--compare") {
+            options.compare = true;
+            continue;
+        }
+        if (!value) {
+            std::cerr << "[Bench] Missing value for " << arg << std::endl;
+            printUsage(std::cerr);
+            return false;
+        }
+        ++i;
+        if (arg == "--scene") {
+            options.scene = value;
+        } else if (arg == "--frames") {
+            options.frames = std::max<u64>(1, std::strtoull(value, nullptr, 10));
+        } else if (arg == "--warmup") {
+            options.warmup = std::strtoull(value, nullptr, 10);
+        } else if (arg == "--scale") {
+            options.scale = std::max(0.0f, std::strtof(value, nullptr));
+        } else if (arg == "--size") {
+            if (std::sscanf(value, "%ux%u", &options.width, &options.height) != 2) {
+                std::cerr << "[Bench] Bad size " << value << std::endl;
+                return false;
+            }
+        } else if (arg == "--shaders") {
+            options.shaders = value;
+        } else if (arg == "--output") {
+            options.output = value;
+        } else if (arg == "--backend") {
+            options.software = std::strcmp(value, "software") == 0;
+            if (!options.software && std::strcmp(value, "gl") != 0) {
+                std::cerr << "[Bench] Unknown backend " << value << std::endl;
+                return false;
+            }
+        } else if (arg == "--micro") {
+            options.micro = value;
+        } else if (arg == "--contexts") {
+            options.contexts = (u32)std::strtoul(value, nullptr, 10);
+        } else if (arg == "--threads") {
+            options.threads = (u32)std::strtoul(value, nullptr, 10);
+        } else {
+            std::cerr << "[Bench] Unknown option " << arg << std::endl;
+            printUsage(std::cerr);
+            return false;
+        }
+    }
+    return true;
+}
+
+// FNV-1a over the final frame, so output changes show up next to timings
+u64 checksum(const std::vector<u8>& pixels) {
+    u64 hash = 0xcbf29ce484222325ull;
+    for (u8 byte : pixels) {
+        hash = (hash ^ byte) * 0x100000001b3ull;
+    }
+    return hash;
+}
+
+std::vector<std::string> splitList(const std::string& value, const std::vector<std::string>& all) {
+    if (value == "all") {
+        return all;
+    }
+    std::vector<std::string> names;
+    std::stringstream list(value);
+    for (std::string name; std::getline(list, name, ',');) {
+        names.push_back(name);
+    }
+    return names;
+}
+
+bool writeOutput(const Options& options, const std::string& json) {
+    if (options.output.empty()) {
+        std::cout << json;
+        return true;
+    }
+    std::ofstream file(options.output);
+    file << json;
+    if (!file) {
+        std::cerr << "[Bench] Failed to write " << options.output << std::endl;
+        return false;
+    }
+    return true;
+}
+
+int runMicro(const Options& options) {
+    if (options.micro == "list") {
+        for (const std::string& name : microNames()) {
+            std::cout << name << "\n";
+        }
+        return 0;
+    }
+
+    bool ok = true;
+    std::ostringstream json;
+    json << "{\"micro\":[";
+    const std::vector<std::string> names = splitList(options.micro, microNames());
+    for (size_t i = 0; i < names.size(); ++i) {
+        json << (i ? "," : "");
+        MicroBenchmark run = findMicro(names[i]);
+        if (!run) {
+            std::cerr << "[Bench] Unknown micro-benchmark " << names[i] << std::endl;
+            json << "null";
+            ok = false;
+            continue;
+        }
+        MicroResult result;
+        run(result);
+
+        std::cerr << "[Bench] " << names[i] << ":";
+        json << "{\"name\":\"" << names[i] << "\"";
+        for (size_t m = 0; m < result.metrics.size(); ++m) {
+            const auto& [metric, value] = result.metrics[m];
+            std::cerr << (m ? ", " : " ") << metric << " " << value;
+            json << ",\"" << metric << "\":" << value;
+        }
+        std::cerr << std::endl;
+        json << "}";
+    }
+    json << "]}\n";
+    return writeOutput(options, json.str()) && ok ? 0 : 1;
+}
+
+// Resident set size in bytes
+u64 residentBytes() {
+    std::ifstream statm("/proc/self/statm");
+    u64 size = 0, resident = 0;
+    statm >> size >> resident;
+    return resident * (u64)sysconf(_SC_PAGESIZE);
+}
+
+struct ContextCost {
+    u32 programs = 0;
+    f64 seconds = 0.0;
+    u64 residentBytes = 0;      // Growth while the contexts were open
+    bool ok = false;
+
+    std::string toJson() const {
+        char buffer[128];
+        std::snprintf(buffer, sizeof(buffer), "{\"programs\":%u,\"seconds\":%.6f,\"residentBytes\":%llu}",
+                      programs, seconds, (unsigned long long)residentBytes);
+        return buffer;
+    }
+};
+
+// Opens count windows with a context each and, in every one, gets each
+// material variant and binds a render target: what a multi-window app
+// does before its first frame. With sharing the variants compile once
+// and later contexts only create their framebuffer; without it every
+// context compiles its own copies.
+ContextCost runContexts(const Options& options, u32 count, bool share) {
+    ContextCost cost;
+    HeadlessPlatform::Config platformConfig;
+    platformConfig.shareContexts = share;
+    HeadlessPlatform platform(platformConfig);
+    if (!platform.initialize() || !platform.hasGL()) {
+        std::cerr << "[Bench] Headless GL is unavailable (built without EGL?)" << std::endl;
+        return cost;
+    }
+
+    std::vector<u32> features;
+    for (u32 mask = 0; mask < 1u << Material::kBlurShift; ++mask) {
+        features.push_back(mask);
+    }
+    for (u32 tier = 1; tier <= 3; ++tier) {
+        features.push_back(Material::Textured | tier << Material::kBlurShift);
+    }
+
+    struct Slot {
+        Handle<Window> window;
+        void* context = nullptr;
+        Ref<ShaderVariants> variants;
+        Ref<RenderTarget> target;
+    };
+    std::vector<Slot> slots(count);
+    Window::Config windowConfig;
+    windowConfig.width = 64;
+    windowConfig.height = 64;
+
+    const u64 residentBefore = residentBytes();
+    const auto start = std::chrono::steady_clock::now();
+    bool ok = true;
+    for (Slot& slot : slots) {
+        slot.window = platform.createWindow(windowConfig);
+        slot.context = platform.createGLContext(slot.window.get());
+        if (!slot.context) {
+            std::cerr << "[Bench] Failed to create a GL context" << std::endl;
+            ok = false;
+            break;
+        }
+        platform.makeCurrent(slot.window.get(), slot.context);
+        if (!share || &slot == &slots[0]) {
+            slot.variants = ShaderVariants::fromFiles(options.shaders + "/basic.vert",
+                                                      options.shaders + "/basic.frag");
+            slot.target = std::make_shared<RenderTarget>(256, 256);
+        } else {
+            slot.variants = slots[0].variants;
+            slot.target = slots[0].target;
+        }
+        for (u32 mask : features) {
+            ok = ok && slot.variants && slot.variants->get(mask);
+        }
+        slot.target->bind();
+        ok = ok && slot.target->isComplete();
+        slot.target->unbind();
+        glFinish();
+    }
+    cost.seconds = std::chrono::duration<f64>(std::chrono::steady_clock::now() - start).count();
+    const u64 residentAfter = residentBytes();
+    cost.residentBytes = residentAfter > residentBefore ? residentAfter - residentBefore : 0;
+    for (const Slot& slot : slots) {
+        if (slot.variants && (!share || &slot == &slots[0])) {
+            cost.programs += slot.variants->stats().variants;
+        }
+    }
+
+    for (Slot& slot : slots) {
+        if (slot.context) {
+            platform.makeCurrent(slot.window.get(), slot.context);
+            slot.variants.reset();
+            slot.target.reset();
+            platform.destroyGLContext(slot.context);
+        }
+        if (slot.window) {
+            platform.destroyWindow(slot.window.get());
+        }
+    }
+    platform.shutdown();
+    cost.ok = ok;
+    return cost;
+}
+
+int runContexts(const Options& options) {
+    // Driver start-up (compiler initialization, first allocations) is paid
+    // by whichever context comes first; keep it out of both measurements
+    if (!runContexts(options, 1, false).ok) {
+        return 1;
+    }
+    // Shared first: the unshared run may then reuse heap the shared one
+    // released, which understates rather than inflates the difference
+    const ContextCost shared = runContexts(options, options.contexts, true);
+    const ContextCost unshared = runContexts(options, options.contexts, false);
+    if (!shared.ok || !unshared.ok) {
+        return 1;
+    }
+    for (const ContextCost* cost : {&shared, &unshared}) {
+        std::cerr << "[Bench] " << options.contexts << " contexts, "
+                  << (cost == &shared ? "shared" : "unshared") << ": " << cost->programs
+                  << " programs, " << cost->seconds * 1e3 << " ms, resident +"
+                  << cost->residentBytes / (1024.0 * 1024.0) << " MiB" << std::endl;
+    }
+    std::ostringstream json;
+    json << "{\"contexts\":" << options.contexts << ",\"shared\":" << shared.toJson()
+         << ",\"unshared\":" << unshared.toJson() << "}\n";
+    return writeOutput(options, json.str()) ? 0 : 1;
+}
+
+std::string runScene(const std::string& name, const Options& options, bool software,
+                     HeadlessPlatform& platform, Window* window, const Ref<ShaderVariants>& variants,
+                     std::vector<u8>& pixels) {
+    Unique<Scene> scene = createScene(name);
+    if (!scene) {
+        std::cerr << "[Bench] Unknown scene " << name << std::endl;
+        return {};
+    }
+
+    SceneConfig config;
+    config.width = options.width;
+    config.height = options.height;
+    config.scale = options.scale;
+    config.frames = options.warmup + options.frames;
+    scene->attach(&platform, window);
+    scene->setup(config);
+
+    // The software renderer works in window pixels already and has no
+    // GL state to set up
+    SoftwareRenderer* softwareRenderer = nullptr;
+    Unique<Renderer> renderer;
+    if (software) {
+        SoftwareRenderer::Config rasterConfig;
+        rasterConfig.threads = options.threads;
+        auto cpu = std::make_unique<SoftwareRenderer>(rasterConfig);
+        softwareRenderer = cpu.get();
+        renderer = std::move(cpu);
+        renderer->initialize();
+        renderer->setViewport(0, 0, options.width, options.height);
+    } else {
+        renderer = std::make_unique<Renderer>();
+        renderer->setMaterialShaders(variants);
+        renderer->initialize();
+        renderer->setViewport(0, 0, options.width, options.height);
+        f32 projection[16];
+        Renderer::orthoMatrix(projection, 0.0f, (f32)options.width, (f32)options.height, 0.0f);
+        renderer->setProjectionMatrix(projection);
+        f32 view[16];
+        Renderer::scaleMatrix(view, 1.0f, 1.0f);
+        renderer->setViewMatrix(view);
+    }
+
+    // Fixed timestep: animation state is the same on every run
+    const f32 deltaTime = 1.0f / 60.0f;
+    FrameStats stats((u32)options.frames);
+    stats.setRefreshRate(60.0);
+    Counters counters;
+    u64 allocations = 0, allocatedBytes = 0;
+
+    for (u64 frame = 0; frame < config.frames; ++frame) {
+        if (frame == options.warmup) {
+            // Shader variants compiled during warmup stay out of the numbers
+            stats.reset();
+            counters = Counters();
+            if (variants) {
+                variants->resetStats();
+            }
+            allocations = s_allocations.load(std::memory_order_relaxed);
+            allocatedBytes = s_allocatedBytes.load(std::memory_order_relaxed);
+        }
+        stats.beginFrame();
+
+        {
+            FrameStats::PhaseScope phase(stats, FrameStats::Phase::Events);
+            platform.pumpEvents();
+            while (platform.hasEvents()) {
+                scene->event(platform.nextEvent());
+            }
+        }
+        {
+            FrameStats::PhaseScope phase(stats, FrameStats::Phase::Update);
+            scene->update(frame, deltaTime);
+        }
+        {
+            FrameStats::PhaseScope phase(stats, FrameStats::Phase::Render);
+            renderer->resetStats();
+            renderer->beginFrame();
+            renderer->beginPass("scene");
+            scene->render(*renderer);
+            renderer->endPass();
+            renderer->endFrame();
+        }
+        {
+            // Waiting for the GPU keeps each frame's rendering in its own time
+            FrameStats::PhaseScope phase(stats, FrameStats::Phase::Swap);
+            if (softwareRenderer) {
+                platform.presentPixels(window, softwareRenderer->pixels(), softwareRenderer->width(),
+                                       softwareRenderer->height(), softwareRenderer->stride());
+            } else {
+                platform.swapBuffers(window);
+                glFinish();
+            }
+        }
+
+        const Renderer::Stats& frameStats = renderer->stats();
+        counters.drawCalls += frameStats.drawCalls;
+        counters.triangles += frameStats.triangles;
+        counters.stateChanges += frameStats.stateChanges;
+        counters.bytesUploaded += frameStats.bytesUploaded;
+        counters.gpuTime += frameStats.gpuTime;
+        if (softwareRenderer) {
+            const SoftwareRenderer::RasterStats& raster = softwareRenderer->rasterStats();
+            counters.pixelsFilled += raster.pixelsFilled;
+            counters.tiles += raster.tiles;
+            counters.rasterTime += raster.rasterTime;
+        }
+    }
+    stats.beginFrame();
+    counters.allocations = s_allocations.load(std::memory_order_relaxed) - allocations;
+    counters.allocatedBytes = s_allocatedBytes.load(std::memory_order_relaxed) - allocatedBytes;
+
+    platform.readPixels(window, pixels);
+    const u32 threads = softwareRenderer ? softwareRenderer->threadCount() : 0;
+    renderer->shutdown();
+
+    const f64 frames = (f64)options.frames;
+    const FrameStats::Summary summary = stats.summary();
+    const ShaderVariants::Stats shaderStats = variants ? variants->stats() : ShaderVariants::Stats();
+    char raster[256] = "";
+    if (softwareRenderer) {
+        std::snprintf(raster, sizeof(raster),
+                      ",\"raster\":{\"threads\":%u,\"tiles\":%.1f,\"pixelsFilled\":%.1f,"
+                      "\"rasterMs\":%.3f,\"megapixelsPerSecond\":%.1f}",
+                      threads, counters.tiles / frames, counters.pixelsFilled / frames,
+                      counters.rasterTime * 1e3 / frames,
+                      counters.rasterTime > 0.0 ? counters.pixelsFilled / counters.rasterTime * 1e-6 : 0.0);
+    }
+    char buffer[1536];
+    std::snprintf(buffer, sizeof(buffer),
+                  "{\"scene\":\"%s\",\"backend\":\"%s\",\"elements\":%u,\"timing\":%s,"
+                  "\"perFrame\":{\"drawCalls\":%.1f,\"triangles\":%.1f,\"stateChanges\":%.1f,"
+                  "\"bytesUploaded\":%.1f,\"allocations\":%.2f,\"allocatedBytes\":%.1f,\"gpuMs\":%.3f},"
+                  "\"shaderVariants\":{\"compiled\":%u,\"hitRate\":%.4f}%s,"
+                  "\"checksum\":\"%016llx\"}",
+                  name.c_str(), software ? "software" : "gl", scene->elementCount(), stats.toJson().c_str(),
+                  counters.drawCalls / frames, counters.triangles / frames, counters.stateChanges / frames,
+                  counters.bytesUploaded / frames, counters.allocations / frames,
+                  counters.allocatedBytes / frames, counters.gpuTime * 1e3 / frames,
+                  shaderStats.variants, shaderStats.hitRate(), raster, (unsigned long long)checksum(pixels));
+
+    std::cerr << "[Bench] " << name << " (" << (software ? "software" : "gl") << "): "
+              << scene->elementCount() << " elements, p50 " << summary.p50 * 1e3 << " ms, p99 "
+              << summary.p99 * 1e3 << " ms, " << counters.drawCalls / frames << " draws/frame";
+    if (softwareRenderer && counters.rasterTime > 0.0) {
+        std::cerr << ", " << counters.pixelsFilled / counters.rasterTime * 1e-6 << " Mpx/s";
+    }
+    std::cerr << std::endl;
+    return buffer;
+}
+
+} // namespace
+
+int run(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        return 2;
+    }
+    if (!options.micro.empty()) {
+        return runMicro(options);
+    }
+    if (options.contexts) {
+        return runContexts(options);
+    }
+
+    const bool useGL = !options.software || options.compare;
+    HeadlessPlatform::Config platformConfig;
+    platformConfig.displayWidth = options.width;
+    platformConfig.displayHeight = options.height;
+    platformConfig.gl = useGL;
+    HeadlessPlatform platform(platformConfig);
+    if (!platform.initialize() || (useGL && !platform.hasGL())) {
+        std::cerr << "[Bench] Headless GL is unavailable (built without EGL?); "
+                  << "--backend software runs without it" << std::endl;
+        return 1;
+    }
+
+    Window::Config windowConfig;
+    windowConfig.title = "aurora_bench";
+    windowConfig.width = options.width;
+    windowConfig.height = options.height;
+    Handle<Window> window = platform.createWindow(windowConfig);
+
+    void* context = nullptr;
+    Ref<ShaderVariants> variants;
+    if (useGL) {
+        context = platform.createGLContext(window.get());
+        if (!context) {
+            std::cerr << "[Bench] Failed to create a GL context" << std::endl;
+            return 1;
+        }
+        platform.makeCurrent(window.get(), context);
+
+        // Shared by all scenes, so later scenes reuse earlier compiles
+        variants = ShaderVariants::fromFiles(options.shaders + "/basic.vert",
+                                             options.shaders + "/basic.frag");
+        if (!variants) {
+            return 1;
+        }
+    }
+
+    const std::vector<std::string> scenes = splitList(options.scene, sceneNames());
+
+    std::ostringstream json;
+    json << "{\"frames\":" << options.frames << ",\"warmup\":" << options.warmup
+         << ",\"scale\":" << options.scale << ",\"width\":" << options.width
+         << ",\"height\":" << options.height << ",\"renderer\":\""
+         << (useGL ? reinterpret_cast<const char*>(glGetString(GL_RENDERER)) : "software")
+         << "\",\"results\":[";
+    bool ok = true;
+    std::vector<u8> pixels, reference;
+    for (size_t i = 0; i < scenes.size(); ++i) {
+        json << (i ? "," : "");
+        if (!options.compare) {
+            std::string result = runScene(scenes[i], options, options.software, platform, window.get(),
+                                          variants, pixels);
+            ok = ok && !result.empty();
+            json << (result.empty() ? "null" : result);
+            continue;
+        }
+
+        std::string gl = runScene(scenes[i], options, false, platform, window.get(), variants, reference);
+        std::string cpu = runScene(scenes[i], options, true, platform, window.get(), variants, pixels);
+        if (gl.empty() || cpu.empty()) {
+            ok = false;
+            json << "null";
+            continue;
+        }
+        const Difference diff = compareFrames(reference, pixels);
+        std::cerr << "[Bench] " << scenes[i] << ": max diff " << diff.maxDiff << ", mean "
+                  << diff.meanDiff << ", " << diff.mismatched * 100.0 << "% of pixels off by more than "
+                  << Difference::kTolerance << std::endl;
+        if (diff.maxDiff > Difference::kTolerance || diff.mismatched > 0.0) {
+            std::cerr << "[Bench] " << scenes[i] << ": software output drifted past the tolerance"
+                      << std::endl;
+            ok = false;
+        }
+        char buffer[256];
+        std::snprintf(buffer, sizeof(buffer),
+                      "\"difference\":{\"maxDiff\":%u,\"meanDiff\":%.4f,\"mismatched\":%.6f,\"tolerance\":%u}",
+                      diff.maxDiff, diff.meanDiff, diff.mismatched, Difference::kTolerance);
+        json << "{\"scene\":\"" << scenes[i] << "\",\"gl\":" << gl << ",\"software\":" << cpu
+             << "," << buffer << "}";
+    }
+    json << "]}\n";
+
+    variants.reset();
+    if (context) {
+        platform.destroyGLContext(context);
+    }
+    platform.destroyWindow(window.get());
+    platform.shutdown();
+
+    if (!writeOutput(options, json.str())) {
+        return 1;
+    }
+    return ok ? 0 : 1;
+}
+
+} // namespace Bench
+} // namespace Aurora
+
+int main(int argc, char** argv) {
+    return Aurora::Bench::run(argc, argv);
+}
@@ -24,17 +24,22 @@ int main(int argc, char** argv) {
     
     // Create OpenGL context
     void* glContext = app.platform()->createGLContext(window.get());
+    if (!glContext) {
+        std::cerr << "Failed to create an OpenGL context" << std::endl;
+        return 1;
+    }
+    app.platform()->makeCurrent(window.get(), glContext);
     
     // Setup window callbacks
-    window->onClose = [&app]() {
+    window->onClose.connect([&app]() {
         std::cout << "Window closed!" << std::endl;
         app.quit();
-    };
+    });
     
-    window->onResize = [](u32 width, u32 height) {
+    window->onResize.connect([](u32 width, u32 height) {
         std::cout << "Window resized: " << width << "x" << height << std::endl;
         glViewport(0, 0, width, height);
-    };
+    });
     
     // Animation variables
     f32 hue = 0.0f;
@@ -72,7 +77,7 @@ int main(int argc, char** argv) {
         glEnd();
         
         // Swap buffers
-        app.platform()->swapBuffers(window.get());
+        app.swapBuffers(window.get());
         
         // Print FPS every second
         static f64 fpsTimer = 0;
@@ -87,5 +92,7 @@ int main(int argc, char** argv) {
     window->show();
     
     // Run application
-    return app.run();
+    int result = app.run();
+    app.platform()->destroyGLContext(glContext);
+    return result;
 }
\ No newline at end of file
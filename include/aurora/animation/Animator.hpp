@@ -0,0 +1,99 @@
+// ============================================
+// include/aurora/animation/Animator.hpp
+// ============================================
+#pragma once
+#include "../core/Object.hpp"
+#include "../core/Types.hpp"
+#include "Easing.hpp"
+#include "Tween.hpp"
+#include <array>
+#include <vector>
+
+namespace Aurora {
+
+// Batch tween runner.
+//
+// Tweens are stored structure-of-arrays, bucketed by value type and easing
+// curve, so a tick is a handful of tight loops: advance time, evaluate one
+// curve over a whole bucket, then write every component to its target.
+// Vec2 and Color tweens are stored as 2 and 4 float lanes.
+class Animator : public Object {
+public:
+    Animator();
+    ~Animator();
+
+    // Start a tween; the target is written on every update until it ends.
+    // A tween without a target is rejected with id 0
+    TweenId start(const Tween<f32>& tween);
+    TweenId start(const Tween<Vec2>& tween);
+    TweenId start(const Tween<Color>& tween);
+
+    // Stop a tween, leaving its target at the current value
+    void cancel(TweenId id);
+
+    // Jump a tween to its end value and fire its completion callback
+    void finish(TweenId id);
+
+    bool isActive(TweenId id) const;
+
+    // Drop every tween without completing it; pending callbacks are dropped too
+    void clear();
+
+    // Advance all tweens
+    void update(f32 deltaTime);
+
+    // Stats
+    u32 activeCount() const { return m_activeCount; }
+
+private:
+    static constexpr size_t kCurveCount = (size_t)Easing::Type::Count;
+
+    template<u32 Lanes>
+    struct Store {
+        std::vector<f32> time;          // Seconds since start (negative during delay)
+        std::vector<f32> invDuration;
+        std::vector<f32> progress;      // Scratch: eased progress
+        std::vector<u32> slots;         // Owning entry in m_slots
+        std::vector<f32> from[Lanes];
+        std::vector<f32> delta[Lanes];
+        std::vector<f32*> target[Lanes];
+
+        size_t size() const { return time.size(); }
+    };
+
+    struct Slot {
+        u32 generation = 1;
+        u32 index = 0;                  // Position in its store
+        u8 lanes = 0;                   // 0 = free
+        Easing::Type easing = Easing::Type::Linear;
+        std::function<void()> onComplete;
+    };
+
+    template<u32 Lanes>
+    TweenId insert(Store<Lanes>& store, Easing::Type easing, f32 duration, f32 delay,
+                   const f32* from, const f32* to, f32* const* targets,
+                   std::function<void()> onComplete);
+
+    template<u32 Lanes>
+    void tick(Store<Lanes>& store, Easing::Type easing, f32 deltaTime);
+
+    template<u32 Lanes>
+    void remove(Store<Lanes>& store, u32 index);
+
+    template<typename F>
+    void withStore(const Slot& slot, F&& fn);
+
+    const Slot* lookup(TweenId id) const;
+    void releaseSlot(u32 slot);
+
+    std::array<Store<1>, kCurveCount> m_floatStores;
+    std::array<Store<2>, kCurveCount> m_vec2Stores;
+    std::array<Store<4>, kCurveCount> m_colorStores;
+
+    std::vector<Slot> m_slots;
+    std::vector<u32> m_freeSlots;
+    std::vector<std::function<void()>> m_completed;
+    u32 m_activeCount = 0;
+};
+
+} // namespace Aurora
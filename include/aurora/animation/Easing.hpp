@@ -5,6 +5,7 @@
 #include "../core/Types.hpp"
 #include <cmath>
 #include <functional>
+#include <vector>
 
 namespace Aurora {
 
@@ -12,6 +13,17 @@ class Easing {
 public:
     using Function = std::function<f32(f32)>;
     
+    // Built-in curves, for dispatch without std::function
+    enum class Type : u8 {
+        Linear,
+        QuadIn, QuadOut, QuadInOut,
+        CubicIn, CubicOut, CubicInOut,
+        ElasticIn, ElasticOut,
+        BounceIn, BounceOut,
+        BackIn, BackOut,
+        Count
+    };
+    
     // Linear
     static f32 linear(f32 t) { return t; }
     
@@ -80,8 +92,93 @@ public:
         return t * t * ((s + 1) * t + s) + 1;
     }
     
+    // Evaluate a built-in curve
+    static f32 evaluate(Type type, f32 t);
+    
+    // Evaluate a built-in curve over an array (in and out may alias)
+    static void evaluate(Type type, const f32* t, f32* out, size_t count);
+    
     // Get easing function by name
     static Function getFunction(const std::string& name);
+    static Type typeFromName(const std::string& name, Type fallback = Type::Linear);
+};
+
+// Easing curve baked into a uniformly spaced table, sampled with linear
+// interpolation. Trades a few KB for per-evaluation pow/sin calls.
+class EasingTable {
+public:
+    static constexpr u32 kDefaultResolution = 256;
+    
+    // Bake any curve over [0, 1] (resolution is clamped to at least 2)
+    EasingTable(const std::function<f32(f32)>& curve, u32 resolution = kDefaultResolution);
+    
+    // Built-in curve
+    static EasingTable bake(Easing::Type type, u32 resolution = kDefaultResolution);
+    
+    // CSS cubic-bezier(x1, y1, x2, y2); x1 and x2 are clamped to [0, 1]
+    static EasingTable cubicBezier(f32 x1, f32 y1, f32 x2, f32 y2,
+                                   u32 resolution = kDefaultResolution);
+    
+    f32 sample(f32 t) const {
+        t = t < 0 ? 0 : (t > 1 ? 1 : t);
+        f32 f = t * m_scale;
+        u32 i = (u32)f;
+        if (i >= m_last) i = m_last - 1;
+        f32 a = m_samples[i];
+        return a + (m_samples[i + 1] - a) * (f - (f32)i);
+    }
+    
+    void sample(const f32* t, f32* out, size_t count) const;
+    
+    u32 resolution() const { return (u32)m_samples.size(); }
+    
+private:
+    EasingTable() = default;
+    void resize(u32 resolution);
+    
+    std::vector<f32> m_samples;
+    f32 m_scale = 1;    // resolution - 1
+    u32 m_last = 1;     // resolution - 1
+};
+
+// Cheap, copyable easing handle: either a built-in curve evaluated
+// analytically or a shared baked table. No std::function indirection.
+class EasingCurve {
+public:
+    EasingCurve(Easing::Type type = Easing::Type::Linear) : m_type(type) {}
+    
+    // Built-in curve through a shared baked table
+    static EasingCurve baked(Easing::Type type,
+                             u32 resolution = EasingTable::kDefaultResolution);
+    
+    // Shared baked cubic-bezier curve
+    static EasingCurve cubicBezier(f32 x1, f32 y1, f32 x2, f32 y2,
+                                   u32 resolution = EasingTable::kDefaultResolution);
+    
+    // Built-in name ("quadOut") or CSS "cubic-bezier(x1, y1, x2, y2)"
+    static EasingCurve fromName(const std::string& name);
+    
+    f32 operator()(f32 t) const {
+        return m_table ? m_table->sample(t) : Easing::evaluate(m_type, t);
+    }
+    
+    void evaluate(const f32* t, f32* out, size_t count) const;
+    
+    bool isBaked() const { return m_table != nullptr; }
+    Easing::Type type() const { return m_type; }
+    const EasingTable* table() const { return m_table; }
+    
+    bool operator==(const EasingCurve& other) const {
+        return m_type == other.m_type && m_table == other.m_table;
+    }
+    bool operator!=(const EasingCurve& other) const { return !(*this == other); }
+    
+private:
+    EasingCurve(Easing::Type type, const EasingTable* table)
+        : m_type(type), m_table(table) {}
+    
+    Easing::Type m_type;
+    const EasingTable* m_table = nullptr;   // Owned by the shared table cache
 };
 
 } // namespace Aurora
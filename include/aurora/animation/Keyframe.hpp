@@ -0,0 +1,213 @@
+// ============================================
+// include/aurora/animation/Keyframe.hpp
+// ============================================
+#pragma once
+#include "../core/Types.hpp"
+#include "Easing.hpp"
+#include "Timeline.hpp"
+#include <algorithm>
+#include <vector>
+
+namespace Aurora {
+
+// Interpolation for keyframe value types
+template<typename T> struct KeyframeLerp;
+
+template<> struct KeyframeLerp<f32> {
+    static f32 apply(f32 a, f32 b, f32 t) { return a + (b - a) * t; }
+};
+
+template<> struct KeyframeLerp<Vec2> {
+    static Vec2 apply(const Vec2& a, const Vec2& b, f32 t) {
+        return {a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t};
+    }
+};
+
+template<> struct KeyframeLerp<Color> {
+    static Color apply(const Color& a, const Color& b, f32 t) {
+        return {a.r + (b.r - a.r) * t, a.g + (b.g - a.g) * t,
+                a.b + (b.b - a.b) * t, a.a + (b.a - a.a) * t};
+    }
+};
+
+// Component-wise; fine for the small rotations typical of UI transitions
+template<> struct KeyframeLerp<Transform2D> {
+    static Transform2D apply(const Transform2D& a, const Transform2D& b, f32 t) {
+        return {a.a + (b.a - a.a) * t, a.b + (b.b - a.b) * t,
+                a.c + (b.c - a.c) * t, a.d + (b.d - a.d) * t,
+                a.tx + (b.tx - a.tx) * t, a.ty + (b.ty - a.ty) * t};
+    }
+};
+
+template<typename T>
+struct Keyframe {
+    f32 time;
+    T value;
+    EasingCurve easing;     // Applies to the segment starting at this key
+};
+
+// Keyframe track compiled into contiguous time/value arrays.
+//
+// sample() keeps a cursor on the last segment used, so forward playback
+// is amortized O(1); large jumps and seek() fall back to binary search.
+template<typename T>
+class KeyframeTrack {
+public:
+    KeyframeTrack() = default;
+    KeyframeTrack(std::initializer_list<Keyframe<T>> keys) : m_keys(keys) {}
+
+    // Editing (the track recompiles lazily on the next sample)
+    void add(f32 time, const T& value, EasingCurve easing = {}) {
+        m_keys.push_back({time, value, easing});
+        m_compiled = false;
+    }
+    void clear() {
+        m_keys.clear();
+        m_compiled = false;
+    }
+
+    // Sort keys and build the sampling arrays
+    void compile() {
+        std::stable_sort(m_keys.begin(), m_keys.end(),
+                         [](const Keyframe<T>& a, const Keyframe<T>& b) { return a.time < b.time; });
+
+        const size_t count = m_keys.size();
+        m_times.resize(count);
+        m_values.resize(count);
+        m_easing.resize(count);
+        m_invSpan.assign(count, 0.0f);
+        for (size_t i = 0; i < count; ++i) {
+            m_times[i] = m_keys[i].time;
+            m_values[i] = m_keys[i].value;
+            m_easing[i] = m_keys[i].easing;
+            if (i > 0) {
+                f32 span = m_times[i] - m_times[i - 1];
+                m_invSpan[i - 1] = span > 0 ? 1.0f / span : 0.0f;
+            }
+        }
+        m_cursor = 0;
+        m_compiled = true;
+    }
+
+    // Sample using and updating the segment cursor
+    T sample(f32 time) {
+        ensureCompiled();
+        if (m_times.empty()) {
+            return T{};
+        }
+        m_cursor = locate(time, m_cursor);
+        return evaluate(m_cursor, time);
+    }
+
+    // Sample without touching the cursor (binary search).
+    // The track must be compiled after its last edit.
+    T sampleAt(f32 time) const {
+        if (!m_compiled || m_times.empty()) {
+            return T{};
+        }
+        return evaluate(search(time), time);
+    }
+
+    // Reposition the cursor for a discontinuous jump
+    void seek(f32 time) {
+        ensureCompiled();
+        if (!m_times.empty()) {
+            m_cursor = search(time);
+        }
+    }
+
+    // Properties
+    size_t size() const { return m_keys.size(); }
+    bool empty() const { return m_keys.empty(); }
+    f32 startTime() const { return m_keys.empty() ? 0.0f : minTime(); }
+    f32 endTime() const { return m_keys.empty() ? 0.0f : maxTime(); }
+    f32 duration() const { return endTime() - startTime(); }
+
+private:
+    static constexpr u32 kMaxLinearSteps = 4;
+
+    void ensureCompiled() {
+        if (!m_compiled) {
+            compile();
+        }
+    }
+
+    f32 minTime() const {
+        return m_compiled ? m_times.front()
+                          : std::min_element(m_keys.begin(), m_keys.end(), byTime)->time;
+    }
+    f32 maxTime() const {
+        return m_compiled ? m_times.back()
+                          : std::max_element(m_keys.begin(), m_keys.end(), byTime)->time;
+    }
+    static bool byTime(const Keyframe<T>& a, const Keyframe<T>& b) { return a.time < b.time; }
+
+    // Index of the last key with time <= t (0 if t precedes every key)
+    u32 search(f32 time) const {
+        auto it = std::upper_bound(m_times.begin(), m_times.end(), time);
+        return it == m_times.begin() ? 0 : (u32)(it - m_times.begin()) - 1;
+    }
+
+    u32 locate(f32 time, u32 cursor) const {
+        const u32 last = (u32)m_times.size() - 1;
+        if (time < m_times[cursor]) {
+            return cursor > 0 && time >= m_times[cursor - 1] ? cursor - 1 : search(time);
+        }
+        for (u32 step = 0; step < kMaxLinearSteps; ++step) {
+            if (cursor == last || time < m_times[cursor + 1]) {
+                return cursor;
+            }
+            ++cursor;
+        }
+        return search(time);
+    }
+
+    T evaluate(u32 index, f32 time) const {
+        const u32 last = (u32)m_times.size() - 1;
+        if (index >= last || time <= m_times[index]) {
+            return time >= m_times[last] ? m_values[last] : m_values[index];
+        }
+        f32 t = (time - m_times[index]) * m_invSpan[index];
+        return KeyframeLerp<T>::apply(m_values[index], m_values[index + 1],
+                                      m_easing[index](t));
+    }
+
+    std::vector<Keyframe<T>> m_keys;
+
+    // Compiled arrays
+    std::vector<f32> m_times;
+    std::vector<T> m_values;
+    std::vector<EasingCurve> m_easing;
+    std::vector<f32> m_invSpan;     // 1 / (t[i+1] - t[i])
+    u32 m_cursor = 0;
+    bool m_compiled = false;
+};
+
+// Animation driving a target through a keyframe track.
+// Key times are in seconds; the animation lasts until the last key.
+//
+// seek() is not overridden: Timeline seeks its children on every update,
+// and those small forward steps are exactly what the track's cursor is
+// for. Backward and distant jumps already fall back to binary search in
+// sample().
+template<typename T>
+class KeyframeAnimation : public Animation {
+public:
+    KeyframeAnimation(T* target, KeyframeTrack<T> track)
+        : Animation(track.endTime()), m_target(target), m_track(std::move(track)) {}
+
+    KeyframeTrack<T>& track() { return m_track; }
+
+protected:
+    void onAnimate(f32 progress) override {
+        if (m_target) {
+            *m_target = m_track.sample(progress * m_duration);
+        }
+    }
+
+private:
+    T* m_target;
+    KeyframeTrack<T> m_track;
+};
+
+} // namespace Aurora
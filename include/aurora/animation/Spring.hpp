@@ -2,8 +2,10 @@
 // include/aurora/animation/Spring.hpp
 // ============================================
 #pragma once
+#include "../core/Object.hpp"
 #include "../core/Types.hpp"
 #include <cmath>
+#include <vector>
 
 namespace Aurora {
 
@@ -11,13 +13,14 @@ class Spring {
 public:
     struct Config {
         f32 stiffness = 100.0f;   // Spring constant (higher = stiffer)
-        f32 damping = 10.0f;       // Damping ratio (higher = less oscillation)
+        f32 damping = 10.0f;       // Damping coefficient c in m*x'' + c*x' + k*x = 0 (not a ratio)
         f32 mass = 1.0f;           // Mass (higher = slower response)
         f32 restLength = 0.0f;     // Rest position
         f32 initialVelocity = 0.0f;
     };
     
-    Spring(const Config& config = {});
+    Spring();
+    Spring(const Config& config);
     
     // Update spring physics
     void update(f32 deltaTime);
@@ -67,4 +70,90 @@ private:
     Spring m_springY;
 };
 
+// Handle to a spring in a SpringSystem (0 = invalid)
+using SpringId = u64;
+
+// Batch spring integrator.
+//
+// Springs are stored contiguously and bucketed by config. Each update
+// advances a bucket with the exact damped-harmonic solution for the frame's
+// delta, computed once per bucket, so long frame hitches cannot destabilize
+// a spring. Springs that come to rest are retired from the update loop until
+// their target, position or velocity changes.
+class SpringSystem : public Object {
+public:
+    SpringSystem();
+    ~SpringSystem();
+
+    // Add a spring; output (optional) receives the position on every update
+    SpringId add(const Spring::Config& config, f32 position, f32 target,
+                 f32* output = nullptr);
+    void remove(SpringId id);
+
+    // Remove every spring; ids handed out before stay invalid
+    void clear();
+
+    // Spring control (wakes resting springs)
+    void setTarget(SpringId id, f32 target);
+    void applyImpulse(SpringId id, f32 force);
+    void reset(SpringId id, f32 position, f32 velocity = 0);
+
+    // Spring state
+    f32 position(SpringId id) const;
+    f32 velocity(SpringId id) const;
+    f32 target(SpringId id) const;
+    bool isAtRest(SpringId id) const;
+    bool contains(SpringId id) const;
+
+    // Advance all moving springs
+    void update(f32 deltaTime);
+
+    // Rest detection threshold for position offset and velocity
+    void setRestThreshold(f32 threshold) { m_restThreshold = threshold; }
+    f32 restThreshold() const { return m_restThreshold; }
+
+    // Stats
+    u32 movingCount() const { return m_movingCount; }
+    u32 restingCount() const { return m_springCount - m_movingCount; }
+
+private:
+    struct Bucket {
+        Spring::Config config;
+        std::vector<f32> position;
+        std::vector<f32> velocity;
+        std::vector<f32> target;
+        std::vector<f32*> output;
+        std::vector<u32> slots;
+
+        size_t size() const { return position.size(); }
+    };
+
+    struct Slot {
+        u32 generation = 1;
+        u32 bucket = 0;
+        u32 index = 0;          // Position in the bucket while moving
+        bool used = false;
+        bool resting = false;
+        // State while resting
+        f32 position = 0;
+        f32 target = 0;
+        f32* output = nullptr;
+    };
+
+    Slot* lookup(SpringId id);
+    const Slot* lookup(SpringId id) const;
+    u32 findBucket(const Spring::Config& config);
+    void releaseSlot(u32 slotIndex);
+    void wake(u32 slotIndex);
+    void retire(Bucket& bucket, u32 index);
+    void removeFromBucket(Bucket& bucket, u32 index);
+
+    std::vector<Bucket> m_buckets;
+    std::vector<Slot> m_slots;
+    std::vector<u32> m_freeSlots;
+    f32 m_restThreshold = 0.001f;
+    u32 m_springCount = 0;
+    u32 m_movingCount = 0;
+};
+
 } // namespace Aurora
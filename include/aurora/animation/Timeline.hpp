@@ -3,6 +3,8 @@
 // ============================================
 #pragma once
 #include "../core/Object.hpp"
+#include "../core/Pool.hpp"
+#include "../core/RefCounted.hpp"
 #include "../core/Types.hpp"
 #include "Easing.hpp"
 #include <functional>
@@ -11,7 +13,8 @@
 
 namespace Aurora {
 
-class Animation {
+// Animations are main-thread only: plain refcount, slab-allocated
+class Animation : public RefCounted<Animation, RefPolicy::Local>, public Pooled<Animation> {
 public:
     enum class State {
         Idle,
@@ -32,6 +35,9 @@ public:
     // Update animation
     virtual void update(f32 deltaTime);
     
+    // Jump to a local time and apply it immediately
+    virtual void seek(f32 time);
+    
     // Properties
     f32 duration() const { return m_duration; }
     f32 currentTime() const { return m_currentTime; }
@@ -85,16 +91,23 @@ private:
     Easing::Function m_easing = Easing::linear;
 };
 
-// Timeline for orchestrating multiple animations
+// Timeline for orchestrating multiple animations.
+//
+// Children are sampled, not played: the timeline seek()s each one to its
+// local time, so a child's own loop, reverse and speed settings do not
+// apply and its state() is left alone. A child's onStart fires when the
+// playhead reaches its start moving forward and onComplete when it
+// reaches its end; onUpdate fires on every sample. Seeking back before
+// the end rearms onComplete, before the start (or stop()) both.
 class Timeline : public Object {
 public:
     Timeline();
     ~Timeline();
     
     // Add animations
-    void add(Ref<Animation> animation, f32 startTime = 0);
-    void addSequential(Ref<Animation> animation); // Add after previous
-    void addParallel(Ref<Animation> animation);   // Add at same time as previous
+    void add(Handle<Animation> animation, f32 startTime = 0);
+    void addSequential(Handle<Animation> animation); // Add after previous
+    void addParallel(Handle<Animation> animation);   // Add at same time as previous
     
     // Timeline control
     void play();
@@ -109,20 +122,39 @@ public:
     f32 duration() const;
     f32 currentTime() const { return m_currentTime; }
     bool isPlaying() const { return m_playing; }
+    size_t animationCount() const { return m_animations.size(); }
+    size_t activeCount() const { return m_active.size(); }
     
     // Callbacks
     std::function<void()> onComplete;
     
 private:
     struct AnimationEntry {
-        Ref<Animation> animation;
+        Handle<Animation> animation;
         f32 startTime;
+        f32 endTime;
+        bool started = false;       // onStart fired
+        bool completed = false;     // onComplete fired
     };
     
+    // Move the playhead, touching only entries whose interval overlaps
+    // the span between the old and new time
+    void advanceTo(f32 time);
+    void rebuildIndex();
+    
     std::vector<AnimationEntry> m_animations;
     f32 m_currentTime = 0;
     f32 m_lastSequentialTime = 0;
     bool m_playing = false;
+    
+    // Interval index: entry indices sorted by start and by end time
+    std::vector<u32> m_byStart;
+    std::vector<f32> m_startTimes;
+    std::vector<u32> m_byEnd;
+    std::vector<f32> m_endTimes;
+    std::vector<u32> m_active;      // Entries containing m_currentTime
+    std::vector<u32> m_touched;     // Scratch for advanceTo
+    bool m_indexDirty = false;
 };
 
 } // namespace Aurora
\ No newline at end of file
@@ -0,0 +1,27 @@
+// ============================================
+// include/aurora/animation/Tween.hpp
+// ============================================
+#pragma once
+#include "../core/Types.hpp"
+#include "Easing.hpp"
+#include <functional>
+
+namespace Aurora {
+
+// Handle to a tween running in an Animator (0 = invalid)
+using TweenId = u64;
+
+// Description of a tween from one value to another.
+// T is f32, Vec2 or Color; the target must outlive the tween.
+template<typename T>
+struct Tween {
+    T* target = nullptr;
+    T from{};
+    T to{};
+    f32 duration = 0.25f;
+    f32 delay = 0.0f;             // Target holds `from` during the delay
+    Easing::Type easing = Easing::Type::QuadOut;
+    std::function<void()> onComplete;
+};
+
+} // namespace Aurora
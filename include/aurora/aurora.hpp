@@ -1 +1,40 @@
 // Main include file for Aurora framework
+#pragma once
+
+// Core
+#include "core/Types.hpp"
+#include "core/Name.hpp"
+#include "core/Object.hpp"
+#include "core/RefCounted.hpp"
+#include "core/Signal.hpp"
+#include "core/Property.hpp"
+#include "core/Timer.hpp"
+#include "core/FrameStats.hpp"
+#include "core/FrameScheduler.hpp"
+#include "core/Profiler.hpp"
+#include "core/Application.hpp"
+
+// Animation
+#include "animation/Easing.hpp"
+#include "animation/Tween.hpp"
+#include "animation/Animator.hpp"
+#include "animation/Spring.hpp"
+#include "animation/Keyframe.hpp"
+#include "animation/Timeline.hpp"
+
+// Graphics
+#include "graphics/Renderer.hpp"
+#include "graphics/SoftwareRenderer.hpp"
+
+// Platform
+#include "platform/IPlatform.hpp"
+#include "platform/Window.hpp"
+#include "platform/Event.hpp"
+
+// UI
+#include "ui/Widget.hpp"
+#include "ui/ScrollArea.hpp"
+#include "ui/FrameStatsOverlay.hpp"
+
+// Utilities
+#include "utils/ResourceManager.hpp"
@@ -2,10 +2,15 @@
 // include/aurora/core/Application.hpp
 // ============================================
 #pragma once
+#include "FrameScheduler.hpp"
+#include "FrameStats.hpp"
 #include "Object.hpp"
+#include "Timer.hpp"
 #include "../platform/IPlatform.hpp"
+#include "../animation/Animator.hpp"
 #include <memory>
 #include <functional>
+#include <string>
 
 namespace Aurora {
 
@@ -16,9 +21,13 @@ public:
         bool vsync = true;
         bool multisampling = true;
         u32 msaaSamples = 4;
+        f64 refreshRate = 60.0;         // For missed-vsync counting; 0 disables
+        bool shaderCache = true;        // Keep linked program binaries on disk
+        std::string shaderCacheDir;     // Default: $XDG_CACHE_HOME/aurora/<name>
     };
     
-    Application(int argc, char** argv, const Config& config = {});
+    Application(int argc, char** argv);
+    Application(int argc, char** argv, const Config& config);
     ~Application();
     
     // Singleton access
@@ -31,31 +40,53 @@ public:
     // Platform access
     IPlatform* platform() const { return m_platform.get(); }
     
+    // Shared tween runner, ticked once per frame before frame callbacks
+    Animator& animator() { return m_animator; }
+    
+    // Main-loop timers; when nothing animates the loop sleeps until the
+    // next one is due
+    TimerWheel& timers() { return m_timers; }
+    
     // Frame callbacks
     void onFrame(std::function<void(f64 deltaTime)> callback);
     
-    // FPS tracking
-    f32 fps() const { return m_fps; }
+    // Per-window rendering paced to each window's own display; see
+    // FrameScheduler. Animations request a frame from every scheduled
+    // window, and the loop sleeps until the next one is due instead of
+    // blocking in a swap
+    FrameScheduler& scheduler() { return m_scheduler; }
+    
+    // Present a window, timed as the Swap phase of the frame
+    void swapBuffers(Window* window);
+    
+    // FPS tracking (smoothed; frameTime() is the raw last delta)
+    f32 fps() const { return (f32)m_frameStats.fps(); }
     f64 frameTime() const { return m_frameTime; }
+    FrameStats& frameStats() { return m_frameStats; }
     
 private:
     void initialize();
     void shutdown();
+    std::string shaderCacheDirectory() const;
     void processEvents();
     void update(f64 deltaTime);
     void render();
+    bool isIdle() const;
     
     static Application* s_instance;
     
     Config m_config;
     Unique<IPlatform> m_platform;
+    Animator m_animator;
+    TimerWheel m_timers;
+    FrameScheduler m_scheduler;
     bool m_running = false;
     int m_exitCode = 0;
     
     // Timing
     f64 m_lastFrameTime = 0;
     f64 m_frameTime = 0;
-    f32 m_fps = 0;
+    FrameStats m_frameStats;
     
     // Callbacks
     std::vector<std::function<void(f64)>> m_frameCallbacks;
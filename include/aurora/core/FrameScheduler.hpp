@@ -0,0 +1,100 @@
+// ============================================
+// include/aurora/core/FrameScheduler.hpp
+// ============================================
+#pragma once
+#include "FrameStats.hpp"
+#include "Timer.hpp"
+#include "Types.hpp"
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Aurora {
+
+class IPlatform;
+class Window;
+
+// Renders each registered window on its own output's refresh cycle, and
+// only when it has damage or is animating. Windows swap with interval 0
+// so presenting one never waits out another's vblank; pacing comes from
+// the output's vblank timing instead (measured by the platform when it
+// can, predicted from the display refresh rate otherwise). A window
+// draws at most once per refresh of the display it is on, so a 144 Hz
+// and a 60 Hz monitor each get their own rate from one thread. Windows
+// the compositor is not ready for (IPlatform::canPresent()) wait for
+// its event instead of a deadline.
+class FrameScheduler {
+public:
+    using DrawCallback = std::function<void(f64 deltaTime)>;
+
+    explicit FrameScheduler(IPlatform* platform = nullptr);
+
+    void setPlatform(IPlatform* platform) { m_platform = platform; }
+
+    // The callback draws the window; the scheduler makes the context
+    // current before and swaps after (context may be null for windows
+    // presented with presentPixels(), which the callback then does)
+    void addWindow(Window* window, void* glContext, DrawCallback draw);
+    void removeWindow(Window* window);
+    bool contains(Window* window) const;
+    bool empty() const { return m_targets.empty(); }
+
+    // Some window is damaged or continuous, so a frame is coming
+    bool busy() const;
+
+    // Draw the window at its next refresh; without a window, every window
+    void requestFrame(Window* window);
+    void requestFrame();
+
+    // Same, reporting only the region (window pixels) as changed; regions
+    // accumulate until the frame is drawn
+    void requestFrame(Window* window, const Rect& region);
+
+    // Continuous windows draw every refresh until turned off
+    void setContinuous(Window* window, bool continuous);
+
+    // Draw every window whose refresh has come; returns how many drew
+    u32 renderDue(u64 now);
+
+    // Earliest time a window needs drawing (kNoDeadline when none does)
+    u64 nextDeadline() const;
+
+    // Per-window frame pacing; null for unknown windows
+    const FrameStats* stats(Window* window) const;
+
+    // {"windows":[{"title","display","refreshRate","measured","stats":{...}}]}
+    std::string toJson() const;
+
+private:
+    static constexpr size_t kMaxDamageRects = 16;
+
+    struct Target {
+        Window* window = nullptr;
+        void* context = nullptr;
+        DrawCallback draw;
+        bool damaged = true;
+        bool fullDamage = true;
+        std::vector<Rect> damage;
+        bool continuous = false;
+        bool measured = false;      // Interval from hardware vblank timing
+        u32 display = 0;
+        u64 interval = 0;           // Refresh interval in nanoseconds
+        u64 nextFrame = 0;          // Earliest start of the next frame
+        u64 lastFrame = 0;
+        FrameStats stats;
+    };
+
+    Target* find(Window* window);
+    const Target* find(Window* window) const;
+
+    // Refresh interval and the next vblank after `now`
+    void updateTiming(Target& target, u64 now);
+    void render(Target& target, u64 now);
+    void eraseRemoved();
+
+    IPlatform* m_platform;
+    std::vector<Unique<Target>> m_targets;
+    bool m_rendering = false;
+};
+
+} // namespace Aurora
@@ -0,0 +1,114 @@
+// ============================================
+// include/aurora/core/FrameStats.hpp
+// ============================================
+#pragma once
+#include "Types.hpp"
+#include <string>
+#include <vector>
+
+namespace Aurora {
+
+// Frame pacing statistics over a fixed window of recent frames:
+// smoothed FPS, frame time percentiles, missed vsync intervals and the
+// time spent in each phase of the main loop.
+class FrameStats {
+public:
+    enum class Phase : u32 {
+        Events,
+        Update,
+        Render,
+        Swap,
+        Count
+    };
+
+    static constexpr u32 kPhaseCount = (u32)Phase::Count;
+
+    // All times in seconds
+    struct Summary {
+        u64 frames = 0;             // Frames recorded since reset
+        u64 missedVsync = 0;        // Refresh intervals skipped since reset
+        f64 fps = 0.0;              // 1 / smoothed frame time
+        f64 mean = 0.0;             // Over the window
+        f64 p50 = 0.0;
+        f64 p95 = 0.0;
+        f64 p99 = 0.0;
+        f64 worst = 0.0;
+        f64 phases[kPhaseCount] = {};   // Mean per frame over the window
+    };
+
+    // Exclusive phase timing: a nested phase pauses the enclosing one
+    class PhaseScope {
+    public:
+        PhaseScope(FrameStats& stats, Phase phase) : m_stats(stats) { m_stats.beginPhase(phase); }
+        ~PhaseScope() { m_stats.endPhase(); }
+
+        PhaseScope(const PhaseScope&) = delete;
+        PhaseScope& operator=(const PhaseScope&) = delete;
+
+    private:
+        FrameStats& m_stats;
+    };
+
+    explicit FrameStats(u32 capacity = 240);
+
+    // Display refresh rate for missed-vsync counting (0 disables it)
+    void setRefreshRate(f64 hz) { m_refreshRate = hz; }
+    f64 refreshRate() const { return m_refreshRate; }
+
+    // Start a frame; the time since the previous start becomes that
+    // frame's duration. The explicit form lets headless runs use a
+    // synthetic clock (nanoseconds).
+    void beginFrame();
+    void beginFrame(u64 now);
+
+    // Forget the open frame, e.g. after the loop slept while idle
+    void resync();
+
+    // Phases take the same clock as beginFrame()
+    void beginPhase(Phase phase);
+    void beginPhase(Phase phase, u64 now);
+    void endPhase();
+    void endPhase(u64 now);
+
+    // Record a finished frame directly
+    void addFrame(f64 frameTime, const f64* phaseTimes = nullptr);
+
+    f64 fps() const { return m_smoothed > 0.0 ? 1.0 / m_smoothed : 0.0; }
+    f64 smoothedFrameTime() const { return m_smoothed; }
+    u64 frameCount() const { return m_frames; }
+    u64 missedVsync() const { return m_missedVsync; }
+
+    // Window contents, newest first (age < size())
+    u32 size() const { return m_count; }
+    u32 capacity() const { return (u32)m_times.size(); }
+    f64 frameTime(u32 age) const;
+
+    Summary summary() const;
+
+    // Summary as a JSON object, for CI jank tracking
+    std::string toJson() const;
+
+    void reset();
+
+private:
+    static constexpr f64 kSmoothing = 0.1;
+    static constexpr u32 kMaxPhaseDepth = 8;
+
+    std::vector<f32> m_times;
+    std::vector<f32> m_phaseTimes;      // capacity x kPhaseCount
+    u32 m_head = 0;                     // Next slot to write
+    u32 m_count = 0;
+    u64 m_frames = 0;
+    u64 m_missedVsync = 0;
+    f64 m_smoothed = 0.0;
+    f64 m_refreshRate = 0.0;
+
+    // Open frame
+    u64 m_frameStart = 0;
+    f64 m_currentPhases[kPhaseCount] = {};
+    Phase m_phaseStack[kMaxPhaseDepth];
+    u32 m_phaseDepth = 0;
+    u64 m_phaseStart = 0;
+};
+
+} // namespace Aurora
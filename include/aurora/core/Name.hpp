@@ -0,0 +1,57 @@
+// ============================================
+// include/aurora/core/Name.hpp
+// ============================================
+#pragma once
+#include "Types.hpp"
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace Aurora {
+
+// Interned string.
+//
+// Every distinct string is stored once in a global table and a Name is
+// just its 4-byte index, so copies, comparisons and hashing are integer
+// operations. Interning takes a lock; keep Names for strings used on hot
+// paths (e.g. static const Name kColor{"uColor"}) instead of converting
+// every call.
+class Name {
+public:
+    constexpr Name() = default;
+    Name(const char* text) : Name(std::string_view(text ? text : "")) {}
+    Name(const std::string& text) : Name(std::string_view(text)) {}
+    explicit Name(std::string_view text);
+
+    // Look up without interning; returns an empty Name if never interned
+    static Name find(std::string_view text);
+
+    // Interned text, null-terminated and stable for the process lifetime
+    std::string_view str() const;
+    const char* c_str() const { return str().data(); }
+
+    u32 id() const { return m_id; }
+    bool empty() const { return m_id == 0; }
+    explicit operator bool() const { return m_id != 0; }
+
+    bool operator==(Name other) const { return m_id == other.m_id; }
+    bool operator!=(Name other) const { return m_id != other.m_id; }
+    bool operator<(Name other) const { return m_id < other.m_id; }
+
+    // Number of distinct strings interned so far
+    static u32 tableSize();
+
+private:
+    u32 m_id = 0;   // 0 is the empty string
+};
+
+} // namespace Aurora
+
+namespace std {
+
+template<>
+struct hash<Aurora::Name> {
+    size_t operator()(Aurora::Name name) const noexcept { return name.id(); }
+};
+
+} // namespace std
@@ -2,39 +2,43 @@
 // include/aurora/core/Object.hpp
 // ============================================
 #pragma once
+#include "Name.hpp"
+#include "RefCounted.hpp"
 #include "Types.hpp"
-#include <atomic>
 #include <vector>
 
 namespace Aurora {
 
-class Object : public std::enable_shared_from_this<Object> {
+// Base for engine objects. Reference counting is intrusive: hold objects
+// in a Handle (see makeHandle) rather than a Ref.
+class Object : public RefCounted<Object> {
 public:
     Object();
     virtual ~Object();
     
-    // Reference counting
-    void retain();
-    void release();
-    u32 retainCount() const { return m_refCount; }
-    
     // Parent-child hierarchy
     void setParent(Object* parent);
     Object* parent() const { return m_parent; }
     const std::vector<Object*>& children() const { return m_children; }
     
-    // Object name for debugging
-    void setName(const std::string& name) { m_name = name; }
-    const std::string& name() const { return m_name; }
+    // Object name for debugging (a no-op with AURORA_STRIP_NAMES)
+#ifndef AURORA_STRIP_NAMES
+    void setName(Name name) { m_name = name; }
+    Name name() const { return m_name; }
+#else
+    template<typename T> void setName(const T&) {}
+    Name name() const { return {}; }
+#endif
     
 protected:
     virtual void onParentChanged(Object* oldParent) {}
     
 private:
-    std::atomic<u32> m_refCount{1};
+#ifndef AURORA_STRIP_NAMES
+    Name m_name;    // Packs next to the reference count
+#endif
     Object* m_parent = nullptr;
     std::vector<Object*> m_children;
-    std::string m_name;
 };
 
 } // namespace Aurora
\ No newline at end of file
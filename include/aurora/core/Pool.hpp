@@ -0,0 +1,105 @@
+// ============================================
+// include/aurora/core/Pool.hpp
+// ============================================
+#pragma once
+#include "Types.hpp"
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace Aurora {
+
+// Fixed-size block allocator.
+//
+// Blocks are carved from 64 KiB slabs and recycled through an intrusive
+// free list, so allocation and deallocation are a few instructions and
+// objects of one kind end up packed together. Not thread-safe.
+class SlabAllocator {
+public:
+    explicit SlabAllocator(size_t blockSize, size_t slabSize = 64 * 1024);
+    ~SlabAllocator();
+
+    SlabAllocator(const SlabAllocator&) = delete;
+    SlabAllocator& operator=(const SlabAllocator&) = delete;
+
+    void* allocate() {
+        if (FreeBlock* block = m_free) {
+            m_free = block->next;
+            ++m_live;
+            return block;
+        }
+        return allocateSlow();
+    }
+
+    void deallocate(void* ptr) {
+        auto* block = static_cast<FreeBlock*>(ptr);
+        block->next = m_free;
+        m_free = block;
+        --m_live;
+    }
+
+    // Stats
+    size_t blockSize() const { return m_blockSize; }
+    size_t liveCount() const { return m_live; }
+    size_t slabCount() const { return m_slabs.size(); }
+
+private:
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    void* allocateSlow();
+
+    size_t m_blockSize;
+    size_t m_slabSize;
+    FreeBlock* m_free = nullptr;
+    char* m_cursor = nullptr;   // Unused tail of the newest slab
+    char* m_end = nullptr;
+    size_t m_live = 0;
+    std::vector<void*> m_slabs;
+};
+
+// Routes a class hierarchy's operator new/delete through slab pools.
+//
+// Each size class (16-byte steps up to kMaxPooledSize) of the hierarchy
+// rooted at T gets its own slab; larger subclasses fall back to the heap.
+// Pooled objects must be created and destroyed on the main thread.
+template<typename T>
+class Pooled {
+public:
+    static constexpr size_t kGranularity = 16;
+    static constexpr size_t kMaxPooledSize = 512;
+
+    static void* operator new(size_t size) {
+        if (SlabAllocator* slab = allocatorFor(size)) {
+            return slab->allocate();
+        }
+        return ::operator new(size);
+    }
+
+    static void operator delete(void* ptr, size_t size) {
+        if (SlabAllocator* slab = allocatorFor(size)) {
+            slab->deallocate(ptr);
+        } else {
+            ::operator delete(ptr);
+        }
+    }
+
+private:
+    static SlabAllocator* allocatorFor(size_t size) {
+        static_assert(alignof(std::max_align_t) <= kGranularity,
+                      "Pool blocks must satisfy fundamental alignment");
+        if (size == 0 || size > kMaxPooledSize) {
+            return nullptr;
+        }
+        // Pools outlive every static so late deletes stay valid
+        static SlabAllocator* s_classes[kMaxPooledSize / kGranularity] = {};
+        SlabAllocator*& slab = s_classes[(size - 1) / kGranularity];
+        if (!slab) {
+            slab = new SlabAllocator(((size - 1) / kGranularity + 1) * kGranularity);
+        }
+        return slab;
+    }
+};
+
+} // namespace Aurora
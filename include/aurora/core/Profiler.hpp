@@ -0,0 +1,119 @@
+// ============================================
+// include/aurora/core/Profiler.hpp
+// ============================================
+#pragma once
+#include "Name.hpp"
+#include "Types.hpp"
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#ifndef AURORA_PROFILING
+#define AURORA_PROFILING 0
+#endif
+
+namespace Aurora {
+
+// Keeps the last few hundred frames of CPU scopes and GPU pass timings in
+// a ring buffer, ready to dump as a Chrome trace (chrome://tracing or
+// ui.perfetto.dev) when a frame drop needs explaining.
+class Profiler {
+public:
+    static constexpr u32 kGpuThread = 0xFFFFFFFF;
+
+    struct Event {
+        Name name;
+        u64 start;          // ns, Profiler::now()
+        u64 duration;       // ns
+        u32 thread;         // kGpuThread for GPU passes
+        u32 depth;
+    };
+
+    struct Frame {
+        u64 index = 0;
+        u64 start = 0;
+        u64 end = 0;
+        u64 gpuTime = 0;    // ns, sum of resolved GPU passes
+        std::vector<Event> events;
+    };
+
+    static Profiler& shared();
+
+    // Recording can be paused at run time; scopes then cost one load
+    void setEnabled(bool enabled) { m_enabled.store(enabled, std::memory_order_relaxed); }
+    bool enabled() const { return m_enabled.load(std::memory_order_relaxed); }
+
+    // Number of frames kept (older ones are overwritten)
+    void setCapacity(u32 frames);
+    u32 capacity() const { return (u32)m_frames.size(); }
+
+    void beginFrame();
+    void endFrame();
+    u64 frameIndex() const { return m_frameIndex; }
+
+    // Completed CPU scope on the calling thread
+    void record(Name name, u64 start, u64 end, u32 depth);
+
+    // GPU pass of an earlier frame, delivered once its query resolves
+    void recordGpu(u64 frameIndex, Name name, u64 start, u64 duration);
+
+    // Frame by index, or null once it has left the ring
+    const Frame* frame(u64 index) const;
+
+    // Chrome trace event JSON covering every frame in the ring
+    std::string chromeTrace() const;
+    bool writeChromeTrace(const std::string& path) const;
+
+    static u64 now();
+    static u32 threadId();
+
+private:
+    Profiler();
+
+    Frame& slot(u64 index) { return m_frames[index % m_frames.size()]; }
+
+    std::atomic<bool> m_enabled{true};
+    mutable std::mutex m_mutex;
+    std::vector<Frame> m_frames;
+    u64 m_frameIndex = 0;
+    u32 m_mainThread = 0;   // Thread driving beginFrame()
+};
+
+// Times the enclosing block; use through AURORA_PROFILE_SCOPE
+class ProfileScope {
+public:
+    explicit ProfileScope(Name name);
+    ~ProfileScope();
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    Name m_name;
+    u64 m_start;
+    u32 m_depth;
+    bool m_active;
+};
+
+} // namespace Aurora
+
+#define AURORA_PROFILE_CONCAT_(a, b) a##b
+#define AURORA_PROFILE_CONCAT(a, b) AURORA_PROFILE_CONCAT_(a, b)
+
+#if AURORA_PROFILING
+// The Name is interned once per call site, not per execution
+#define AURORA_PROFILE_SCOPE_(name, id)                                               \
+    static const ::Aurora::Name AURORA_PROFILE_CONCAT(auroraProfileName_, id)(name); \
+    ::Aurora::ProfileScope AURORA_PROFILE_CONCAT(auroraProfileScope_, id)(           \
+        AURORA_PROFILE_CONCAT(auroraProfileName_, id))
+#define AURORA_PROFILE_SCOPE(name) AURORA_PROFILE_SCOPE_(name, __COUNTER__)
+#define AURORA_PROFILE_FUNCTION() AURORA_PROFILE_SCOPE(__func__)
+#define AURORA_PROFILE_BEGIN_FRAME() ::Aurora::Profiler::shared().beginFrame()
+#define AURORA_PROFILE_END_FRAME() ::Aurora::Profiler::shared().endFrame()
+#else
+#define AURORA_PROFILE_SCOPE(name) ((void)0)
+#define AURORA_PROFILE_FUNCTION() ((void)0)
+#define AURORA_PROFILE_BEGIN_FRAME() ((void)0)
+#define AURORA_PROFILE_END_FRAME() ((void)0)
+#endif
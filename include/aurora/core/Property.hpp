@@ -0,0 +1,220 @@
+// ============================================
+// include/aurora/core/Property.hpp
+// ============================================
+#pragma once
+#include "Types.hpp"
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Aurora {
+
+// Node in the property dependency graph.
+//
+// Changes propagate in two phases: a write marks everything downstream
+// stale (cheap, no evaluation), and a stale bound property recomputes only
+// when it is read and one of its inputs really changed. Properties belong
+// to the main thread.
+class PropertyBase {
+public:
+    PropertyBase(const PropertyBase&) = delete;
+    PropertyBase& operator=(const PropertyBase&) = delete;
+
+    // Bumped whenever the value actually changes
+    u64 version() const { return m_version; }
+
+    // Number of times the binding has been evaluated
+    u64 evaluationCount() const { return m_evaluations; }
+
+    bool isBound() const { return m_bound; }
+
+protected:
+    PropertyBase();
+    virtual ~PropertyBase();
+
+    // Record a read by the binding currently being evaluated
+    void track() const;
+
+    // The stored value changed: invalidate everything downstream
+    void changed();
+
+    // A new binding was set: mark stale and let watchers re-check
+    void rebound();
+
+    // Re-evaluate the binding if an input changed since the last evaluation
+    void refresh();
+
+    // Drop every input edge (the property stops following its binding)
+    void unbind();
+
+    // Run the binding; returns whether the value changed
+    virtual bool evaluate() { return false; }
+
+    // An input may have changed
+    virtual void invalidate();
+
+    bool m_bound = false;
+
+private:
+    friend class PropertyWatcher;
+
+    struct Dependency {
+        PropertyBase* node;
+        u64 version;        // Input version seen at the last evaluation
+    };
+
+    void reevaluate();
+    void unlinkInputs(const std::vector<Dependency>& inputs);
+    void removeDependent(PropertyBase* dependent);
+
+    std::vector<Dependency> m_inputs;
+    mutable std::vector<PropertyBase*> m_dependents;
+    u64 m_version = 0;
+    u64 m_evaluations = 0;
+    bool m_stale = false;
+    bool m_evaluated = false;
+};
+
+namespace detail {
+
+template<typename T, typename = void>
+struct HasEquality : std::false_type {};
+
+template<typename T>
+struct HasEquality<T, std::void_t<decltype(std::declval<const T&>() == std::declval<const T&>())>>
+    : std::true_type {};
+
+// Values without operator== always count as changed
+template<typename T>
+bool propertyEqual(const T& a, const T& b) {
+    if constexpr (HasEquality<T>::value) {
+        return a == b;
+    } else {
+        return false;
+    }
+}
+
+} // namespace detail
+
+// Observable value, optionally bound to an expression over other properties.
+//
+// Reading a property inside a binding records the dependency, so
+//     Property<f32> width{100};
+//     Property<f32> area([&] { return width * height; });
+// recomputes area only when it is read after width or height changed.
+template<typename T>
+class Property : public PropertyBase {
+public:
+    using Binding = std::function<T()>;
+
+    Property() : m_value{} {}
+    Property(const T& value) : m_value(value) {}
+
+    // Bound property
+    template<typename F, typename = std::enable_if_t<
+        std::is_invocable_r_v<T, F&> && !std::is_convertible_v<F, T>>>
+    explicit Property(F&& binding) : m_value{} {
+        bind(Binding(std::forward<F>(binding)));
+    }
+
+    // Current value (recomputed first if stale)
+    const T& get() const {
+        const_cast<Property*>(this)->refresh();
+        track();
+        return m_value;
+    }
+    operator const T&() const { return get(); }
+
+    // Assign a value; removes any binding
+    void set(const T& value) {
+        if (m_bound) {
+            m_binding = nullptr;
+            unbind();
+        } else if (detail::propertyEqual(m_value, value)) {
+            return;
+        }
+        m_value = value;
+        changed();
+    }
+    Property& operator=(const T& value) {
+        set(value);
+        return *this;
+    }
+
+    // Follow an expression; evaluated lazily on the next read
+    void bind(Binding binding) {
+        unbind();
+        m_binding = std::move(binding);
+        m_bound = static_cast<bool>(m_binding);
+        if (m_bound) {
+            rebound();
+        }
+    }
+
+protected:
+    bool evaluate() override {
+        T value = m_binding();
+        if (detail::propertyEqual(m_value, value)) {
+            return false;
+        }
+        m_value = std::move(value);
+        return true;
+    }
+
+private:
+    T m_value;
+    Binding m_binding;
+};
+
+// Read-only bound property
+template<typename T>
+class Computed : public Property<T> {
+public:
+    template<typename F>
+    explicit Computed(F&& binding) : Property<T>(std::forward<F>(binding)) {}
+
+private:
+    using Property<T>::set;
+    using Property<T>::bind;
+    using Property<T>::operator=;
+};
+
+// Runs a callback after properties it watches have changed.
+//
+// Notifications are deferred to the end of the outermost PropertyBatch
+// (or of the write, outside any batch), and fire only if a watched value
+// really changed, so many writes in one frame produce one callback.
+class PropertyWatcher : public PropertyBase {
+public:
+    explicit PropertyWatcher(std::function<void()> callback);
+    ~PropertyWatcher() override;
+
+    void watch(const PropertyBase& property);
+
+protected:
+    void invalidate() override;
+
+private:
+    friend class PropertyBatch;
+
+    void dispatch();
+
+    std::function<void()> m_callback;
+    bool m_queued = false;
+};
+
+// Defers watcher notifications until the outermost batch closes
+class PropertyBatch {
+public:
+    PropertyBatch();
+    ~PropertyBatch();
+
+    PropertyBatch(const PropertyBatch&) = delete;
+    PropertyBatch& operator=(const PropertyBatch&) = delete;
+
+private:
+    static void flush();
+};
+
+} // namespace Aurora
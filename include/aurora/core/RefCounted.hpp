@@ -0,0 +1,127 @@
+// ============================================
+// include/aurora/core/RefCounted.hpp
+// ============================================
+#pragma once
+#include "Types.hpp"
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace Aurora {
+
+enum class RefPolicy {
+    Atomic,     // Handles may be copied and dropped on any thread
+    Local       // Main-thread only; plain increments
+};
+
+namespace detail {
+
+template<RefPolicy Policy> struct RefCount;
+
+template<> struct RefCount<RefPolicy::Atomic> {
+    std::atomic<u32> value{1};
+    void increment() { value.fetch_add(1, std::memory_order_relaxed); }
+    bool decrement() { return value.fetch_sub(1, std::memory_order_acq_rel) == 1; }
+    u32 load() const { return value.load(std::memory_order_relaxed); }
+};
+
+template<> struct RefCount<RefPolicy::Local> {
+    u32 value = 1;
+    void increment() { ++value; }
+    bool decrement() { return --value == 0; }
+    u32 load() const { return value; }
+};
+
+} // namespace detail
+
+// Intrusive reference count.
+//
+// Objects start with one reference owned by whoever called new; a Handle
+// built from the raw pointer adopts it (see makeHandle), and the last
+// release() deletes the object through Derived, which needs a virtual
+// destructor if it is subclassed.
+template<typename Derived, RefPolicy Policy = RefPolicy::Atomic>
+class RefCounted {
+public:
+    void retain() const { m_refCount.increment(); }
+    void release() const {
+        if (m_refCount.decrement()) {
+            delete static_cast<const Derived*>(this);
+        }
+    }
+    u32 retainCount() const { return m_refCount.load(); }
+
+protected:
+    RefCounted() = default;
+    RefCounted(const RefCounted&) {}
+    RefCounted& operator=(const RefCounted&) { return *this; }
+    ~RefCounted() = default;
+
+private:
+    mutable detail::RefCount<Policy> m_refCount;
+};
+
+// Owning pointer to a RefCounted object: one pointer wide, no control block
+template<typename T>
+class Handle {
+public:
+    Handle() = default;
+    Handle(std::nullptr_t) {}
+    // Takes over the reference the caller owns, so Handle<T>(new T) does
+    // not leak; retain() first to share an object already held elsewhere
+    explicit Handle(T* ptr) : m_ptr(ptr) {}
+
+    Handle(const Handle& other) : m_ptr(other.m_ptr) { if (m_ptr) m_ptr->retain(); }
+    Handle(Handle&& other) noexcept : m_ptr(other.m_ptr) { other.m_ptr = nullptr; }
+
+    template<typename U, typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+    Handle(const Handle<U>& other) : m_ptr(other.get()) { if (m_ptr) m_ptr->retain(); }
+
+    template<typename U, typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+    Handle(Handle<U>&& other) noexcept : m_ptr(other.detach()) {}
+
+    ~Handle() { if (m_ptr) m_ptr->release(); }
+
+    Handle& operator=(Handle other) noexcept {
+        std::swap(m_ptr, other.m_ptr);
+        return *this;
+    }
+
+    T* get() const { return m_ptr; }
+    T* operator->() const { return m_ptr; }
+    T& operator*() const { return *m_ptr; }
+    explicit operator bool() const { return m_ptr != nullptr; }
+
+    void reset() { Handle().swap(*this); }
+    void swap(Handle& other) noexcept { std::swap(m_ptr, other.m_ptr); }
+
+    // Give up ownership without releasing
+    T* detach() {
+        T* ptr = m_ptr;
+        m_ptr = nullptr;
+        return ptr;
+    }
+
+    friend bool operator==(const Handle& a, const Handle& b) { return a.m_ptr == b.m_ptr; }
+    friend bool operator!=(const Handle& a, const Handle& b) { return a.m_ptr != b.m_ptr; }
+
+private:
+    T* m_ptr = nullptr;
+};
+
+template<typename T, typename... Args>
+Handle<T> makeHandle(Args&&... args) {
+    return Handle<T>(new T(std::forward<Args>(args)...));
+}
+
+template<typename T, typename U>
+Handle<T> staticHandleCast(const Handle<U>& handle) {
+    T* ptr = static_cast<T*>(handle.get());
+    if (ptr) {
+        ptr->retain();
+    }
+    return Handle<T>(ptr);
+}
+
+} // namespace Aurora
@@ -0,0 +1,405 @@
+// ============================================
+// include/aurora/core/Signal.hpp
+// ============================================
+#pragma once
+#include "Types.hpp"
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Aurora {
+
+// Move-only callable with inline storage. Callables up to Capacity bytes
+// live inside the object; larger ones fall back to the heap.
+template<typename Signature, size_t Capacity = 48>
+class SmallFunction;
+
+template<typename R, typename... Args, size_t Capacity>
+class SmallFunction<R(Args...), Capacity> {
+public:
+    SmallFunction() = default;
+    SmallFunction(std::nullptr_t) {}
+
+    template<typename F, typename = std::enable_if_t<
+        !std::is_same_v<std::decay_t<F>, SmallFunction> &&
+        std::is_invocable_r_v<R, std::decay_t<F>&, Args...>>>
+    SmallFunction(F&& fn) {
+        using Fn = std::decay_t<F>;
+        if constexpr (fitsInline<Fn>()) {
+            new (m_storage) Fn(std::forward<F>(fn));
+        } else {
+            *reinterpret_cast<Fn**>(m_storage) = new Fn(std::forward<F>(fn));
+        }
+        m_ops = &OpsFor<Fn>::ops;
+    }
+
+    SmallFunction(SmallFunction&& other) noexcept { moveFrom(other); }
+
+    SmallFunction& operator=(SmallFunction&& other) noexcept {
+        if (this != &other) {
+            reset();
+            moveFrom(other);
+        }
+        return *this;
+    }
+
+    SmallFunction(const SmallFunction&) = delete;
+    SmallFunction& operator=(const SmallFunction&) = delete;
+
+    ~SmallFunction() { reset(); }
+
+    R operator()(Args... args) const {
+        return m_ops->invoke(m_storage, std::forward<Args>(args)...);
+    }
+
+    explicit operator bool() const { return m_ops != nullptr; }
+    bool isInline() const { return m_ops && m_ops->inlined; }
+
+    void reset() {
+        if (m_ops) {
+            m_ops->destroy(m_storage);
+            m_ops = nullptr;
+        }
+    }
+
+private:
+    struct Ops {
+        R (*invoke)(void* storage, Args&&... args);
+        void (*move)(void* dst, void* src);
+        void (*destroy)(void* storage);
+        bool inlined;
+    };
+
+    template<typename Fn>
+    static constexpr bool fitsInline() {
+        return sizeof(Fn) <= Capacity && alignof(Fn) <= alignof(std::max_align_t) &&
+               std::is_nothrow_move_constructible_v<Fn>;
+    }
+
+    template<typename Fn>
+    struct OpsFor {
+        static Fn* get(void* storage) {
+            if constexpr (fitsInline<Fn>()) {
+                return std::launder(reinterpret_cast<Fn*>(storage));
+            } else {
+                return *reinterpret_cast<Fn**>(storage);
+            }
+        }
+        static R invoke(void* storage, Args&&... args) {
+            return (*get(storage))(std::forward<Args>(args)...);
+        }
+        static void move(void* dst, void* src) {
+            if constexpr (fitsInline<Fn>()) {
+                new (dst) Fn(std::move(*get(src)));
+                get(src)->~Fn();
+            } else {
+                *reinterpret_cast<Fn**>(dst) = get(src);
+            }
+        }
+        static void destroy(void* storage) {
+            if constexpr (fitsInline<Fn>()) {
+                get(storage)->~Fn();
+            } else {
+                delete get(storage);
+            }
+        }
+        static constexpr Ops ops{invoke, move, destroy, fitsInline<Fn>()};
+    };
+
+    void moveFrom(SmallFunction& other) {
+        if (other.m_ops) {
+            other.m_ops->move(m_storage, other.m_storage);
+            m_ops = other.m_ops;
+            other.m_ops = nullptr;
+        }
+    }
+
+    alignas(std::max_align_t) mutable unsigned char m_storage[Capacity];
+    const Ops* m_ops = nullptr;
+};
+
+// Calls posted from any thread and run on the main loop
+class InvokeQueue {
+public:
+    // Queue drained by Application once per frame
+    static InvokeQueue& main();
+
+    void post(std::function<void()> call);
+
+    // Called after every post, e.g. to wake a sleeping main loop. Set it
+    // before other threads start posting.
+    void setWakeHandler(std::function<void()> handler);
+
+    // Run everything posted so far on the calling thread
+    void drain();
+
+    bool empty() const;
+
+private:
+    mutable std::mutex m_mutex;
+    std::vector<std::function<void()>> m_pending;
+    std::function<void()> m_wake;
+};
+
+enum class ConnectionType {
+    Direct,     // Slot runs inside emit()
+    Queued      // Slot runs later on the main loop with copied arguments
+};
+
+namespace detail {
+
+struct ConnectionState {
+    virtual ~ConnectionState() = default;
+    std::atomic<bool> connected{true};
+};
+
+} // namespace detail
+
+// Handle to a signal/slot connection
+class Connection {
+public:
+    Connection() = default;
+
+    // Safe from any thread, including from inside the slot being emitted
+    void disconnect() {
+        if (m_state) m_state->connected.store(false, std::memory_order_release);
+    }
+    bool connected() const {
+        return m_state && m_state->connected.load(std::memory_order_acquire);
+    }
+
+private:
+    template<typename...> friend class Signal;
+
+    explicit Connection(Ref<detail::ConnectionState> state) : m_state(std::move(state)) {}
+
+    Ref<detail::ConnectionState> m_state;
+};
+
+// Disconnects when it goes out of scope
+class ScopedConnection {
+public:
+    ScopedConnection() = default;
+    ScopedConnection(Connection connection) : m_connection(std::move(connection)) {}
+    ScopedConnection(ScopedConnection&&) = default;
+    ScopedConnection& operator=(ScopedConnection&& other) {
+        if (this != &other) {
+            m_connection.disconnect();
+            m_connection = std::move(other.m_connection);
+            other.m_connection = {};
+        }
+        return *this;
+    }
+    ~ScopedConnection() { m_connection.disconnect(); }
+
+    const Connection& connection() const { return m_connection; }
+
+private:
+    Connection m_connection;
+};
+
+// Multi-listener signal.
+//
+// The slot list is copy-on-write: emit() walks an immutable snapshot
+// without taking a lock and without allocating, so slots may connect or
+// disconnect (even themselves) while an emission is in flight. Replaced
+// snapshots are freed once no emission can still be reading them.
+//
+// Emissions on the thread that constructed the signal (normally the main
+// thread) register with a plain depth counter; only emissions from other
+// threads pay for an atomic read-modify-write. Since the depth is visible
+// to the owner alone, only the owner frees replaced snapshots: when it
+// edits the list, or when its outermost emission returns.
+template<typename... Args>
+class Signal {
+public:
+    using Slot = SmallFunction<void(Args...)>;
+
+    Signal() = default;
+    ~Signal() {
+        SlotList* list = m_list.load();
+        if (list) {
+            for (auto& state : list->slots) {
+                state->connected.store(false, std::memory_order_relaxed);
+            }
+        }
+        delete list;
+        for (SlotList* retired : m_retired) {
+            delete retired;
+        }
+    }
+
+    Signal(const Signal&) = delete;
+    Signal& operator=(const Signal&) = delete;
+
+    // Connect a slot
+    template<typename F>
+    Connection connect(F&& fn, ConnectionType type = ConnectionType::Direct) {
+        auto state = std::make_shared<State>(std::forward<F>(fn), type);
+        update([&](std::vector<Ref<State>>& slots) { slots.push_back(state); });
+        return Connection(state);
+    }
+
+    // Disconnect and drop the slot from the list
+    void disconnect(Connection& connection) {
+        connection.disconnect();
+        update([](std::vector<Ref<State>>&) {});
+    }
+
+    void disconnectAll() {
+        update([](std::vector<Ref<State>>& slots) {
+            for (auto& state : slots) {
+                state->connected.store(false, std::memory_order_release);
+            }
+            slots.clear();
+        });
+    }
+
+    // Invoke all connected slots
+    void emit(Args... args) const {
+        // Never-connected signals skip the reader handshake entirely
+        if (!m_list.load(std::memory_order_acquire)) {
+            return;
+        }
+        ReadGuard guard(*this);
+        if (const SlotList* list = guard.list()) {
+            for (const Ref<State>& state : list->slots) {
+                if (!state->connected.load(std::memory_order_acquire)) {
+                    continue;
+                }
+                if (state->type == ConnectionType::Direct) {
+                    state->fn(args...);
+                } else {
+                    InvokeQueue::main().post([state, captured = std::make_tuple(args...)]() {
+                        if (state->connected.load(std::memory_order_acquire)) {
+                            std::apply(state->fn, captured);
+                        }
+                    });
+                }
+            }
+        }
+    }
+
+    void operator()(Args... args) const { emit(args...); }
+
+    size_t slotCount() const {
+        ReadGuard guard(*this);
+        size_t count = 0;
+        if (const SlotList* list = guard.list()) {
+            for (const Ref<State>& state : list->slots) {
+                count += state->connected.load(std::memory_order_relaxed) ? 1 : 0;
+            }
+        }
+        return count;
+    }
+
+    explicit operator bool() const { return slotCount() > 0; }
+
+private:
+    struct State : detail::ConnectionState {
+        template<typename F>
+        State(F&& f, ConnectionType t) : fn(std::forward<F>(f)), type(t) {}
+        Slot fn;
+        ConnectionType type;
+    };
+
+    struct SlotList {
+        std::vector<Ref<State>> slots;
+    };
+
+    // Registers the calling thread as a reader of the current slot list
+    class ReadGuard {
+    public:
+        explicit ReadGuard(const Signal& signal)
+            : m_signal(signal), m_owner(std::this_thread::get_id() == signal.m_owner) {
+            if (m_owner) {
+                ++m_signal.m_ownerDepth;
+            } else {
+                m_signal.m_readers.fetch_add(1);
+            }
+            m_list = m_signal.m_list.load();
+        }
+        ~ReadGuard() {
+            if (!m_owner) {
+                m_signal.m_readers.fetch_sub(1);
+            } else if (--m_signal.m_ownerDepth == 0 &&
+                       m_signal.m_hasRetired.load(std::memory_order_relaxed)) {
+                const_cast<Signal&>(m_signal).reclaim();
+            }
+        }
+        ReadGuard(const ReadGuard&) = delete;
+        ReadGuard& operator=(const ReadGuard&) = delete;
+
+        const SlotList* list() const { return m_list; }
+
+    private:
+        const Signal& m_signal;
+        const SlotList* m_list = nullptr;
+        bool m_owner;
+    };
+
+    // Publish a modified copy of the slot list, pruning dead slots
+    template<typename Edit>
+    void update(Edit&& edit) {
+        std::lock_guard<std::mutex> lock(m_writeMutex);
+        SlotList* old = m_list.load();
+        auto* next = new SlotList;
+        if (old) {
+            next->slots.reserve(old->slots.size() + 1);
+            for (const Ref<State>& state : old->slots) {
+                if (state->connected.load(std::memory_order_acquire)) {
+                    next->slots.push_back(state);
+                }
+            }
+        }
+        edit(next->slots);
+        m_list.store(next);
+
+        if (old) {
+            m_retired.push_back(old);
+            m_hasRetired.store(true);
+        }
+        if (std::this_thread::get_id() == m_owner) {
+            freeRetiredLocked();
+        }
+    }
+
+    // Owner thread only
+    void reclaim() {
+        std::unique_lock<std::mutex> lock(m_writeMutex, std::try_to_lock);
+        if (lock.owns_lock()) {
+            freeRetiredLocked();
+        }
+    }
+
+    // Owner thread only. Other threads register before loading the list,
+    // so once their count is zero, and the owner is not mid-emission, no
+    // reader can still hold a replaced list.
+    void freeRetiredLocked() {
+        if (m_retired.empty() || m_ownerDepth != 0 || m_readers.load() != 0) {
+            return;
+        }
+        for (SlotList* retired : m_retired) {
+            delete retired;
+        }
+        m_retired.clear();
+        m_hasRetired.store(false);
+    }
+
+    std::atomic<SlotList*> m_list{nullptr};
+    const std::thread::id m_owner = std::this_thread::get_id();
+    mutable u32 m_ownerDepth = 0;           // Owner thread emissions in flight
+    mutable std::atomic<u32> m_readers{0};  // Other threads' emissions in flight
+    std::atomic<bool> m_hasRetired{false};
+    std::mutex m_writeMutex;
+    std::vector<SlotList*> m_retired;
+};
+
+} // namespace Aurora
@@ -0,0 +1,101 @@
+// ============================================
+// include/aurora/core/Timer.hpp
+// ============================================
+#pragma once
+#include "Object.hpp"
+#include "Types.hpp"
+#include <functional>
+#include <vector>
+
+namespace Aurora {
+
+using TimerId = u64;
+
+// Hierarchical timing wheel.
+//
+// Four levels of 64 slots, with a tick of 2^20 ns (~1 ms), cover about
+// 4.9 hours; later deadlines park in the last level and cascade again.
+// Timers live in intrusive lists, so schedule and cancel are O(1), and
+// advance() skips empty stretches using per-level occupancy masks.
+//
+// A timer with a tolerance may fire anywhere in [deadline, deadline +
+// tolerance]; it is placed on the most aligned tick in that window so
+// timers with overlapping windows share one wakeup. Timers due on the same
+// tick run in no particular order.
+class TimerWheel : public Object {
+public:
+    using Callback = std::function<void()>;
+
+    static constexpr u64 kNoDeadline = ~0ull;
+
+    TimerWheel();
+    explicit TimerWheel(u64 startTime);
+    ~TimerWheel();
+
+    // Monotonic clock in nanoseconds
+    static u64 clock();
+
+    // Schedule relative to now() (delays in seconds)
+    TimerId schedule(f64 delay, Callback callback, f64 tolerance = 0);
+    TimerId scheduleRepeating(f64 interval, Callback callback, f64 tolerance = 0);
+
+    bool cancel(TimerId id);
+    bool isActive(TimerId id) const;
+    void clear();
+
+    // Run every timer due at or before time; returns the number fired
+    u32 advance(u64 time);
+
+    // Earliest time a timer may need service (kNoDeadline when empty).
+    // Never later than the next expiry; may be earlier at a cascade.
+    u64 nextDeadline() const;
+
+    u64 now() const { return m_now; }
+    u32 activeCount() const { return m_activeCount; }
+
+private:
+    static constexpr u32 kTickShift = 20;
+    static constexpr u32 kLevels = 4;
+    static constexpr u32 kSlotBits = 6;
+    static constexpr u32 kSlots = 1u << kSlotBits;
+    static constexpr u32 kNone = ~0u;
+
+    enum class State : u8 {
+        Free,
+        Scheduled,
+        Firing
+    };
+
+    struct Node {
+        Callback callback;
+        u64 deadline = 0;       // Requested time (ns)
+        u64 interval = 0;       // Repeat period (ns), 0 for one-shot
+        u64 tolerance = 0;
+        u64 tick = 0;           // Tick the timer fires on
+        u32 generation = 1;
+        u32 prev = kNone;
+        u32 next = kNone;
+        u16 bucket = 0;
+        State state = State::Free;
+    };
+
+    TimerId add(u64 delay, u64 interval, u64 tolerance, Callback callback);
+    u64 fireTick(u64 deadline, u64 tolerance) const;
+    void link(u32 index);
+    void unlink(u32 index);
+    void cascade();
+    void release(u32 index);
+    Node* lookup(TimerId id);
+    const Node* lookup(TimerId id) const;
+
+    std::vector<Node> m_nodes;
+    std::vector<u32> m_freeNodes;
+    u32 m_heads[kLevels * kSlots];
+    u64 m_occupied[kLevels] = {};
+    std::vector<u32> m_firing;
+    u64 m_now = 0;
+    u64 m_tick = 0;             // Next tick to process
+    u32 m_activeCount = 0;
+};
+
+} // namespace Aurora
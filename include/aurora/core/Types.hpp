@@ -10,8 +10,12 @@
 namespace Aurora {
 
 // Basic types
+using u8 = uint8_t;
+using u16 = uint16_t;
 using i32 = int32_t;
 using u32 = uint32_t;
+using i64 = int64_t;
+using u64 = uint64_t;
 using f32 = float;
 using f64 = double;
 
@@ -32,6 +36,8 @@ struct Vec2 {
     Vec2 operator+(const Vec2& v) const { return {x + v.x, y + v.y}; }
     Vec2 operator-(const Vec2& v) const { return {x - v.x, y - v.y}; }
     Vec2 operator*(f32 s) const { return {x * s, y * s}; }
+    bool operator==(const Vec2& v) const { return x == v.x && y == v.y; }
+    bool operator!=(const Vec2& v) const { return !(*this == v); }
 };
 
 struct Rect {
@@ -41,6 +47,31 @@ struct Rect {
         return p.x >= x && p.x <= x + width &&
                p.y >= y && p.y <= y + height;
     }
+    
+    bool operator==(const Rect& o) const {
+        return x == o.x && y == o.y && width == o.width && height == o.height;
+    }
+    bool operator!=(const Rect& o) const { return !(*this == o); }
+};
+
+// 2D affine transform (3x2, column-major: x' = a*x + c*y + tx)
+struct Transform2D {
+    f32 a = 1, b = 0;
+    f32 c = 0, d = 1;
+    f32 tx = 0, ty = 0;
+    
+    static Transform2D translation(f32 x, f32 y) { return {1, 0, 0, 1, x, y}; }
+    static Transform2D scale(f32 sx, f32 sy) { return {sx, 0, 0, sy, 0, 0}; }
+    
+    Vec2 apply(const Vec2& p) const {
+        return {a * p.x + c * p.y + tx, b * p.x + d * p.y + ty};
+    }
+    
+    Transform2D operator*(const Transform2D& o) const {
+        return {a * o.a + c * o.b, b * o.a + d * o.b,
+                a * o.c + c * o.d, b * o.c + d * o.d,
+                a * o.tx + c * o.ty + tx, b * o.tx + d * o.ty + ty};
+    }
 };
 
 struct Color {
@@ -57,6 +88,11 @@ struct Color {
             (hex & 0xFF) / 255.0f
         );
     }
+    
+    bool operator==(const Color& o) const {
+        return r == o.r && g == o.g && b == o.b && a == o.a;
+    }
+    bool operator!=(const Color& o) const { return !(*this == o); }
 };
 
 } // namespace Aurora
\ No newline at end of file
@@ -0,0 +1,34 @@
+// ============================================
+// include/aurora/graphics/GLContext.hpp
+// ============================================
+#pragma once
+#include "../core/Types.hpp"
+
+namespace Aurora {
+
+// Identifies the GL context current on this thread. Contexts created by
+// the platform share textures, buffers and programs, but vertex arrays
+// and framebuffers stay per context; objects holding those names key
+// them on current(). Platforms allocate a serial per context and report
+// it from makeCurrent(). Serials are never reused, so a name recorded
+// for a destroyed context is simply never matched again.
+class GLContext {
+public:
+    enum class Object { Framebuffer, VertexArray };
+
+    // 0 until a platform makes a context current on this thread. Making a
+    // context current deletes the names queued for it by deleteObject()
+    static u64 current();
+    static void setCurrent(u64 serial);
+    
+    static u64 allocate();
+    // Platforms call this when destroying a context: its queued names
+    // went with it
+    static void release(u64 serial);
+
+    // Deletes a per-context object now if its context is current,
+    // otherwise the next time that context is made current
+    static void deleteObject(u64 context, Object type, u32 name);
+};
+
+} // namespace Aurora
@@ -0,0 +1,63 @@
+// ============================================
+// include/aurora/graphics/GpuTimer.hpp
+// ============================================
+#pragma once
+#include "../core/Name.hpp"
+#include "../core/Types.hpp"
+#include <vector>
+#include "OpenGL.hpp"
+
+namespace Aurora {
+
+// GL_TIME_ELAPSED queries around render passes. Results are read a few
+// frames later, once the GPU has caught up, so timing never stalls the
+// pipeline; resolved passes go to the Profiler under the frame that
+// issued them. Passes do not nest (a GL restriction on elapsed queries).
+class GpuTimer {
+public:
+    static constexpr u32 kFramesInFlight = 4;
+
+    GpuTimer() = default;
+    ~GpuTimer();
+
+    GpuTimer(const GpuTimer&) = delete;
+    GpuTimer& operator=(const GpuTimer&) = delete;
+
+    // Frame boundaries; beginFrame also collects finished queries
+    void beginFrame();
+    void endFrame();
+
+    // Time a pass; beginning a pass ends the open one
+    void begin(Name pass);
+    void end();
+
+    // GPU time of the newest fully resolved frame, in seconds
+    f64 lastFrameTime() const { return m_lastFrameTime; }
+
+    // Frames whose queries were recycled before they resolved
+    u32 droppedFrames() const { return m_dropped; }
+
+private:
+    struct Pass {
+        Name name;
+        u64 cpuStart;       // Submission time, used to place it in traces
+        GLuint query;
+    };
+
+    struct FrameQueries {
+        u64 profilerFrame = 0;
+        bool pending = false;
+        std::vector<Pass> passes;
+        std::vector<GLuint> queries;    // Owned; reused frame to frame
+    };
+
+    bool resolve(FrameQueries& frame);
+
+    FrameQueries m_frames[kFramesInFlight];
+    u64 m_frame = 0;
+    bool m_open = false;
+    f64 m_lastFrameTime = 0.0;
+    u32 m_dropped = 0;
+};
+
+} // namespace Aurora
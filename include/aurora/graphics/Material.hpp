@@ -0,0 +1,103 @@
+// ============================================
+// include/aurora/graphics/Material.hpp
+// ============================================
+#pragma once
+#include "../core/Types.hpp"
+#include "Shader.hpp"
+#include "Texture.hpp"
+#include "UniformBuffer.hpp"
+#include <string>
+#include <unordered_map>
+
+namespace Aurora {
+
+// Draw parameters for the UI shader. Each feature is a preprocessor
+// define in the shader source, so a draw only pays for what it uses.
+class Material {
+public:
+    enum Feature : u32 {
+        Textured = 1 << 0,
+        Rounded = 1 << 1,
+        Border = 1 << 2,
+        Gradient = 1 << 3,
+    };
+
+    // Bits 4-5 hold the blur tier: off, 5, 9 or 17 taps
+    static constexpr u32 kBlurShift = 4;
+    static constexpr u32 kBlurMask = 3u << kBlurShift;
+    static u32 blurTaps(u32 features);
+
+    Color color = {1, 1, 1, 1};
+    Vec2 size;                      // Quad size in pixels, for corners and borders
+    Texture* texture = nullptr;
+    f32 cornerRadius = 0.0f;
+    f32 borderWidth = 0.0f;
+    Color borderColor = {0, 0, 0, 0};
+    bool gradient = false;
+    Color gradientEnd = {1, 1, 1, 1};
+    Vec2 gradientDirection = {0, 1};
+    f32 blurRadius = 0.0f;          // Pixels; needs a texture
+    Vec2 blurDirection = {1, 0};
+
+    // Cheapest feature set that renders these parameters
+    u32 features() const;
+};
+
+// Variants of one shader source, compiled on first use and cached by
+// feature mask. Each variant keeps its material parameters in its own
+// MaterialUniforms buffer, so a draw sends only the bytes that differ
+// from the last material drawn with that variant.
+class ShaderVariants {
+public:
+    struct Stats {
+        u32 variants = 0;       // Programs compiled
+        u64 requests = 0;
+        u64 hits = 0;           // Requests served from the cache
+        u64 uniformBytes = 0;   // Uniform and uniform buffer data sent by bind()
+
+        f64 hitRate() const { return requests ? (f64)hits / (f64)requests : 0.0; }
+    };
+
+    ShaderVariants(const std::string& vertexSource, const std::string& fragmentSource,
+                   Shader::CompileMode mode = Shader::CompileMode::Immediate);
+
+    // Source with the feature defines inserted after #version
+    static std::string preprocess(const std::string& source, u32 features);
+
+    // Program for a feature mask, compiling it if needed (nullptr on error)
+    Shader* get(u32 features);
+
+    // Select and use the variant for a material, fill in MaterialUniforms
+    // and attach it to UniformBlock::Material
+    Shader* bind(const Material& material);
+
+    void clear();
+    const Stats& stats() const { return m_stats; }
+    void resetStats();
+
+    static Ref<ShaderVariants> fromFiles(const std::string& vertexPath,
+                                         const std::string& fragmentPath,
+                                         Shader::CompileMode mode = Shader::CompileMode::Immediate);
+
+    // Variants of the built-in UI shader (shaders/basic.*)
+    static Ref<ShaderVariants> createBuiltin(Shader::CompileMode mode = Shader::CompileMode::Immediate);
+
+private:
+    struct Variant {
+        Ref<Shader> shader;
+        bool resolved = false;
+        UniformHandle texture;      // Samplers cannot live in the block
+        Unique<UniformBuffer> uniforms;
+    };
+
+    Variant* variant(u32 features);
+    void resolve(Variant& variant);
+
+    std::string m_vertexSource;
+    std::string m_fragmentSource;
+    Shader::CompileMode m_mode;
+    std::unordered_map<u32, Variant> m_variants;
+    Stats m_stats;
+};
+
+} // namespace Aurora
@@ -0,0 +1,17 @@
+// ============================================
+// include/aurora/graphics/OpenGL.hpp
+// ============================================
+#pragma once
+
+// GL entry points. With GLEW they are loaded at runtime by
+// Renderer::initialize; otherwise they are linked directly from libGL,
+// which exports the full core and extension API on Mesa and GLVND.
+#ifdef AURORA_USE_GLEW
+#include <GL/glew.h>
+#else
+#ifndef GL_GLEXT_PROTOTYPES
+#define GL_GLEXT_PROTOTYPES 1
+#endif
+#include <GL/gl.h>
+#include <GL/glext.h>
+#endif
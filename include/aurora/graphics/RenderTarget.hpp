@@ -0,0 +1,67 @@
+// ============================================
+// include/aurora/graphics/RenderTarget.hpp
+// ============================================
+#pragma once
+#include "../core/Types.hpp"
+#include "Texture.hpp"
+#include "OpenGL.hpp"
+#include <vector>
+
+namespace Aurora {
+
+// Offscreen framebuffer with a color texture attachment. The texture and
+// depth buffer are shared between contexts; framebuffer objects are not,
+// so each context that binds the target gets its own (see GLContext).
+class RenderTarget {
+public:
+    struct Config {
+        Texture::Format format = Texture::Format::RGBA;
+        Texture::Filter filter = Texture::Filter::Linear;
+        bool depth = false;
+    };
+
+    RenderTarget(u32 width, u32 height);
+    RenderTarget(u32 width, u32 height, const Config& config);
+    ~RenderTarget();
+
+    RenderTarget(const RenderTarget&) = delete;
+    RenderTarget& operator=(const RenderTarget&) = delete;
+
+    // Bind as the current draw framebuffer
+    void bind() const;
+    void unbind() const;
+
+    // Reallocate attachments (contents are undefined afterwards)
+    void resize(u32 width, u32 height);
+
+    // Properties
+    u32 width() const { return m_width; }
+    u32 height() const { return m_height; }
+    Texture* texture() const { return m_texture.get(); }
+    // Framebuffer object of the current context, created on first use
+    GLuint framebufferId() const { return framebuffer().name; }
+    // Completeness of the current context's framebuffer object
+    bool isComplete() const;
+
+private:
+    struct Framebuffer {
+        u64 context;        // GLContext serial
+        GLuint name;
+        u32 attachments;    // m_attachments when last attached
+        bool complete;
+    };
+
+    void create();
+    void destroy();
+    Framebuffer& framebuffer() const;
+    void attach(Framebuffer& framebuffer) const;
+
+    mutable std::vector<Framebuffer> m_framebuffers;
+    u32 m_attachments = 0;  // Bumped whenever create() reallocates them
+    GLuint m_depthBuffer = 0;
+    Ref<Texture> m_texture;
+    u32 m_width, m_height;
+    Config m_config;
+};
+
+} // namespace Aurora
@@ -4,11 +4,15 @@
 #pragma once
 #include "../core/Object.hpp"
 #include "../core/Types.hpp"
+#include "GpuTimer.hpp"
+#include "Material.hpp"
 #include "Shader.hpp"
+#include "UniformBuffer.hpp"
 #include "Texture.hpp"
 #include "Mesh.hpp"
+#include "RenderTarget.hpp"
 #include <stack>
-#include <GL/glew.h>
+#include "OpenGL.hpp"
 
 namespace Aurora {
 
@@ -28,50 +32,66 @@ public:
         struct { Shader* shader; } setShader;
         struct { Texture* texture; u32 slot; } setTexture;
         struct { i32 x, y, width, height; } scissor;
-        struct { Color color; u32 flags; } clear;
+        struct { f32 r, g, b, a; u32 flags; } clear;
     };
 };
 
+// Immediate-mode 2D renderer. The GL implementation is the default;
+// SoftwareRenderer overrides the virtual drawing commands to rasterize
+// on the CPU.
 class Renderer : public Object {
 public:
     struct Stats {
         u32 drawCalls = 0;
         u32 triangles = 0;
         u32 vertices = 0;
-        f64 gpuTime = 0;
+        u32 stateChanges = 0;   // Program, texture, blend, scissor and target switches
+        u64 bytesUploaded = 0;  // Uniform and uniform buffer data sent to the GPU
+        f64 gpuTime = 0;    // Seconds; lags a few frames behind (see GpuTimer)
     };
     
     Renderer();
-    ~Renderer();
+    ~Renderer() override;
     
     // Initialization
-    bool initialize();
-    void shutdown();
+    virtual bool initialize();
+    virtual void shutdown();
     
     // Frame operations
-    void beginFrame();
-    void endFrame();
+    virtual void beginFrame();
+    virtual void endFrame();
+    
+    // GPU-timed sections of a frame; a pass ends at the next beginPass
+    virtual void beginPass(Name name);
+    virtual void endPass();
+    const GpuTimer& gpuTimer() const { return m_gpuTimer; }
     
     // Viewport
-    void setViewport(i32 x, i32 y, u32 width, u32 height);
-    void setScissor(i32 x, i32 y, u32 width, u32 height);
-    void disableScissor();
+    virtual void setViewport(i32 x, i32 y, u32 width, u32 height);
+    virtual void setScissor(i32 x, i32 y, u32 width, u32 height);
+    virtual void disableScissor();
+    
+    // Offscreen rendering (nullptr = window framebuffer)
+    void setRenderTarget(RenderTarget* target);
+    RenderTarget* renderTarget() const { return m_renderTarget; }
     
     // Clear operations
-    void clear(const Color& color = {0, 0, 0, 1});
+    virtual void clear(const Color& color = {0, 0, 0, 1});
     void clearDepth(f32 depth = 1.0f);
     
     // State management
-    void pushState();
-    void popState();
+    virtual void pushState();
+    virtual void popState();
     
     // Drawing operations
     void setShader(Shader* shader);
+    void setMaterial(const Material& material);
     void setTexture(Texture* texture, u32 slot = 0);
     void draw(Mesh* mesh);
-    void drawQuad(const Rect& rect, const Color& color = {1, 1, 1, 1});
-    void drawCircle(const Vec2& center, f32 radius, const Color& color = {1, 1, 1, 1});
-    void drawRoundedRect(const Rect& rect, f32 radius, const Color& color = {1, 1, 1, 1});
+    virtual void drawQuad(const Rect& rect, const Color& color = {1, 1, 1, 1});
+    virtual void drawQuad(const Rect& rect, const Material& material);
+    virtual void drawCircle(const Vec2& center, f32 radius, const Color& color = {1, 1, 1, 1});
+    virtual void drawRoundedRect(const Rect& rect, f32 radius, const Color& color = {1, 1, 1, 1});
     
     // Blending modes
     enum class BlendMode {
@@ -80,7 +100,7 @@ public:
         Additive,
         Multiply
     };
-    void setBlendMode(BlendMode mode);
+    virtual void setBlendMode(BlendMode mode);
     
     // Depth testing
     void enableDepthTest(bool enable);
@@ -90,10 +110,17 @@ public:
     const Stats& stats() const { return m_stats; }
     void resetStats();
     
+    // Source of the material shader variants; initialize() falls back to
+    // ShaderVariants::createBuiltin() when none is set
+    void setMaterialShaders(Ref<ShaderVariants> variants) { m_materialShaders = std::move(variants); }
+    ShaderVariants* materialShaders() const { return m_materialShaders.get(); }
+    
     // Matrix operations (for 2D we'll use simplified matrices)
     void setProjectionMatrix(const f32* matrix);
     void setViewMatrix(const f32* matrix);
     void setModelMatrix(const f32* matrix);
+    const f32* projectionMatrix() const { return m_projectionMatrix; }
+    const f32* viewMatrix() const { return m_viewMatrix; }
     
     // Convenience matrix builders
     static void orthoMatrix(f32* out, f32 left, f32 right, f32 bottom, f32 top);
@@ -101,6 +128,9 @@ public:
     static void scaleMatrix(f32* out, f32 x, f32 y);
     static void rotateMatrix(f32* out, f32 angle); // in radians
     
+protected:
+    Stats m_stats;
+
 private:
     struct RenderState {
         Shader* shader = nullptr;
@@ -112,16 +142,19 @@ private:
     };
     
     void applyBlendMode(BlendMode mode);
+    void applyModelMatrix(Shader* shader);
     void executeCommands();
+    UniformBuffer& frameUniforms();
     
     bool m_initialized = false;
     RenderState m_currentState;
     std::stack<RenderState> m_stateStack;
     std::vector<RenderCommand> m_commandBuffer;
-    Stats m_stats;
+    GpuTimer m_gpuTimer;
+    RenderTarget* m_renderTarget = nullptr;
     
     // Built-in resources
-    Ref<Shader> m_basicShader;
+    Ref<ShaderVariants> m_materialShaders;
     Ref<Mesh> m_quadMesh;
     Ref<Mesh> m_circleMesh;
     
@@ -129,6 +162,9 @@ private:
     f32 m_projectionMatrix[16];
     f32 m_viewMatrix[16];
     f32 m_modelMatrix[16];
+
+    // FrameUniforms block, shared by every program that declares it
+    Unique<UniformBuffer> m_frameUniforms;
 };
 
 } // namespace Aurora
@@ -2,49 +2,152 @@
 // include/aurora/graphics/Shader.hpp
 // ============================================
 #pragma once
+#include "../core/Name.hpp"
 #include "../core/Types.hpp"
 #include <string>
 #include <unordered_map>
-#include <GL/glew.h>
+#include <vector>
+#include "OpenGL.hpp"
 
 namespace Aurora {
 
+// Index of an active uniform, resolved once after linking
+struct UniformHandle {
+    static constexpr u32 kInvalid = ~0u;
+    u32 index = kInvalid;
+
+    bool valid() const { return index != kInvalid; }
+    explicit operator bool() const { return valid(); }
+};
+
+// Standard uniform block binding points
+enum class UniformBlock : u32 {
+    Frame = 0,      // "FrameUniforms": projection, view, viewport, time
+    Material = 1,   // "MaterialUniforms": per-material parameters
+    Count
+};
+
 class Shader {
 public:
-    Shader(const std::string& vertexSource, const std::string& fragmentSource);
+    // Immediate links before the constructor returns. Deferred starts the
+    // compile and leaves the result for finish(), which use() calls; with
+    // GL_KHR_parallel_shader_compile the driver compiles on its own threads
+    // meanwhile and isReady() reports when finish() would not block.
+    enum class CompileMode {
+        Immediate,
+        Deferred
+    };
+
+    struct Stats {
+        u32 uniformWrites = 0;      // Values sent to GL
+        u32 redundantWrites = 0;    // Skipped: value already current
+        u64 uploadedBytes = 0;      // Size of the values sent
+    };
+
+    Shader(const std::string& vertexSource, const std::string& fragmentSource,
+           CompileMode mode = CompileMode::Immediate);
     ~Shader();
-    
+
+    Shader(const Shader&) = delete;
+    Shader& operator=(const Shader&) = delete;
+
     // Shader usage
-    void use() const;
+    void use();
     void unbind() const;
-    
-    // Uniform setters
-    void setInt(const std::string& name, i32 value);
-    void setFloat(const std::string& name, f32 value);
-    void setVec2(const std::string& name, const Vec2& value);
-    void setVec3(const std::string& name, f32 x, f32 y, f32 z);
-    void setVec4(const std::string& name, f32 x, f32 y, f32 z, f32 w);
-    void setMat4(const std::string& name, const f32* matrix);
-    void setColor(const std::string& name, const Color& color);
-    
+    bool isValid() const { return m_program != 0; }
+
+    // Deferred compilation
+    bool isReady() const;
+    bool finish();      // Wait for the link; false if it failed
+    bool isPending() const { return m_pending; }
+
+    // Resolve an active uniform (invalid handle if the program has none)
+    UniformHandle uniform(Name name);
+
+    // Typed setters; the program must be in use. Values are shadowed on
+    // the CPU so setting an unchanged value issues no GL call.
+    void set(UniformHandle handle, i32 value);
+    void set(UniformHandle handle, f32 value);
+    void set(UniformHandle handle, const Vec2& value);
+    void set(UniformHandle handle, const Color& value);
+    void setVec3(UniformHandle handle, f32 x, f32 y, f32 z);
+    void setVec4(UniformHandle handle, f32 x, f32 y, f32 z, f32 w);
+    void setMat4(UniformHandle handle, const f32* matrix);
+
+    // Uniform setters by name (one hash lookup; keep frequently used
+    // Names or, better, handles around rather than converting strings)
+    void setInt(Name name, i32 value) { set(uniform(name), value); }
+    void setFloat(Name name, f32 value) { set(uniform(name), value); }
+    void setVec2(Name name, const Vec2& value) { set(uniform(name), value); }
+    void setVec3(Name name, f32 x, f32 y, f32 z) { setVec3(uniform(name), x, y, z); }
+    void setVec4(Name name, f32 x, f32 y, f32 z, f32 w) { setVec4(uniform(name), x, y, z, w); }
+    void setMat4(Name name, const f32* matrix) { setMat4(uniform(name), matrix); }
+    void setColor(Name name, const Color& color) { set(uniform(name), color); }
+
+    // Uniform blocks declared by the program, bound to their standard
+    // points at link time; others can be bound explicitly
+    bool hasBlock(UniformBlock block) const;
+    void bindBlock(Name blockName, u32 binding);
+
+    // Reflection (filled in once the program has linked)
+    u32 uniformCount() const { return (u32)m_uniforms.size(); }
+    Name uniformName(UniformHandle handle) const;
+
+    // Stats
+    const Stats& stats() const { return m_stats; }
+    void resetStats() { m_stats = {}; }
+
     // Get program ID
     GLuint programId() const { return m_program; }
-    
+
     // Create from files
-    static Ref<Shader> fromFiles(const std::string& vertexPath, 
-                                  const std::string& fragmentPath);
-    
-    // Built-in shaders
+    static Ref<Shader> fromFiles(const std::string& vertexPath,
+                                  const std::string& fragmentPath,
+                                  CompileMode mode = CompileMode::Immediate);
+
+    // GL_KHR_parallel_shader_compile is available in the current context
+    static bool parallelCompileSupported();
+
+    // Sources of shaders/basic.vert and basic.frag, compiled into the library
+    static const char* basicVertexSource();
+    static const char* basicFragmentSource();
+
+    // Single variants of the built-in UI shader: flat color, textured, and
+    // a 9-tap textured blur. Parameters come from the MaterialUniforms
+    // block (UniformBlock::Material), not from plain uniforms, so draw them
+    // through ShaderVariants::bind or bind a buffer there yourself.
     static Ref<Shader> createBasic();
     static Ref<Shader> createTextured();
     static Ref<Shader> createBlur();
-    
+
 private:
+    struct Uniform {
+        Name name;
+        GLint location;
+        GLenum type;
+        u32 offset;         // Into m_shadow, in 32-bit words
+        u32 words;
+        bool initialized;   // Shadow holds the value GL has
+    };
+
     GLuint compileShader(GLenum type, const std::string& source);
-    GLint getUniformLocation(const std::string& name);
-    
-    GLuint m_program;
-    std::unordered_map<std::string, GLint> m_uniformCache;
+    void logCompileErrors(GLuint shader);
+    void reflect();
+
+    // Compare against the shadow copy; true if GL needs the new value
+    bool store(UniformHandle handle, const void* value, u32 words);
+
+    GLuint m_program = 0;
+    GLuint m_vertexShader = 0;      // Held until a pending link finishes
+    GLuint m_fragmentShader = 0;
+    bool m_pending = false;
+    u64 m_cacheKey = 0;
+    std::vector<Uniform> m_uniforms;
+    std::vector<u32> m_shadow;
+    std::unordered_map<Name, u32> m_uniformCache;   // Name -> index in m_uniforms
+    std::unordered_map<Name, GLuint> m_blocks;      // Block name -> block index
+    u32 m_blockMask = 0;                            // Standard blocks present
+    Stats m_stats;
 };
 
 } // namespace Aurora
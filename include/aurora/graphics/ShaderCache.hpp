@@ -0,0 +1,56 @@
+// ============================================
+// include/aurora/graphics/ShaderCache.hpp
+// ============================================
+#pragma once
+#include "../core/Types.hpp"
+#include <string>
+#include "OpenGL.hpp"
+
+namespace Aurora {
+
+// On-disk cache of linked program binaries (glGetProgramBinary), keyed
+// by a hash of the sources and the driver identity. A binary the driver
+// rejects is deleted and the program is compiled from source instead.
+class ShaderCache {
+public:
+    struct Stats {
+        u32 hits = 0;       // Programs loaded from disk
+        u32 misses = 0;     // No entry; compiled from source
+        u32 rejected = 0;   // Entry present but refused by the driver
+        u32 stores = 0;     // Binaries written
+    };
+
+    static ShaderCache& shared();
+
+    // Cache directory; empty disables the cache
+    void setDirectory(const std::string& directory);
+    const std::string& directory() const { return m_directory; }
+    bool enabled() const;
+
+    // Key for a program on the current driver (needs a current context)
+    u64 key(const std::string& vertexSource, const std::string& fragmentSource);
+
+    // Linked program for key, or 0
+    GLuint load(u64 key);
+
+    // Save a linked program created with the retrievable hint
+    bool store(u64 key, GLuint program);
+
+    // Remove every cached binary
+    void clear();
+
+    const Stats& stats() const { return m_stats; }
+
+private:
+    ShaderCache() = default;
+
+    std::string pathFor(u64 key) const;
+    const std::string& driver();
+
+    std::string m_directory;
+    std::string m_driver;
+    i32 m_formats = -1;     // GL_NUM_PROGRAM_BINARY_FORMATS, queried lazily
+    Stats m_stats;
+};
+
+} // namespace Aurora
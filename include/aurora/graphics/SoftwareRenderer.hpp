@@ -0,0 +1,134 @@
+// ============================================
+// include/aurora/graphics/SoftwareRenderer.hpp
+// ============================================
+#pragma once
+#include "Renderer.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Aurora {
+
+// CPU backend for machines without a GPU. Draw calls are recorded,
+// binned into screen tiles at endFrame() and rasterized by a pool of
+// worker threads into a premultiplied 0xAARRGGBB framebuffer, which the
+// platform presents with IPlatform::presentPixels().
+//
+// Coordinates are window pixels with the origin at the top-left (the
+// projection the GL path is normally given); the matrix setters and the
+// GL-only calls (shaders, meshes, textures, render targets) are ignored.
+// Shapes use the same coverage functions as shaders/basic.frag, so output
+// matches the GL path up to rounding at antialiased edges.
+class SoftwareRenderer : public Renderer {
+public:
+    struct Config {
+        u32 threads = 0;        // Rasterizer threads including the caller (0 = one per core)
+        u32 tileSize = 64;      // Pixels; a power of two
+    };
+
+    // Straight-alpha RGBA8 pixels for drawImage()
+    class Image {
+    public:
+        Image(u32 width, u32 height, const u8* rgba);
+
+        u32 width() const { return m_width; }
+        u32 height() const { return m_height; }
+        const u32* pixels() const { return m_pixels.data(); }
+
+    private:
+        u32 m_width, m_height;
+        std::vector<u32> m_pixels;  // 0xAABBGGRR, as loaded
+    };
+
+    struct RasterStats {
+        u64 pixelsFilled = 0;       // Pixels written, summed over commands
+        u32 tiles = 0;              // Tiles with at least one command
+        f64 rasterTime = 0;         // Seconds in endFrame()
+    };
+
+    SoftwareRenderer();
+    explicit SoftwareRenderer(const Config& config);
+    ~SoftwareRenderer() override;
+
+    bool initialize() override;
+    void shutdown() override;
+
+    void beginFrame() override;
+    void endFrame() override;
+    void beginPass(Name name) override {}
+    void endPass() override {}
+
+    // Resizes the framebuffer
+    void setViewport(i32 x, i32 y, u32 width, u32 height) override;
+    void setScissor(i32 x, i32 y, u32 width, u32 height) override;
+    void disableScissor() override;
+
+    void clear(const Color& color = {0, 0, 0, 1}) override;
+
+    void pushState() override;
+    void popState() override;
+
+    // Every shape ends up here (the base class builds the materials for
+    // the color, rounded rect and circle forms). Material textures are GL
+    // objects and are ignored; use drawImage().
+    using Renderer::drawQuad;
+    void drawQuad(const Rect& rect, const Material& material) override;
+
+    // Bilinear textured quad; the image must outlive endFrame()
+    void drawImage(const Rect& rect, const Image& image, const Color& tint = {1, 1, 1, 1});
+
+    void setBlendMode(BlendMode mode) override;
+
+    // Finished frame, valid after endFrame()
+    const u32* pixels() const { return m_pixels.data(); }
+    u32 width() const { return m_width; }
+    u32 height() const { return m_height; }
+    u32 stride() const { return m_width; }     // In pixels
+
+    const RasterStats& rasterStats() const { return m_rasterStats; }
+    u32 threadCount() const { return (u32)m_workers.size() + 1; }
+
+private:
+    struct Command;
+    struct State {
+        BlendMode blendMode = BlendMode::Alpha;
+        bool scissorEnabled = false;
+        i32 scissor[4] = {0, 0, 0, 0};      // x0, y0, x1, y1
+    };
+
+    void record(const Rect& rect, const Material& material, const Image* image);
+    void bin();
+    void rasterizeTiles();
+    void rasterizeTile(u32 tile, u64& pixelsFilled);
+    void workerLoop();
+
+    Config m_config;
+    u32 m_tileShift = 6;
+    u32 m_width = 0;
+    u32 m_height = 0;
+    u32 m_tilesX = 0;
+    u32 m_tilesY = 0;
+    std::vector<u32> m_pixels;
+
+    State m_state;
+    std::vector<State> m_stateStack;
+    std::vector<Command> m_commands;
+    std::vector<std::vector<u32>> m_bins;   // Command indices per tile, in draw order
+    std::vector<u32> m_activeTiles;
+    RasterStats m_rasterStats;
+
+    // Workers wake on a new generation and pull tiles from m_nextTile
+    std::vector<std::thread> m_workers;
+    std::mutex m_mutex;
+    std::condition_variable m_start;
+    std::condition_variable m_done;
+    u64 m_generation = 0;
+    u32 m_busyWorkers = 0;
+    bool m_stopping = false;
+    std::atomic<u32> m_nextTile{0};
+    std::atomic<u64> m_pixelsFilled{0};
+};
+
+} // namespace Aurora
@@ -4,7 +4,8 @@
 #pragma once
 #include "../core/Types.hpp"
 #include <string>
-#include <GL/glew.h>
+#include <vector>
+#include "OpenGL.hpp"
 
 namespace Aurora {
 
@@ -41,9 +42,15 @@ public:
         bool srgb = false;
     };
     
-    Texture(u32 width, u32 height, const Config& config = {});
-    Texture(const std::string& path, const Config& config = {});
+    Texture(u32 width, u32 height);
+    Texture(u32 width, u32 height, const Config& config);
+    // Binary PPM (P6) images; a failed load leaves a 1x1 magenta texture
+    explicit Texture(const std::string& path);
+    Texture(const std::string& path, const Config& config);
     ~Texture();
+
+    Texture(const Texture&) = delete;
+    Texture& operator=(const Texture&) = delete;
     
     // Texture operations
     void bind(u32 slot = 0) const;
@@ -63,9 +70,10 @@ public:
     
 private:
     void createTexture(const void* data);
+    bool loadPPM(const std::string& path, std::vector<u8>& pixels);
     
-    GLuint m_texture;
-    u32 m_width, m_height;
+    GLuint m_texture = 0;
+    u32 m_width = 0, m_height = 0;
     Config m_config;
 };
 
@@ -0,0 +1,83 @@
+// ============================================
+// include/aurora/graphics/UniformBuffer.hpp
+// ============================================
+#pragma once
+#include "../core/Types.hpp"
+#include "Shader.hpp"
+#include <vector>
+#include "OpenGL.hpp"
+
+namespace Aurora {
+
+// Contents of the per-frame uniform block (std140):
+//
+//     layout(std140) uniform FrameUniforms {
+//         mat4 uProjection;
+//         mat4 uView;
+//         vec4 uViewport;     // x, y, width, height
+//         float uTime;
+//     };
+struct FrameUniforms {
+    f32 projection[16];
+    f32 view[16];
+    f32 viewport[4];
+    f32 time;
+    f32 padding[3];
+};
+
+// Contents of the per-material uniform block (std140), filled by
+// ShaderVariants::bind(). The fields most draws change lead, so the span
+// UniformBuffer::update() sends stays short:
+//
+//     layout(std140) uniform MaterialUniforms {
+//         vec4 uColor;
+//         vec2 uSize;
+//         float uRadius;
+//         float uBorderWidth;
+//         vec4 uBorderColor;
+//         vec4 uGradientEnd;
+//         vec2 uGradientDirection;
+//         vec2 uBlurDirection;    // Texel step
+//         float uBlurSigma;
+//     };
+struct MaterialUniforms {
+    f32 color[4];
+    f32 size[2];
+    f32 radius;
+    f32 borderWidth;
+    f32 borderColor[4];
+    f32 gradientEnd[4];
+    f32 gradientDirection[2];
+    f32 blurDirection[2];
+    f32 blurSigma;
+    f32 padding[3];
+};
+
+// GPU uniform buffer shared by every program that declares the block.
+// Updates are shadowed: only the span that differs is sent, and
+// re-uploading unchanged bytes is free.
+class UniformBuffer {
+public:
+    explicit UniformBuffer(u32 size);
+    ~UniformBuffer();
+
+    UniformBuffer(const UniformBuffer&) = delete;
+    UniformBuffer& operator=(const UniformBuffer&) = delete;
+
+    // Write a byte range; returns the bytes sent to GL (0 if current)
+    u32 update(const void* data, u32 size, u32 offset = 0);
+
+    // Attach to a binding point
+    void bind(u32 binding) const;
+    void bind(UniformBlock block) const { bind((u32)block); }
+
+    u32 size() const { return m_size; }
+    GLuint bufferId() const { return m_buffer; }
+
+private:
+    GLuint m_buffer = 0;
+    u32 m_size;
+    std::vector<u8> m_shadow;
+};
+
+} // namespace Aurora
@@ -88,11 +88,19 @@ struct Event {
     EventType type = EventType::None;
     Window* window = nullptr;
     
+    // When the input happened, in seconds on the steady clock
+    // (TimerWheel::clock() / 1e9); 0 if the platform does not know.
+    // Latency is the difference to the time the event is handled.
+    f64 timestamp = 0.0;
+    
     union {
         struct { u32 width, height; } size;
         struct { i32 x, y; } position;
-        struct { f32 x, y; } mouse;
-        struct { f32 dx, dy; } scroll;
+        struct { f32 x, y; } mouse;         // Window pixels; fractional when the device is
+        struct {
+            f32 dx, dy;                     // Wheel notches; positive scrolls up / right
+            bool precise;                   // Smooth scrolling (touchpad, hi-res wheel)
+        } scroll;
         struct { MouseButton button; } mouseButton;
         struct { 
             KeyCode code;
@@ -19,7 +19,7 @@ public:
     virtual void shutdown() = 0;
     
     // Window management
-    virtual Ref<Window> createWindow(const Window::Config& config) = 0;
+    virtual Handle<Window> createWindow(const Window::Config& config) = 0;
     virtual void destroyWindow(Window* window) = 0;
     
     // Event handling
@@ -27,20 +27,69 @@ public:
     virtual bool hasEvents() const = 0;
     virtual Event nextEvent() = 0;
     
+    // Block until an event arrives, wakeUp() is called or the timeout
+    // (seconds, negative waits forever) expires
+    virtual void waitEvents(f64 timeout) = 0;
+    
+    // Interrupt waitEvents(); safe from any thread
+    virtual void wakeUp() = 0;
+    
     // Display information
     virtual u32 displayCount() const = 0;
     virtual Rect displayBounds(u32 index) const = 0;
     
+    // Refresh rate of a display in Hz
+    virtual f64 displayRefreshRate(u32 index) const { return 60.0; }
+    
+    // Display showing most of the window
+    virtual u32 displayOf(Window* window) const { return 0; }
+    
     // Platform name
     virtual std::string name() const = 0;
     
+    // Requests so far that blocked on a display server reply; 0 when the
+    // backend does not count them. A lower bound: requests made inside
+    // libraries such as libGL are counted per call, not per request
+    virtual u64 roundTrips() const { return 0; }
+    
     // OpenGL context creation
     virtual void* createGLContext(Window* window) = 0;
     virtual void destroyGLContext(void* context) = 0;
     virtual void makeCurrent(Window* window, void* context) = 0;
     virtual void swapBuffers(Window* window) = 0;
     
-    // Factory method
+    // Hidden context that every createGLContext() context shares objects
+    // with, so shaders, atlases and meshes are created once for all
+    // windows. makeCurrent(nullptr, shareGLContext()) binds it without a
+    // window, e.g. to load resources at startup. Null when unsupported.
+    virtual void* shareGLContext() { return nullptr; }
+    
+    // Vblank interval of the window's GL surface; 0 lets swapBuffers()
+    // return at once. False when unsupported
+    virtual bool setSwapInterval(Window* window, i32 interval) { return false; }
+    
+    // Most recent vblank of the output showing the window and the refresh
+    // interval, in TimerWheel::clock() nanoseconds, as measured by the
+    // display hardware. False when unknown
+    virtual bool vblankTiming(Window* window, u64& lastVblank, u64& interval) { return false; }
+    
+    // False while the compositor has not asked for the window's next
+    // frame (Wayland frame callbacks); the request arrives as an event
+    virtual bool canPresent(Window* window) const { return true; }
+    
+    // Window regions (pixels) the next swapBuffers() or presentPixels()
+    // changed, so the compositor only recomposites those; empty is the
+    // whole window
+    virtual void setFrameDamage(Window* window, const std::vector<Rect>& regions) {}
+    
+    // Show a CPU-rendered frame (premultiplied 0xAARRGGBB, stride in
+    // pixels) in place of GL output; false when the platform cannot
+    virtual bool presentPixels(Window* window, const u32* pixels, u32 width, u32 height, u32 stride) {
+        return false;
+    }
+    
+    // Backend picked from AURORA_PLATFORM, WAYLAND_DISPLAY and DISPLAY;
+    // nullptr when no compiled-in backend can run here
     static Unique<IPlatform> create();
 };
 
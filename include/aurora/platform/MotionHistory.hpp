@@ -0,0 +1,61 @@
+// ============================================
+// include/aurora/platform/MotionHistory.hpp
+// ============================================
+#pragma once
+#include "../core/Types.hpp"
+#include <vector>
+
+namespace Aurora {
+
+struct MotionSample {
+    f64 timestamp = 0.0;    // Seconds, Event::timestamp clock
+    f32 x = 0.0f;
+    f32 y = 0.0f;
+};
+
+// Every pointer position the platform received, including the ones
+// between two frames, in a fixed ring. A frame drains the new samples
+// with consume() or asks for a velocity fitted over the recent ones, so
+// kinetic scrolling and springs do not depend on which sample happened
+// to be last. Samples overwritten before they were consumed count as
+// dropped.
+class MotionHistory {
+public:
+    struct Stats {
+        u64 received = 0;
+        u64 consumed = 0;
+        u64 dropped = 0;
+    };
+
+    explicit MotionHistory(u32 capacity = 256);
+
+    void push(const MotionSample& sample);
+
+    // Appends the samples pushed since the last call, oldest first;
+    // returns how many
+    u32 consume(std::vector<MotionSample>& out);
+
+    // Least-squares velocity in pixels per second over the samples in the
+    // last `window` seconds before the newest one (zero with fewer than two)
+    Vec2 velocity(f64 window = 0.1) const;
+
+    bool empty() const { return m_count == 0; }
+    const MotionSample& latest() const;
+    u32 size() const { return m_count; }
+    u32 capacity() const { return (u32)m_samples.size(); }
+
+    const Stats& stats() const { return m_stats; }
+    void clear();
+
+private:
+    // i-th newest sample, 0 = latest
+    const MotionSample& fromLatest(u32 i) const;
+
+    std::vector<MotionSample> m_samples;
+    u32 m_head = 0;         // Next write
+    u32 m_count = 0;
+    u32 m_unread = 0;
+    Stats m_stats;
+};
+
+} // namespace Aurora
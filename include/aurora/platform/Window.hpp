@@ -3,8 +3,9 @@
 // ============================================
 #pragma once
 #include "../core/Object.hpp"
+#include "../core/Signal.hpp"
 #include "../core/Types.hpp"
-#include <functional>
+#include "MotionHistory.hpp"
 
 namespace Aurora {
 
@@ -29,6 +30,12 @@ public:
         bool transparent = false;
         bool alwaysOnTop = false;
         f32 opacity = 1.0f;
+        
+        // GL surface format; the alpha channel follows `transparent`.
+        // Shapes are antialiased in their shaders, so MSAA is opt-in
+        u32 samples = 0;
+        u32 depthBits = 24;
+        u32 stencilBits = 8;
     };
     
     Window(const Config& config);
@@ -49,17 +56,22 @@ public:
     virtual void setSize(u32 width, u32 height) = 0;
     virtual void setOpacity(f32 opacity) = 0;
     
-    // Event callbacks
-    std::function<void()> onClose;
-    std::function<void(u32, u32)> onResize;
-    std::function<void(i32, i32)> onMove;
-    std::function<void()> onFocus;
-    std::function<void()> onBlur;
+    // Pointer samples over this window, filled by the platform
+    MotionHistory& motionHistory() { return m_motionHistory; }
+    const MotionHistory& motionHistory() const { return m_motionHistory; }
+    
+    // Event signals
+    Signal<> onClose;
+    Signal<u32, u32> onResize;
+    Signal<i32, i32> onMove;
+    Signal<> onFocus;
+    Signal<> onBlur;
     
 protected:
     Config m_config;
     void* m_nativeHandle = nullptr;
     void* m_glContext = nullptr;
+    MotionHistory m_motionHistory;
 };
 
 } // namespace Aurora
\ No newline at end of file
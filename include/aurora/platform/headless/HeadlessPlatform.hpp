@@ -0,0 +1,111 @@
+// ============================================
+// include/aurora/platform/headless/HeadlessPlatform.hpp
+// ============================================
+#pragma once
+#include "../IPlatform.hpp"
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+
+namespace Aurora {
+
+// Platform without a display server. Windows are offscreen surfaces
+// (EGL pbuffers on the surfaceless platform, so llvmpipe works on
+// machines without a GPU); input comes from inject()/scheduleEvent()
+// and rendered frames are read back with readPixels(). Built without
+// EGL, windows still exist but createGLContext() returns null.
+//
+// Selected by IPlatform::create() when AURORA_PLATFORM=headless or no
+// display server is reachable.
+class HeadlessPlatform : public IPlatform {
+public:
+    struct Config {
+        u32 displayWidth = 1920;
+        u32 displayHeight = 1080;
+        f64 refreshRate = 60.0;
+        bool gl = true;             // Create EGL contexts
+        bool shareContexts = true;  // Share objects through shareGLContext()
+    };
+
+    HeadlessPlatform();
+    explicit HeadlessPlatform(const Config& config);
+    ~HeadlessPlatform() override;
+
+    bool initialize() override;
+    void shutdown() override;
+
+    Handle<Window> createWindow(const Window::Config& config) override;
+    void destroyWindow(Window* window) override;
+
+    void pumpEvents() override;
+    bool hasEvents() const override;
+    Event nextEvent() override;
+    void waitEvents(f64 timeout) override;
+    void wakeUp() override;
+
+    u32 displayCount() const override { return 1; }
+    Rect displayBounds(u32 index) const override;
+    f64 displayRefreshRate(u32 index) const override { return m_config.refreshRate; }
+    std::string name() const override { return "Headless"; }
+
+    void* createGLContext(Window* window) override;
+    void destroyGLContext(void* context) override;
+    void makeCurrent(Window* window, void* context) override;
+    void swapBuffers(Window* window) override;
+    void* shareGLContext() override;
+    bool presentPixels(Window* window, const u32* pixels, u32 width, u32 height, u32 stride) override;
+
+    // Input injection; safe from any thread
+    void inject(const Event& event);
+    void injectMouseMove(Window* window, f32 x, f32 y);
+    void injectMouseButton(Window* window, MouseButton button, bool pressed);
+    void injectScroll(Window* window, f32 dx, f32 dy);
+    void injectKey(Window* window, KeyCode code, bool pressed, u32 modifiers = 0);
+    void injectResize(Window* window, u32 width, u32 height);
+    void injectClose(Window* window);
+
+    // Scripted input: delivered by the pumpEvents() call whose index
+    // (pumpCount() before the call) reaches frame, so replays do not
+    // depend on wall time
+    void scheduleEvent(u64 frame, const Event& event);
+    u64 pumpCount() const { return m_pumpCount; }
+
+    // Contents of the window's last rendered frame, tightly packed RGBA8
+    // rows from the top. For GL frames the window's context must be
+    // current; a frame given to presentPixels() is returned as is
+    bool readPixels(Window* window, std::vector<u8>& rgba);
+
+    // Frames presented with swapBuffers() or presentPixels()
+    u64 presentedFrames() const { return m_presented; }
+
+    // GL is available (EGL initialized)
+    bool hasGL() const { return m_eglDisplay != nullptr; }
+
+private:
+    struct Surface;
+
+    bool initializeGL();
+    Surface* surfaceOf(Window* window) const;
+    void resizeSurface(Surface& surface, u32 width, u32 height);
+    void push(const Event& event);
+
+    Config m_config;
+
+    // EGL objects are kept opaque so the header does not pull in EGL
+    void* m_eglDisplay = nullptr;
+    void* m_eglConfig = nullptr;
+    void* m_eglShareContext = nullptr;
+    std::map<void*, u64> m_contextSerials;     // GLContext serial per EGL context
+    std::map<Window*, Unique<Surface>> m_surfaces;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_wake;
+    bool m_woken = false;
+    std::deque<Event> m_eventQueue;
+    std::multimap<u64, Event> m_script;
+    u64 m_pumpCount = 0;
+    u64 m_presented = 0;
+};
+
+} // namespace Aurora
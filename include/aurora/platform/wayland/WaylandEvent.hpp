@@ -0,0 +1,29 @@
+// ============================================
+// include/aurora/platform/wayland/WaylandEvent.hpp
+// ============================================
+#pragma once
+#include "../Window.hpp"
+#include "../Event.hpp"
+
+namespace Aurora {
+
+// KeyCode for a Linux evdev key (wl_keyboard.key). Keys are named by
+// their position on a US layout; without a keymap library that is the
+// only layout-independent name. The compositor's keymap is ignored, so
+// non-US layouts report the wrong keys (docs/KnownIssues.md, AUR-1).
+KeyCode evdevToKeyCode(u32 key);
+
+// MouseButton for an evdev BTN_* code (None when unknown)
+MouseButton evdevToMouseButton(u32 button);
+
+// KeyModifiers bits for wl_keyboard.modifiers masks; the real and
+// virtual modifiers of xkb's default keymaps sit at the core X bits
+u32 waylandModifiers(u32 mods);
+
+// Event::timestamp seconds for a wl_pointer/wl_keyboard time.
+// Compositors stamp input with CLOCK_MONOTONIC milliseconds, the steady
+// clock's source on Linux; the 32-bit value is extended to the full
+// clock value nearest to now.
+f64 waylandTimestamp(u32 milliseconds);
+
+} // namespace Aurora
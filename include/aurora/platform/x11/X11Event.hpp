@@ -0,0 +1,48 @@
+// ============================================
+// include/aurora/platform/x11/X11Event.hpp
+// ============================================
+#pragma once
+#include "../Window.hpp"
+#include "../Event.hpp"
+#include <X11/Xlib.h>
+#include <array>
+
+namespace Aurora {
+
+// Layout-independent key for a keysym (letters in either case)
+KeyCode keysymToKeyCode(KeySym keysym);
+
+// KeyModifiers bits for a core or XI2 modifier state
+u32 x11Modifiers(unsigned int state);
+
+// Hardware keycode to KeyCode for the current keymap, so translating a
+// key event is one lookup instead of an Xkb query. Rebuild on
+// MappingNotify.
+class X11KeyTable {
+public:
+    X11KeyTable();
+
+    void rebuild(Display* display);
+    KeyCode operator[](unsigned int keycode) const {
+        return keycode < m_codes.size() ? m_codes[keycode] : KeyCode::Unknown;
+    }
+
+private:
+    std::array<KeyCode, 256> m_codes;
+};
+
+// Converts X server timestamps (milliseconds, wrapping at 32 bits) to
+// Event::timestamp seconds. Local servers stamp events with
+// CLOCK_MONOTONIC, the steady clock's source on Linux; for any other
+// server the offset is estimated from the smallest observed delay.
+class X11Clock {
+public:
+    f64 toSeconds(Time serverTime);
+
+private:
+    bool m_checked = false;
+    bool m_sameClock = true;
+    f64 m_offset = 0.0;
+};
+
+} // namespace Aurora
@@ -0,0 +1,29 @@
+// ============================================
+// include/aurora/ui/FrameStatsOverlay.hpp
+// ============================================
+#pragma once
+#include "Widget.hpp"
+#include "../core/FrameStats.hpp"
+
+namespace Aurora {
+
+// Frame time graph: one bar per recent frame, newest on the right, scaled
+// so the refresh budget sits at half height. Bars within budget are green,
+// up to twice the budget yellow, beyond that red. Repaint it once per
+// frame (e.g. from Application::onFrame) while it is visible.
+class FrameStatsOverlay : public Widget {
+public:
+    explicit FrameStatsOverlay(const FrameStats& stats);
+
+    // Width of one bar in pixels
+    void setBarWidth(f32 width) { m_barWidth = width; update(); }
+
+protected:
+    void onPaint(Renderer& renderer) override;
+
+private:
+    const FrameStats& m_stats;
+    f32 m_barWidth = 2.0f;
+};
+
+} // namespace Aurora
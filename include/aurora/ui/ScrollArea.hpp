@@ -0,0 +1,92 @@
+// ============================================
+// include/aurora/ui/ScrollArea.hpp
+// ============================================
+#pragma once
+#include "Widget.hpp"
+#include "../graphics/RenderTarget.hpp"
+#include <unordered_map>
+#include <vector>
+
+namespace Aurora {
+
+// Scrollable viewport over a content widget.
+//
+// Content is rasterized into fixed-size offscreen tiles. Scrolling only
+// re-composites cached tiles at the new offset; a tile is rendered again
+// when it first enters the viewport or when the content repaints over it.
+class ScrollArea : public Widget {
+public:
+    struct TileStats {
+        u32 rasterized = 0;   // Tiles rendered this frame
+        u32 reused = 0;       // Tiles composited from cache this frame
+        u32 evicted = 0;      // Tiles released this frame
+        u32 resident = 0;     // Tiles cached after this frame
+    };
+
+    ScrollArea();
+    ~ScrollArea() override;
+
+    // Content
+    void setContent(Handle<Widget> content);
+    Widget* content() const { return m_content.get(); }
+
+    // Scrolling (offset is clamped to the content bounds)
+    void setScrollOffset(const Vec2& offset);
+    void scrollBy(const Vec2& delta) { setScrollOffset(m_scrollOffset + delta); }
+    Vec2 scrollOffset() const { return m_scrollOffset; }
+    Vec2 maxScrollOffset() const;
+
+    // Tile cache
+    void setTileSize(u32 size);
+    u32 tileSize() const { return m_tileSize; }
+    void setCacheMargin(u32 tiles) { m_cacheMargin = tiles; }
+    u32 cacheMargin() const { return m_cacheMargin; }
+    void setTileCachingEnabled(bool enabled);
+    bool isTileCachingEnabled() const { return m_cachingEnabled; }
+    void invalidateTiles();
+
+    // Per-frame cache statistics
+    const TileStats& tileStats() const { return m_stats; }
+
+protected:
+    void onPaint(Renderer& renderer) override;
+    void childUpdated(Widget& child, const Rect& rect) override;
+
+private:
+    struct Tile {
+        Ref<RenderTarget> target;
+        bool valid = false;
+    };
+
+    struct TileRange {
+        i32 x0, y0, x1, y1;   // Inclusive
+        bool contains(i32 tx, i32 ty) const {
+            return tx >= x0 && tx <= x1 && ty >= y0 && ty <= y1;
+        }
+    };
+
+    static u64 tileKey(i32 tx, i32 ty) {
+        return ((u64)(u32)tx << 32) | (u32)ty;
+    }
+
+    TileRange visibleTiles(const Vec2& offset) const;
+    void rasterizeTile(Renderer& renderer, i32 tx, i32 ty, Tile& tile);
+    void compositeTile(Renderer& renderer, i32 tx, i32 ty, const Tile& tile,
+                       const Vec2& offset);
+    void evictTiles(const TileRange& keep);
+    Ref<RenderTarget> acquireTarget();
+    void paintDirect(Renderer& renderer, const Vec2& offset);
+
+    Handle<Widget> m_content;
+    Vec2 m_scrollOffset;
+
+    u32 m_tileSize = 256;
+    u32 m_cacheMargin = 1;
+    bool m_cachingEnabled = true;
+
+    std::unordered_map<u64, Tile> m_tiles;
+    std::vector<Ref<RenderTarget>> m_freeTargets;
+    TileStats m_stats;
+};
+
+} // namespace Aurora
@@ -0,0 +1,71 @@
+// ============================================
+// include/aurora/ui/Widget.hpp
+// ============================================
+#pragma once
+#include "../core/Object.hpp"
+#include "../core/Pool.hpp"
+#include "../core/Property.hpp"
+#include "../core/Types.hpp"
+
+namespace Aurora {
+
+class Renderer;
+
+// What a property change costs a widget
+enum class Invalidation : u8 {
+    Repaint,
+    Layout
+};
+
+// Widgets are slab-allocated and main-thread only
+class Widget : public Object, public Pooled<Widget> {
+public:
+    Widget();
+    virtual ~Widget();
+
+    // Geometry (relative to the parent widget)
+    void setGeometry(const Rect& rect);
+    const Rect& geometry() const { return m_geometry; }
+    Vec2 size() const { return {m_geometry.width, m_geometry.height}; }
+
+    // Map a point in local coordinates to window coordinates
+    Vec2 mapToWindow(const Vec2& local) const;
+    Widget* parentWidget() const;
+
+    // Visibility
+    void setVisible(bool visible);
+    bool isVisible() const { return m_visible; }
+
+    // Request a repaint of the whole widget or a local rectangle
+    void update();
+    void update(const Rect& rect);
+    bool needsRepaint() const { return m_dirty; }
+
+    // Request a layout pass before the next paint (implies a repaint)
+    void requestLayout();
+    bool needsLayout() const { return m_needsLayout; }
+
+    // Repaint or re-layout whenever the property's value changes
+    void invalidateOn(const PropertyBase& property, Invalidation kind = Invalidation::Repaint);
+
+    // Paint in local coordinates; the caller sets up the transform
+    void paint(Renderer& renderer);
+
+protected:
+    virtual void onPaint(Renderer& renderer) {}
+    virtual void onLayout() {}
+    virtual void onGeometryChanged(const Rect& oldGeometry) {}
+
+    // Called when a child requests a repaint (rect is in child coordinates)
+    virtual void childUpdated(Widget& child, const Rect& rect);
+
+private:
+    Rect m_geometry{0, 0, 0, 0};
+    bool m_visible = true;
+    bool m_dirty = true;
+    bool m_needsLayout = true;
+    Unique<PropertyWatcher> m_repaintWatcher;
+    Unique<PropertyWatcher> m_layoutWatcher;
+};
+
+} // namespace Aurora
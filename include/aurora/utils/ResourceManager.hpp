@@ -0,0 +1,69 @@
+// ============================================
+// include/aurora/utils/ResourceManager.hpp
+// ============================================
+#pragma once
+#include "../core/Name.hpp"
+#include "../core/Types.hpp"
+#include <unordered_map>
+
+namespace Aurora {
+
+// Shared resources (shaders, textures, meshes, ...) keyed by type and Name.
+// Lookups hash a 4-byte id instead of a string. Main thread only.
+class ResourceManager {
+public:
+    static ResourceManager& instance();
+
+    template<typename T>
+    void add(Name key, Ref<T> resource) {
+        m_resources[{key, typeTag<T>()}] = std::move(resource);
+    }
+
+    template<typename T>
+    Ref<T> get(Name key) const {
+        auto it = m_resources.find({key, typeTag<T>()});
+        return it != m_resources.end() ? std::static_pointer_cast<T>(it->second) : nullptr;
+    }
+
+    // Return the cached resource, loading and caching it on first use
+    template<typename T, typename Load>
+    Ref<T> getOrLoad(Name key, Load&& load) {
+        Ref<void>& slot = m_resources[{key, typeTag<T>()}];
+        if (!slot) {
+            slot = load();
+        }
+        return std::static_pointer_cast<T>(slot);
+    }
+
+    template<typename T>
+    bool remove(Name key) {
+        return m_resources.erase({key, typeTag<T>()}) > 0;
+    }
+
+    void clear();
+    size_t size() const { return m_resources.size(); }
+
+private:
+    struct Key {
+        Name name;
+        const void* type;
+        bool operator==(const Key& o) const { return name == o.name && type == o.type; }
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const {
+            return std::hash<const void*>()(key.type) ^ ((size_t)key.name.id() * 0x9E3779B97F4A7C15ull);
+        }
+    };
+
+    // One distinct address per resource type, no RTTI needed
+    template<typename T>
+    static const void* typeTag() {
+        static const char tag = 0;
+        return &tag;
+    }
+
+    std::unordered_map<Key, Ref<void>, KeyHash> m_resources;
+};
+
+} // namespace Aurora
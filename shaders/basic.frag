@@ -0,0 +1,78 @@
+#version 330 core
+
+// Compiled per feature set; Material picks the cheapest variant:
+//   FEATURE_TEXTURED   sample uTexture
+//   FEATURE_ROUNDED    rounded-corner coverage (uRadius)
+//   FEATURE_BORDER     border of uBorderWidth in uBorderColor (needs ROUNDED's SDF)
+//   FEATURE_GRADIENT   linear blend from uColor to uGradientEnd
+//   BLUR_TAPS n        n-tap Gaussian along uBlurDirection (needs TEXTURED)
+
+in vec2 vTexCoord;
+in vec4 vColor;
+
+out vec4 fragColor;
+
+// Shared by every variant; members a variant compiles out are ignored
+layout(std140) uniform MaterialUniforms {
+    vec4 uColor;
+    vec2 uSize;
+    float uRadius;
+    float uBorderWidth;
+    vec4 uBorderColor;
+    vec4 uGradientEnd;
+    vec2 uGradientDirection;
+    vec2 uBlurDirection;    // Texel step, already divided by texture size
+    float uBlurSigma;
+};
+
+#ifdef FEATURE_TEXTURED
+uniform sampler2D uTexture;
+#endif
+
+#if defined(FEATURE_ROUNDED) || defined(FEATURE_BORDER)
+float roundedBoxDistance(vec2 p, vec2 halfSize, float radius) {
+    vec2 q = abs(p) - halfSize + radius;
+    return min(max(q.x, q.y), 0.0) + length(max(q, 0.0)) - radius;
+}
+#endif
+
+#if defined(BLUR_TAPS) && defined(FEATURE_TEXTURED)
+vec4 blurSample(vec2 uv) {
+    const int halfTaps = BLUR_TAPS / 2;
+    vec4 sum = vec4(0.0);
+    float weight = 0.0;
+    for (int i = -halfTaps; i <= halfTaps; ++i) {
+        float w = exp(-float(i * i) / (2.0 * uBlurSigma * uBlurSigma));
+        sum += texture(uTexture, uv + uBlurDirection * float(i)) * w;
+        weight += w;
+    }
+    return sum / weight;
+}
+#endif
+
+void main() {
+    vec4 color = uColor * vColor;
+
+#ifdef FEATURE_GRADIENT
+    float t = clamp(dot(vTexCoord - 0.5, uGradientDirection) + 0.5, 0.0, 1.0);
+    color = mix(uColor, uGradientEnd, t) * vColor;
+#endif
+
+#if defined(BLUR_TAPS) && defined(FEATURE_TEXTURED)
+    color *= blurSample(vTexCoord);
+#elif defined(FEATURE_TEXTURED)
+    color *= texture(uTexture, vTexCoord);
+#endif
+
+#if defined(FEATURE_ROUNDED) || defined(FEATURE_BORDER)
+    vec2 p = (vTexCoord - 0.5) * uSize;
+    float d = roundedBoxDistance(p, uSize * 0.5, uRadius);
+#ifdef FEATURE_BORDER
+    float inner = clamp(0.5 - (d + uBorderWidth), 0.0, 1.0);
+    color = mix(uBorderColor, color, inner);
+#endif
+    color.a *= clamp(0.5 - d, 0.0, 1.0);
+#endif
+
+    fragColor = color;
+}
@@ -0,0 +1,23 @@
+#version 330 core
+
+layout(location = 0) in vec2 aPosition;
+layout(location = 1) in vec2 aTexCoord;
+layout(location = 2) in vec4 aColor;
+
+layout(std140) uniform FrameUniforms {
+    mat4 uProjection;
+    mat4 uView;
+    vec4 uViewport;
+    float uTime;
+};
+
+uniform mat4 uModel;
+
+out vec2 vTexCoord;
+out vec4 vColor;
+
+void main() {
+    vTexCoord = aTexCoord;
+    vColor = aColor;
+    gl_Position = uProjection * uView * uModel * vec4(aPosition, 0.0, 1.0);
+}
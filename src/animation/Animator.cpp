@@ -0,0 +1,283 @@
+// ============================================
+// src/animation/Animator.cpp
+// ============================================
+#include "aurora/animation/Animator.hpp"
+#include <algorithm>
+#include <iostream>
+
+namespace Aurora {
+
+namespace {
+
+constexpr f32 kMinDuration = 1e-6f;
+
+template<typename T>
+bool hasTarget(const Tween<T>& tween) {
+    if (!tween.target) {
+        std::cerr << "[Animator] Tween without a target ignored" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+TweenId makeId(u32 slot, u32 generation) {
+    return ((u64)generation << 32) | slot;
+}
+
+} // namespace
+
+Animator::Animator() = default;
+
+Animator::~Animator() = default;
+
+TweenId Animator::start(const Tween<f32>& tween) {
+    if (!hasTarget(tween)) {
+        return 0;
+    }
+    f32* targets[1] = {tween.target};
+    return insert(m_floatStores[(size_t)tween.easing], tween.easing,
+                  tween.duration, tween.delay, &tween.from, &tween.to,
+                  targets, tween.onComplete);
+}
+
+TweenId Animator::start(const Tween<Vec2>& tween) {
+    if (!hasTarget(tween)) {
+        return 0;
+    }
+    f32 from[2] = {tween.from.x, tween.from.y};
+    f32 to[2] = {tween.to.x, tween.to.y};
+    f32* targets[2] = {&tween.target->x, &tween.target->y};
+    return insert(m_vec2Stores[(size_t)tween.easing], tween.easing,
+                  tween.duration, tween.delay, from, to, targets, tween.onComplete);
+}
+
+TweenId Animator::start(const Tween<Color>& tween) {
+    if (!hasTarget(tween)) {
+        return 0;
+    }
+    f32 from[4] = {tween.from.r, tween.from.g, tween.from.b, tween.from.a};
+    f32 to[4] = {tween.to.r, tween.to.g, tween.to.b, tween.to.a};
+    f32* targets[4] = {&tween.target->r, &tween.target->g,
+                       &tween.target->b, &tween.target->a};
+    return insert(m_colorStores[(size_t)tween.easing], tween.easing,
+                  tween.duration, tween.delay, from, to, targets, tween.onComplete);
+}
+
+template<u32 Lanes>
+TweenId Animator::insert(Store<Lanes>& store, Easing::Type easing, f32 duration, f32 delay,
+                         const f32* from, const f32* to, f32* const* targets,
+                         std::function<void()> onComplete) {
+    u32 slotIndex;
+    if (!m_freeSlots.empty()) {
+        slotIndex = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    } else {
+        slotIndex = (u32)m_slots.size();
+        m_slots.emplace_back();
+    }
+
+    Slot& slot = m_slots[slotIndex];
+    slot.index = (u32)store.size();
+    slot.lanes = (u8)Lanes;
+    slot.easing = easing;
+    slot.onComplete = std::move(onComplete);
+
+    store.time.push_back(-std::max(delay, 0.0f));
+    store.invDuration.push_back(1.0f / std::max(duration, kMinDuration));
+    store.progress.push_back(0.0f);
+    store.slots.push_back(slotIndex);
+    for (u32 k = 0; k < Lanes; ++k) {
+        store.from[k].push_back(from[k]);
+        store.delta[k].push_back(to[k] - from[k]);
+        store.target[k].push_back(targets[k]);
+    }
+
+    ++m_activeCount;
+    return makeId(slotIndex, slot.generation);
+}
+
+template<u32 Lanes>
+void Animator::tick(Store<Lanes>& store, Easing::Type easing, f32 deltaTime) {
+    const size_t count = store.size();
+    if (count == 0) {
+        return;
+    }
+
+    f32* time = store.time.data();
+    const f32* invDuration = store.invDuration.data();
+    f32* progress = store.progress.data();
+
+    for (size_t i = 0; i < count; ++i) {
+        time[i] += deltaTime;
+        progress[i] = std::clamp(time[i] * invDuration[i], 0.0f, 1.0f);
+    }
+
+    // Finished tweens are detected before easing overwrites the linear progress
+    bool anyFinished = false;
+    for (size_t i = 0; i < count; ++i) {
+        anyFinished |= progress[i] >= 1.0f;
+    }
+
+    Easing::evaluate(easing, progress, progress, count);
+
+    for (u32 k = 0; k < Lanes; ++k) {
+        const f32* from = store.from[k].data();
+        const f32* delta = store.delta[k].data();
+        f32* const* target = store.target[k].data();
+        for (size_t i = 0; i < count; ++i) {
+            *target[i] = from[i] + delta[i] * progress[i];
+        }
+    }
+
+    if (!anyFinished) {
+        return;
+    }
+
+    // Walk backwards so swap-removal never skips an entry
+    for (size_t i = count; i-- > 0;) {
+        if (time[i] * invDuration[i] < 1.0f) {
+            continue;
+        }
+        for (u32 k = 0; k < Lanes; ++k) {
+            *store.target[k][i] = store.from[k][i] + store.delta[k][i];
+        }
+        Slot& slot = m_slots[store.slots[i]];
+        if (slot.onComplete) {
+            m_completed.push_back(std::move(slot.onComplete));
+        }
+        remove(store, (u32)i);
+    }
+}
+
+template<u32 Lanes>
+void Animator::remove(Store<Lanes>& store, u32 index) {
+    u32 last = (u32)store.size() - 1;
+    u32 slotIndex = store.slots[index];
+
+    if (index != last) {
+        store.time[index] = store.time[last];
+        store.invDuration[index] = store.invDuration[last];
+        store.slots[index] = store.slots[last];
+        for (u32 k = 0; k < Lanes; ++k) {
+            store.from[k][index] = store.from[k][last];
+            store.delta[k][index] = store.delta[k][last];
+            store.target[k][index] = store.target[k][last];
+        }
+        m_slots[store.slots[index]].index = index;
+    }
+
+    store.time.pop_back();
+    store.invDuration.pop_back();
+    store.progress.pop_back();
+    store.slots.pop_back();
+    for (u32 k = 0; k < Lanes; ++k) {
+        store.from[k].pop_back();
+        store.delta[k].pop_back();
+        store.target[k].pop_back();
+    }
+
+    releaseSlot(slotIndex);
+    --m_activeCount;
+}
+
+template<typename F>
+void Animator::withStore(const Slot& slot, F&& fn) {
+    size_t curve = (size_t)slot.easing;
+    switch (slot.lanes) {
+        case 1: fn(m_floatStores[curve]); break;
+        case 2: fn(m_vec2Stores[curve]); break;
+        case 4: fn(m_colorStores[curve]); break;
+        default: break;
+    }
+}
+
+void Animator::cancel(TweenId id) {
+    const Slot* slot = lookup(id);
+    if (!slot) {
+        return;
+    }
+    u32 index = slot->index;
+    withStore(*slot, [&](auto& store) { remove(store, index); });
+}
+
+void Animator::finish(TweenId id) {
+    const Slot* slot = lookup(id);
+    if (!slot) {
+        return;
+    }
+    u32 index = slot->index;
+    std::function<void()> onComplete = std::move(m_slots[id & 0xFFFFFFFFu].onComplete);
+    withStore(*slot, [&](auto& store) {
+        for (size_t k = 0; k < std::size(store.target); ++k) {
+            *store.target[k][index] = store.from[k][index] + store.delta[k][index];
+        }
+        remove(store, index);
+    });
+    if (onComplete) {
+        onComplete();
+    }
+}
+
+bool Animator::isActive(TweenId id) const {
+    return lookup(id) != nullptr;
+}
+
+void Animator::clear() {
+    auto reset = [](auto& stores) {
+        for (auto& store : stores) {
+            store = {};
+        }
+    };
+    reset(m_floatStores);
+    reset(m_vec2Stores);
+    reset(m_colorStores);
+    m_completed.clear();
+
+    for (u32 i = 0; i < m_slots.size(); ++i) {
+        if (m_slots[i].lanes != 0) {
+            releaseSlot(i);
+        }
+    }
+    m_activeCount = 0;
+}
+
+void Animator::update(f32 deltaTime) {
+    for (size_t curve = 0; curve < kCurveCount; ++curve) {
+        Easing::Type easing = (Easing::Type)curve;
+        tick(m_floatStores[curve], easing, deltaTime);
+        tick(m_vec2Stores[curve], easing, deltaTime);
+        tick(m_colorStores[curve], easing, deltaTime);
+    }
+
+    // Callbacks run after the pass so they may start or cancel tweens
+    if (!m_completed.empty()) {
+        std::vector<std::function<void()>> completed;
+        completed.swap(m_completed);
+        for (auto& callback : completed) {
+            callback();
+        }
+    }
+}
+
+const Animator::Slot* Animator::lookup(TweenId id) const {
+    u32 slotIndex = (u32)(id & 0xFFFFFFFFu);
+    u32 generation = (u32)(id >> 32);
+    if (slotIndex >= m_slots.size()) {
+        return nullptr;
+    }
+    const Slot& slot = m_slots[slotIndex];
+    if (slot.lanes == 0 || slot.generation != generation) {
+        return nullptr;
+    }
+    return &slot;
+}
+
+void Animator::releaseSlot(u32 slotIndex) {
+    Slot& slot = m_slots[slotIndex];
+    slot.lanes = 0;
+    slot.onComplete = nullptr;
+    ++slot.generation;
+    m_freeSlots.push_back(slotIndex);
+}
+
+} // namespace Aurora
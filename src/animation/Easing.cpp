@@ -0,0 +1,239 @@
+// ============================================
+// src/animation/Easing.cpp
+// ============================================
+#include "aurora/animation/Easing.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <unordered_map>
+
+namespace Aurora {
+
+namespace {
+
+using CurveFn = f32 (*)(f32);
+
+const CurveFn s_curves[] = {
+    Easing::linear,
+    Easing::quadIn, Easing::quadOut, Easing::quadInOut,
+    Easing::cubicIn, Easing::cubicOut, Easing::cubicInOut,
+    Easing::elasticIn, Easing::elasticOut,
+    Easing::bounceIn, Easing::bounceOut,
+    Easing::backIn, Easing::backOut,
+};
+static_assert(sizeof(s_curves) / sizeof(s_curves[0]) == (size_t)Easing::Type::Count,
+              "Easing curve table out of sync with Easing::Type");
+
+// The curve is a template argument so the loop body inlines and
+// the polynomial curves auto-vectorize
+template<CurveFn F>
+void evaluateBatch(const f32* t, f32* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = F(t[i]);
+    }
+}
+
+const std::unordered_map<std::string, Easing::Type>& curveNames() {
+    static const std::unordered_map<std::string, Easing::Type> names = {
+        {"linear", Easing::Type::Linear},
+        {"quadIn", Easing::Type::QuadIn},
+        {"quadOut", Easing::Type::QuadOut},
+        {"quadInOut", Easing::Type::QuadInOut},
+        {"cubicIn", Easing::Type::CubicIn},
+        {"cubicOut", Easing::Type::CubicOut},
+        {"cubicInOut", Easing::Type::CubicInOut},
+        {"elasticIn", Easing::Type::ElasticIn},
+        {"elasticOut", Easing::Type::ElasticOut},
+        {"bounceIn", Easing::Type::BounceIn},
+        {"bounceOut", Easing::Type::BounceOut},
+        {"backIn", Easing::Type::BackIn},
+        {"backOut", Easing::Type::BackOut},
+    };
+    return names;
+}
+
+// Solve x(s) = x for a unit cubic bezier with P0 = (0,0), P3 = (1,1)
+struct BezierSolver {
+    f32 ax, bx, cx;
+    f32 ay, by, cy;
+
+    BezierSolver(f32 x1, f32 y1, f32 x2, f32 y2) {
+        cx = 3 * x1; bx = 3 * (x2 - x1) - cx; ax = 1 - cx - bx;
+        cy = 3 * y1; by = 3 * (y2 - y1) - cy; ay = 1 - cy - by;
+    }
+
+    f32 curveX(f32 s) const { return ((ax * s + bx) * s + cx) * s; }
+    f32 curveY(f32 s) const { return ((ay * s + by) * s + cy) * s; }
+    f32 slopeX(f32 s) const { return (3 * ax * s + 2 * bx) * s + cx; }
+
+    f32 solve(f32 x) const {
+        // Newton first, bisection when the slope flattens out
+        f32 s = x;
+        for (int i = 0; i < 8; ++i) {
+            f32 err = curveX(s) - x;
+            if (std::fabs(err) < 1e-6f) return curveY(s);
+            f32 d = slopeX(s);
+            if (std::fabs(d) < 1e-6f) break;
+            s -= err / d;
+        }
+        f32 lo = 0, hi = 1;
+        s = x;
+        for (int i = 0; i < 32; ++i) {
+            f32 cur = curveX(s);
+            if (std::fabs(cur - x) < 1e-6f) break;
+            if (cur < x) lo = s; else hi = s;
+            s = (lo + hi) * 0.5f;
+        }
+        return curveY(s);
+    }
+};
+
+// Baked tables shared by EasingCurve handles; entries are never freed
+// so handles stay valid for the lifetime of the process
+class TableCache {
+public:
+    using Key = std::tuple<int, u32, f32, f32, f32, f32>;
+
+    template<typename Make>
+    const EasingTable* get(const Key& key, Make&& make) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_tables.find(key);
+        if (it == m_tables.end()) {
+            it = m_tables.emplace(key, std::make_unique<EasingTable>(make())).first;
+        }
+        return it->second.get();
+    }
+
+    static TableCache& instance() {
+        static TableCache cache;
+        return cache;
+    }
+
+private:
+    std::mutex m_mutex;
+    std::map<Key, Unique<EasingTable>> m_tables;
+};
+
+constexpr int kBezierKey = -1;
+
+} // namespace
+
+f32 Easing::evaluate(Type type, f32 t) {
+    return s_curves[(size_t)type](t);
+}
+
+void Easing::evaluate(Type type, const f32* t, f32* out, size_t count) {
+    switch (type) {
+        case Type::Linear:     evaluateBatch<linear>(t, out, count); break;
+        case Type::QuadIn:     evaluateBatch<quadIn>(t, out, count); break;
+        case Type::QuadOut:    evaluateBatch<quadOut>(t, out, count); break;
+        case Type::QuadInOut:  evaluateBatch<quadInOut>(t, out, count); break;
+        case Type::CubicIn:    evaluateBatch<cubicIn>(t, out, count); break;
+        case Type::CubicOut:   evaluateBatch<cubicOut>(t, out, count); break;
+        case Type::CubicInOut: evaluateBatch<cubicInOut>(t, out, count); break;
+        case Type::ElasticIn:  evaluateBatch<elasticIn>(t, out, count); break;
+        case Type::ElasticOut: evaluateBatch<elasticOut>(t, out, count); break;
+        case Type::BounceIn:   evaluateBatch<bounceIn>(t, out, count); break;
+        case Type::BounceOut:  evaluateBatch<bounceOut>(t, out, count); break;
+        case Type::BackIn:     evaluateBatch<backIn>(t, out, count); break;
+        case Type::BackOut:    evaluateBatch<backOut>(t, out, count); break;
+        case Type::Count:      break;
+    }
+}
+
+Easing::Function Easing::getFunction(const std::string& name) {
+    return EasingCurve::fromName(name);
+}
+
+Easing::Type Easing::typeFromName(const std::string& name, Type fallback) {
+    auto it = curveNames().find(name);
+    return it != curveNames().end() ? it->second : fallback;
+}
+
+// ---- EasingTable ----
+
+EasingTable::EasingTable(const std::function<f32(f32)>& curve, u32 resolution) {
+    resize(resolution);
+    for (u32 i = 0; i <= m_last; ++i) {
+        m_samples[i] = curve((f32)i / m_scale);
+    }
+}
+
+EasingTable EasingTable::bake(Easing::Type type, u32 resolution) {
+    EasingTable table;
+    table.resize(resolution);
+    for (u32 i = 0; i <= table.m_last; ++i) {
+        table.m_samples[i] = (f32)i / table.m_scale;
+    }
+    Easing::evaluate(type, table.m_samples.data(), table.m_samples.data(),
+                     table.m_samples.size());
+    return table;
+}
+
+EasingTable EasingTable::cubicBezier(f32 x1, f32 y1, f32 x2, f32 y2, u32 resolution) {
+    BezierSolver solver(std::clamp(x1, 0.0f, 1.0f), y1, std::clamp(x2, 0.0f, 1.0f), y2);
+    EasingTable table;
+    table.resize(resolution);
+    for (u32 i = 0; i <= table.m_last; ++i) {
+        table.m_samples[i] = solver.solve((f32)i / table.m_scale);
+    }
+    table.m_samples.front() = 0;
+    table.m_samples.back() = 1;
+    return table;
+}
+
+void EasingTable::sample(const f32* t, f32* out, size_t count) const {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = sample(t[i]);
+    }
+}
+
+void EasingTable::resize(u32 resolution) {
+    resolution = std::max(resolution, 2u);
+    m_samples.assign(resolution, 0.0f);
+    m_last = resolution - 1;
+    m_scale = (f32)m_last;
+}
+
+// ---- EasingCurve ----
+
+EasingCurve EasingCurve::baked(Easing::Type type, u32 resolution) {
+    TableCache::Key key{(int)type, resolution, 0, 0, 0, 0};
+    const EasingTable* table = TableCache::instance().get(key, [&] {
+        return EasingTable::bake(type, resolution);
+    });
+    return EasingCurve(type, table);
+}
+
+EasingCurve EasingCurve::cubicBezier(f32 x1, f32 y1, f32 x2, f32 y2, u32 resolution) {
+    TableCache::Key key{kBezierKey, resolution, x1, y1, x2, y2};
+    const EasingTable* table = TableCache::instance().get(key, [&] {
+        return EasingTable::cubicBezier(x1, y1, x2, y2, resolution);
+    });
+    return EasingCurve(Easing::Type::Linear, table);
+}
+
+EasingCurve EasingCurve::fromName(const std::string& name) {
+    f32 x1, y1, x2, y2;
+    if (std::sscanf(name.c_str(), " cubic-bezier ( %f , %f , %f , %f )", &x1, &y1, &x2, &y2) == 4) {
+        return cubicBezier(x1, y1, x2, y2);
+    }
+    // CSS keywords
+    if (name == "ease") return cubicBezier(0.25f, 0.1f, 0.25f, 1.0f);
+    if (name == "ease-in") return cubicBezier(0.42f, 0.0f, 1.0f, 1.0f);
+    if (name == "ease-out") return cubicBezier(0.0f, 0.0f, 0.58f, 1.0f);
+    if (name == "ease-in-out") return cubicBezier(0.42f, 0.0f, 0.58f, 1.0f);
+    return EasingCurve(Easing::typeFromName(name));
+}
+
+void EasingCurve::evaluate(const f32* t, f32* out, size_t count) const {
+    if (m_table) {
+        m_table->sample(t, out, count);
+    } else {
+        Easing::evaluate(m_type, t, out, count);
+    }
+}
+
+} // namespace Aurora
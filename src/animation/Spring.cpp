@@ -0,0 +1,391 @@
+// ============================================
+// src/animation/Spring.cpp
+// ============================================
+#include "aurora/animation/Spring.hpp"
+#include <algorithm>
+
+namespace Aurora {
+
+namespace {
+
+// Exact state transition for a damped harmonic oscillator over dt:
+//   [offset', velocity'] = P * [offset, velocity], offset = position - target
+// Config::damping is the damping coefficient c in m*x'' + c*x' + k*x = 0.
+struct Propagator {
+    f32 pp, pv;
+    f32 vp, vv;
+};
+
+Propagator computePropagator(const Spring::Config& config, f32 deltaTime) {
+    const f64 t = deltaTime;
+    const f64 m = std::max((f64)config.mass, 1e-6);
+    const f64 k = std::max((f64)config.stiffness, 0.0);
+    const f64 c = std::max((f64)config.damping, 0.0);
+
+    if (k <= 0.0) {
+        // No restoring force: velocity decays, offset drifts
+        f64 a = c / m;
+        f64 e = std::exp(-a * t);
+        return {1.0f, (f32)(a > 0.0 ? (1.0 - e) / a : t), 0.0f, (f32)e};
+    }
+
+    const f64 omega = std::sqrt(k / m);
+    const f64 zeta = c / (2.0 * std::sqrt(k * m));
+
+    if (zeta < 1.0 - 1e-4) {
+        // Underdamped
+        f64 wd = omega * std::sqrt(1.0 - zeta * zeta);
+        f64 a = zeta * omega;
+        f64 e = std::exp(-a * t);
+        f64 cs = std::cos(wd * t);
+        f64 sn = std::sin(wd * t);
+        return {(f32)(e * (cs + a * sn / wd)), (f32)(e * sn / wd),
+                (f32)(-e * omega * omega * sn / wd), (f32)(e * (cs - a * sn / wd))};
+    }
+
+    if (zeta > 1.0 + 1e-4) {
+        // Overdamped
+        f64 root = omega * std::sqrt(zeta * zeta - 1.0);
+        f64 r1 = -zeta * omega + root;
+        f64 r2 = -zeta * omega - root;
+        f64 e1 = std::exp(r1 * t);
+        f64 e2 = std::exp(r2 * t);
+        f64 inv = 1.0 / (r1 - r2);
+        return {(f32)((r1 * e2 - r2 * e1) * inv), (f32)((e1 - e2) * inv),
+                (f32)(r1 * r2 * (e2 - e1) * inv), (f32)((r1 * e1 - r2 * e2) * inv)};
+    }
+
+    // Critically damped
+    f64 e = std::exp(-omega * t);
+    return {(f32)(e * (1.0 + omega * t)), (f32)(e * t),
+            (f32)(-e * omega * omega * t), (f32)(e * (1.0 - omega * t))};
+}
+
+bool sameConfig(const Spring::Config& a, const Spring::Config& b) {
+    return a.stiffness == b.stiffness && a.damping == b.damping && a.mass == b.mass;
+}
+
+} // namespace
+
+// ---- Spring ----
+
+Spring::Spring() : Spring(Config()) {}
+
+Spring::Spring(const Config& config)
+    : m_config(config),
+      m_position(config.restLength),
+      m_velocity(config.initialVelocity),
+      m_target(config.restLength) {}
+
+void Spring::update(f32 deltaTime) {
+    if (deltaTime <= 0) {
+        return;
+    }
+    Propagator p = computePropagator(m_config, deltaTime);
+    f32 offset = m_position - m_target;
+    f32 velocity = m_velocity;
+    m_position = m_target + p.pp * offset + p.pv * velocity;
+    m_velocity = p.vp * offset + p.vv * velocity;
+}
+
+void Spring::applyImpulse(f32 force) {
+    m_velocity += force / std::max(m_config.mass, 1e-6f);
+}
+
+void Spring::reset(f32 position, f32 velocity) {
+    m_position = position;
+    m_velocity = velocity;
+}
+
+bool Spring::isAtRest(f32 threshold) const {
+    return std::fabs(m_velocity) < threshold &&
+           std::fabs(m_position - m_target) < threshold;
+}
+
+// ---- Spring2D ----
+
+Spring2D::Spring2D(const Spring::Config& config)
+    : m_springX(config), m_springY(config) {}
+
+void Spring2D::update(f32 deltaTime) {
+    m_springX.update(deltaTime);
+    m_springY.update(deltaTime);
+}
+
+void Spring2D::setTarget(const Vec2& target) {
+    m_springX.setTarget(target.x);
+    m_springY.setTarget(target.y);
+}
+
+void Spring2D::reset(const Vec2& position, const Vec2& velocity) {
+    m_springX.reset(position.x, velocity.x);
+    m_springY.reset(position.y, velocity.y);
+}
+
+bool Spring2D::isAtRest(f32 threshold) const {
+    return m_springX.isAtRest(threshold) && m_springY.isAtRest(threshold);
+}
+
+// ---- SpringSystem ----
+
+SpringSystem::SpringSystem() = default;
+
+SpringSystem::~SpringSystem() = default;
+
+SpringId SpringSystem::add(const Spring::Config& config, f32 position, f32 target,
+                           f32* output) {
+    u32 slotIndex;
+    if (!m_freeSlots.empty()) {
+        slotIndex = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    } else {
+        slotIndex = (u32)m_slots.size();
+        m_slots.emplace_back();
+    }
+
+    Slot& slot = m_slots[slotIndex];
+    slot.used = true;
+    slot.resting = true;
+    slot.bucket = findBucket(config);
+    slot.position = position;
+    slot.target = target;
+    slot.output = output;
+    ++m_springCount;
+
+    if (output) {
+        *output = position;
+    }
+    if (position != target || config.initialVelocity != 0) {
+        wake(slotIndex);
+        m_buckets[slot.bucket].velocity[slot.index] = config.initialVelocity;
+    }
+    return ((u64)slot.generation << 32) | slotIndex;
+}
+
+void SpringSystem::remove(SpringId id) {
+    Slot* slot = lookup(id);
+    if (!slot) {
+        return;
+    }
+    if (!slot->resting) {
+        removeFromBucket(m_buckets[slot->bucket], slot->index);
+    }
+    releaseSlot((u32)(id & 0xFFFFFFFFu));
+    --m_springCount;
+}
+
+void SpringSystem::clear() {
+    m_buckets.clear();
+
+    // Slots are kept so their bumped generations invalidate old ids
+    for (u32 i = 0; i < m_slots.size(); ++i) {
+        if (m_slots[i].used) {
+            releaseSlot(i);
+        }
+    }
+    m_springCount = 0;
+    m_movingCount = 0;
+}
+
+void SpringSystem::setTarget(SpringId id, f32 target) {
+    Slot* slot = lookup(id);
+    if (!slot) {
+        return;
+    }
+    if (slot->resting) {
+        slot->target = target;
+        if (target != slot->position) {
+            wake((u32)(id & 0xFFFFFFFFu));
+        }
+        return;
+    }
+    m_buckets[slot->bucket].target[slot->index] = target;
+}
+
+void SpringSystem::applyImpulse(SpringId id, f32 force) {
+    Slot* slot = lookup(id);
+    if (!slot) {
+        return;
+    }
+    wake((u32)(id & 0xFFFFFFFFu));
+    Bucket& bucket = m_buckets[slot->bucket];
+    bucket.velocity[slot->index] += force / std::max(bucket.config.mass, 1e-6f);
+}
+
+void SpringSystem::reset(SpringId id, f32 position, f32 velocity) {
+    Slot* slot = lookup(id);
+    if (!slot) {
+        return;
+    }
+    if (slot->resting) {
+        slot->position = position;
+        if (slot->output) {
+            *slot->output = position;
+        }
+        if (position == slot->target && velocity == 0) {
+            return;
+        }
+        wake((u32)(id & 0xFFFFFFFFu));
+    }
+    Bucket& bucket = m_buckets[slot->bucket];
+    bucket.position[slot->index] = position;
+    bucket.velocity[slot->index] = velocity;
+}
+
+f32 SpringSystem::position(SpringId id) const {
+    const Slot* slot = lookup(id);
+    if (!slot) {
+        return 0;
+    }
+    return slot->resting ? slot->position : m_buckets[slot->bucket].position[slot->index];
+}
+
+f32 SpringSystem::velocity(SpringId id) const {
+    const Slot* slot = lookup(id);
+    if (!slot || slot->resting) {
+        return 0;
+    }
+    return m_buckets[slot->bucket].velocity[slot->index];
+}
+
+f32 SpringSystem::target(SpringId id) const {
+    const Slot* slot = lookup(id);
+    if (!slot) {
+        return 0;
+    }
+    return slot->resting ? slot->target : m_buckets[slot->bucket].target[slot->index];
+}
+
+bool SpringSystem::isAtRest(SpringId id) const {
+    const Slot* slot = lookup(id);
+    return !slot || slot->resting;
+}
+
+bool SpringSystem::contains(SpringId id) const {
+    return lookup(id) != nullptr;
+}
+
+void SpringSystem::update(f32 deltaTime) {
+    if (deltaTime <= 0) {
+        return;
+    }
+
+    const f32 threshold = m_restThreshold;
+    for (Bucket& bucket : m_buckets) {
+        const size_t count = bucket.size();
+        if (count == 0) {
+            continue;
+        }
+
+        const Propagator p = computePropagator(bucket.config, deltaTime);
+        f32* position = bucket.position.data();
+        f32* velocity = bucket.velocity.data();
+        const f32* target = bucket.target.data();
+
+        for (size_t i = 0; i < count; ++i) {
+            f32 offset = position[i] - target[i];
+            f32 v = velocity[i];
+            position[i] = target[i] + p.pp * offset + p.pv * v;
+            velocity[i] = p.vp * offset + p.vv * v;
+        }
+
+        f32* const* output = bucket.output.data();
+        for (size_t i = 0; i < count; ++i) {
+            if (output[i]) {
+                *output[i] = position[i];
+            }
+        }
+
+        // Walk backwards so swap-removal never skips an entry
+        for (size_t i = count; i-- > 0;) {
+            if (std::fabs(velocity[i]) < threshold &&
+                std::fabs(position[i] - target[i]) < threshold) {
+                retire(bucket, (u32)i);
+            }
+        }
+    }
+}
+
+SpringSystem::Slot* SpringSystem::lookup(SpringId id) {
+    return const_cast<Slot*>(static_cast<const SpringSystem*>(this)->lookup(id));
+}
+
+const SpringSystem::Slot* SpringSystem::lookup(SpringId id) const {
+    u32 slotIndex = (u32)(id & 0xFFFFFFFFu);
+    u32 generation = (u32)(id >> 32);
+    if (slotIndex >= m_slots.size()) {
+        return nullptr;
+    }
+    const Slot& slot = m_slots[slotIndex];
+    if (!slot.used || slot.generation != generation) {
+        return nullptr;
+    }
+    return &slot;
+}
+
+u32 SpringSystem::findBucket(const Spring::Config& config) {
+    for (u32 i = 0; i < m_buckets.size(); ++i) {
+        if (sameConfig(m_buckets[i].config, config)) {
+            return i;
+        }
+    }
+    m_buckets.emplace_back();
+    m_buckets.back().config = config;
+    return (u32)m_buckets.size() - 1;
+}
+
+void SpringSystem::releaseSlot(u32 slotIndex) {
+    Slot& slot = m_slots[slotIndex];
+    slot.used = false;
+    slot.output = nullptr;
+    ++slot.generation;
+    m_freeSlots.push_back(slotIndex);
+}
+
+void SpringSystem::wake(u32 slotIndex) {
+    Slot& slot = m_slots[slotIndex];
+    if (!slot.resting) {
+        return;
+    }
+    Bucket& bucket = m_buckets[slot.bucket];
+    slot.resting = false;
+    slot.index = (u32)bucket.size();
+    bucket.position.push_back(slot.position);
+    bucket.velocity.push_back(0);
+    bucket.target.push_back(slot.target);
+    bucket.output.push_back(slot.output);
+    bucket.slots.push_back(slotIndex);
+    ++m_movingCount;
+}
+
+void SpringSystem::retire(Bucket& bucket, u32 index) {
+    Slot& slot = m_slots[bucket.slots[index]];
+    slot.resting = true;
+    slot.position = bucket.target[index];
+    slot.target = bucket.target[index];
+    slot.output = bucket.output[index];
+    if (slot.output) {
+        *slot.output = slot.position;
+    }
+    removeFromBucket(bucket, index);
+}
+
+void SpringSystem::removeFromBucket(Bucket& bucket, u32 index) {
+    u32 last = (u32)bucket.size() - 1;
+    if (index != last) {
+        bucket.position[index] = bucket.position[last];
+        bucket.velocity[index] = bucket.velocity[last];
+        bucket.target[index] = bucket.target[last];
+        bucket.output[index] = bucket.output[last];
+        bucket.slots[index] = bucket.slots[last];
+        m_slots[bucket.slots[index]].index = index;
+    }
+    bucket.position.pop_back();
+    bucket.velocity.pop_back();
+    bucket.target.pop_back();
+    bucket.output.pop_back();
+    bucket.slots.pop_back();
+    --m_movingCount;
+}
+
+} // namespace Aurora
@@ -0,0 +1,229 @@
+// ============================================
+// src/animation/Timeline.cpp
+// ============================================
+#include "aurora/animation/Timeline.hpp"
+#include <algorithm>
+
+namespace Aurora {
+
+// ---- Animation ----
+
+void Animation::start() {
+    m_state = State::Playing;
+    m_reversing = m_reverse;
+    m_currentTime = m_reversing ? m_duration : 0;
+    if (onStart) onStart();
+    onAnimate(progress());
+}
+
+void Animation::stop() {
+    m_state = State::Idle;
+    m_currentTime = 0;
+}
+
+void Animation::pause() {
+    if (m_state == State::Playing) {
+        m_state = State::Paused;
+    }
+}
+
+void Animation::resume() {
+    if (m_state == State::Paused) {
+        m_state = State::Playing;
+    }
+}
+
+void Animation::update(f32 deltaTime) {
+    if (m_state != State::Playing) {
+        return;
+    }
+
+    f32 step = deltaTime * m_speed;
+    m_currentTime += m_reversing ? -step : step;
+
+    bool finished = false;
+    if (m_currentTime >= m_duration || m_currentTime <= 0) {
+        if (m_loop) {
+            if (m_pingPong) {
+                m_reversing = !m_reversing;
+                m_currentTime = std::clamp(m_currentTime, 0.0f, m_duration);
+            } else if (m_duration > 0) {
+                m_currentTime = m_reversing ? m_currentTime + m_duration
+                                            : m_currentTime - m_duration;
+                m_currentTime = std::clamp(m_currentTime, 0.0f, m_duration);
+            }
+        } else if (m_reversing ? m_currentTime <= 0 : m_currentTime >= m_duration) {
+            m_currentTime = std::clamp(m_currentTime, 0.0f, m_duration);
+            finished = true;
+        }
+    }
+
+    onAnimate(progress());
+    if (onUpdate) onUpdate(progress());
+
+    if (finished) {
+        m_state = State::Finished;
+        if (onComplete) onComplete();
+    }
+}
+
+void Animation::seek(f32 time) {
+    m_currentTime = std::clamp(time, 0.0f, m_duration);
+    onAnimate(progress());
+    if (onUpdate) onUpdate(progress());
+}
+
+// ---- Timeline ----
+
+Timeline::Timeline() = default;
+
+Timeline::~Timeline() = default;
+
+void Timeline::add(Handle<Animation> animation, f32 startTime) {
+    f32 endTime = startTime + animation->duration();
+    m_lastSequentialTime = std::max(m_lastSequentialTime, endTime);
+    m_animations.push_back({std::move(animation), startTime, endTime});
+    m_indexDirty = true;
+}
+
+void Timeline::addSequential(Handle<Animation> animation) {
+    f32 start = m_animations.empty() ? 0.0f : m_animations.back().endTime;
+    add(std::move(animation), start);
+}
+
+void Timeline::addParallel(Handle<Animation> animation) {
+    f32 start = m_animations.empty() ? 0.0f : m_animations.back().startTime;
+    add(std::move(animation), start);
+}
+
+void Timeline::play() {
+    m_playing = true;
+}
+
+void Timeline::pause() {
+    m_playing = false;
+}
+
+void Timeline::stop() {
+    m_playing = false;
+    seek(0);
+    for (AnimationEntry& entry : m_animations) {
+        entry.started = false;
+        entry.completed = false;
+    }
+}
+
+void Timeline::seek(f32 time) {
+    advanceTo(std::clamp(time, 0.0f, duration()));
+}
+
+void Timeline::update(f32 deltaTime) {
+    if (!m_playing) {
+        return;
+    }
+
+    advanceTo(std::min(m_currentTime + deltaTime, duration()));
+
+    if (m_currentTime >= duration()) {
+        m_playing = false;
+        if (onComplete) onComplete();
+    }
+}
+
+f32 Timeline::duration() const {
+    return m_lastSequentialTime;
+}
+
+void Timeline::advanceTo(f32 time) {
+    if (m_indexDirty) {
+        rebuildIndex();
+    }
+
+    const f32 lo = std::min(m_currentTime, time);
+    const f32 hi = std::max(m_currentTime, time);
+
+    // Every entry overlapping [lo, hi] either contains the old time (so it
+    // is active) or has its start or end inside the range
+    m_touched.assign(m_active.begin(), m_active.end());
+
+    auto first = std::lower_bound(m_startTimes.begin(), m_startTimes.end(), lo);
+    auto last = std::upper_bound(first, m_startTimes.end(), hi);
+    for (auto it = first; it != last; ++it) {
+        m_touched.push_back(m_byStart[it - m_startTimes.begin()]);
+    }
+
+    first = std::lower_bound(m_endTimes.begin(), m_endTimes.end(), lo);
+    last = std::upper_bound(first, m_endTimes.end(), hi);
+    for (auto it = first; it != last; ++it) {
+        m_touched.push_back(m_byEnd[it - m_endTimes.begin()]);
+    }
+
+    // Apply in insertion order so overlapping writers resolve as before
+    std::sort(m_touched.begin(), m_touched.end());
+    m_touched.erase(std::unique(m_touched.begin(), m_touched.end()), m_touched.end());
+
+    m_currentTime = time;
+    m_active.clear();
+    for (u32 index : m_touched) {
+        // Indexed rather than held: callbacks may add entries
+        Animation* animation = m_animations[index].animation.get();
+        const f32 startTime = m_animations[index].startTime;
+        const f32 endTime = m_animations[index].endTime;
+        if (startTime <= time && time <= endTime) {
+            m_active.push_back(index);
+        }
+
+        if (time < startTime) {
+            m_animations[index].started = false;
+        } else if (!m_animations[index].started) {
+            m_animations[index].started = true;
+            if (animation->onStart) animation->onStart();
+        }
+
+        // Snap finished entries to their exact end despite float drift
+        f32 local = time >= endTime ? animation->duration() : time - startTime;
+        animation->seek(local);
+
+        if (time < endTime) {
+            m_animations[index].completed = false;
+        } else if (!m_animations[index].completed) {
+            m_animations[index].completed = true;
+            if (animation->onComplete) animation->onComplete();
+        }
+    }
+}
+
+void Timeline::rebuildIndex() {
+    const u32 count = (u32)m_animations.size();
+
+    m_byStart.resize(count);
+    m_byEnd.resize(count);
+    for (u32 i = 0; i < count; ++i) {
+        m_byStart[i] = i;
+        m_byEnd[i] = i;
+    }
+    std::stable_sort(m_byStart.begin(), m_byStart.end(), [this](u32 a, u32 b) {
+        return m_animations[a].startTime < m_animations[b].startTime;
+    });
+    std::stable_sort(m_byEnd.begin(), m_byEnd.end(), [this](u32 a, u32 b) {
+        return m_animations[a].endTime < m_animations[b].endTime;
+    });
+
+    m_startTimes.resize(count);
+    m_endTimes.resize(count);
+    for (u32 i = 0; i < count; ++i) {
+        m_startTimes[i] = m_animations[m_byStart[i]].startTime;
+        m_endTimes[i] = m_animations[m_byEnd[i]].endTime;
+    }
+
+    m_active.clear();
+    for (u32 i = 0; i < count; ++i) {
+        const AnimationEntry& entry = m_animations[i];
+        if (entry.startTime <= m_currentTime && m_currentTime <= entry.endTime) {
+            m_active.push_back(i);
+        }
+    }
+    m_indexDirty = false;
+}
+
+} // namespace Aurora
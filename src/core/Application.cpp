@@ -2,17 +2,54 @@
 // src/core/Application.cpp
 // ============================================
 #include "aurora/core/Application.hpp"
+#include "aurora/core/Profiler.hpp"
+#include "aurora/core/Property.hpp"
+#include "aurora/graphics/ShaderCache.hpp"
+#include <algorithm>
 #include <chrono>
+#include <cstdlib>
+#include <stdexcept>
 #include <GL/gl.h>
 
 namespace Aurora {
 
 Application* Application::s_instance = nullptr;
 
+namespace {
+
+// Why IPlatform::create() found nothing to run
+std::string noPlatformMessage() {
+    std::string compiled;
+#ifdef AURORA_PLATFORM_WAYLAND
+    compiled += " wayland";
+#endif
+#ifdef AURORA_PLATFORM_X11
+    compiled += " x11";
+#endif
+#ifdef AURORA_PLATFORM_HEADLESS
+    compiled += " headless";
+#endif
+    
+    std::string message = "No usable platform backend (compiled in:" + compiled + "): ";
+    const char* requested = std::getenv("AURORA_PLATFORM");
+    if (requested && *requested) {
+        message += "AURORA_PLATFORM=" + std::string(requested) + " is not one of them";
+    } else {
+        message += "neither WAYLAND_DISPLAY nor DISPLAY is set";
+    }
+    return message;
+}
+
+} // namespace
+
+Application::Application(int argc, char** argv)
+    : Application(argc, argv, Config()) {}
+
 Application::Application(int argc, char** argv, const Config& config)
     : m_config(config) {
-    s_instance = this;
     initialize();
+    // Only once construction can no longer throw
+    s_instance = this;
 }
 
 Application::~Application() {
@@ -23,12 +60,48 @@ Application::~Application() {
 void Application::initialize() {
     // Create platform
     m_platform = IPlatform::create();
+    if (!m_platform) {
+        throw std::runtime_error(noPlatformMessage());
+    }
     if (!m_platform->initialize()) {
         throw std::runtime_error("Failed to initialize platform");
     }
+    
+    IPlatform* platform = m_platform.get();
+    m_scheduler.setPlatform(platform);
+    InvokeQueue::main().setWakeHandler([platform]() { platform->wakeUp(); });
+    
+    m_frameStats.setRefreshRate(m_config.vsync ? m_config.refreshRate : 0.0);
+    
+    if (m_config.shaderCache) {
+        ShaderCache::shared().setDirectory(shaderCacheDirectory());
+    }
+}
+
+std::string Application::shaderCacheDirectory() const {
+    if (!m_config.shaderCacheDir.empty()) {
+        return m_config.shaderCacheDir;
+    }
+    
+    std::string base;
+    if (const char* xdg = std::getenv("XDG_CACHE_HOME"); xdg && *xdg) {
+        base = xdg;
+    } else if (const char* home = std::getenv("HOME"); home && *home) {
+        base = std::string(home) + "/.cache";
+    } else {
+        return {};
+    }
+    
+    std::string name;
+    for (char c : m_config.name) {
+        bool safe = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '-' || c == '_';
+        name += safe ? c : '_';
+    }
+    return base + "/aurora/" + name + "/shaders";
 }
 
 void Application::shutdown() {
+    InvokeQueue::main().setWakeHandler(nullptr);
     if (m_platform) {
         m_platform->shutdown();
     }
@@ -41,23 +114,59 @@ int Application::run() {
     auto lastTime = startTime;
     
     while (m_running) {
+        // Nothing to animate: sleep until input, the next timer or the
+        // next window frame
+        if (isIdle()) {
+            // Waiting for a window's next refresh is part of the frame;
+            // only time with nothing to draw is left out of the stats
+            if (m_animator.activeCount() == 0 && !m_scheduler.busy()) {
+                m_frameStats.resync();
+            }
+            if (m_animator.activeCount() > 0) {
+                // Animating: wake for the next scheduled window frame
+                m_scheduler.requestFrame();
+            }
+            u64 deadline = std::min(m_timers.nextDeadline(), m_scheduler.nextDeadline());
+            if (deadline == TimerWheel::kNoDeadline) {
+                m_platform->waitEvents(-1.0);
+            } else {
+                u64 now = TimerWheel::clock();
+                m_platform->waitEvents(deadline > now ? (deadline - now) * 1e-9 : 0.0);
+            }
+        }
+        
         auto currentTime = std::chrono::high_resolution_clock::now();
         std::chrono::duration<f64> elapsed = currentTime - lastTime;
         f64 deltaTime = elapsed.count();
         lastTime = currentTime;
         
-        // Update FPS
         m_frameTime = deltaTime;
-        m_fps = 1.0f / deltaTime;
+        m_frameStats.beginFrame();
+        
+        AURORA_PROFILE_BEGIN_FRAME();
         
         // Process events
-        processEvents();
+        {
+            AURORA_PROFILE_SCOPE("Events");
+            FrameStats::PhaseScope phase(m_frameStats, FrameStats::Phase::Events);
+            processEvents();
+        }
         
         // Update
-        update(deltaTime);
+        {
+            AURORA_PROFILE_SCOPE("Update");
+            FrameStats::PhaseScope phase(m_frameStats, FrameStats::Phase::Update);
+            update(deltaTime);
+        }
         
         // Render
-        render();
+        {
+            AURORA_PROFILE_SCOPE("Render");
+            FrameStats::PhaseScope phase(m_frameStats, FrameStats::Phase::Render);
+            render();
+        }
+        
+        AURORA_PROFILE_END_FRAME();
     }
     
     return m_exitCode;
@@ -71,6 +180,9 @@ void Application::quit(int exitCode) {
 void Application::processEvents() {
     m_platform->pumpEvents();
     
+    // Deliver queued signal connections posted from other threads
+    InvokeQueue::main().drain();
+    
     while (m_platform->hasEvents()) {
         Event event = m_platform->nextEvent();
         
@@ -80,14 +192,32 @@ void Application::processEvents() {
                 break;
                 
             case EventType::WindowClose:
-                if (event.window && event.window->onClose) {
-                    event.window->onClose();
+                if (event.window) {
+                    event.window->onClose.emit();
                 }
                 break;
                 
             case EventType::WindowResize:
-                if (event.window && event.window->onResize) {
-                    event.window->onResize(event.size.width, event.size.height);
+                if (event.window) {
+                    event.window->onResize.emit(event.size.width, event.size.height);
+                }
+                break;
+                
+            case EventType::WindowMove:
+                if (event.window) {
+                    event.window->onMove.emit(event.position.x, event.position.y);
+                }
+                break;
+                
+            case EventType::WindowFocus:
+                if (event.window) {
+                    event.window->onFocus.emit();
+                }
+                break;
+                
+            case EventType::WindowBlur:
+                if (event.window) {
+                    event.window->onBlur.emit();
                 }
                 break;
                 
@@ -98,13 +228,38 @@ void Application::processEvents() {
 }
 
 void Application::update(f64 deltaTime) {
+    // Property changes made this frame notify their watchers once, here
+    PropertyBatch batch;
+    
+    m_timers.advance(TimerWheel::clock());
+    // The last step of an animation needs a frame too
+    if (m_animator.activeCount() > 0) {
+        m_scheduler.requestFrame();
+    }
+    m_animator.update((f32)deltaTime);
+    
     for (auto& callback : m_frameCallbacks) {
         callback(deltaTime);
     }
 }
 
 void Application::render() {
-    // This will be handled by the Renderer in the next step
+    m_scheduler.renderDue(TimerWheel::clock());
+}
+
+void Application::swapBuffers(Window* window) {
+    AURORA_PROFILE_SCOPE("Swap");
+    FrameStats::PhaseScope phase(m_frameStats, FrameStats::Phase::Swap);
+    m_platform->swapBuffers(window);
+}
+
+bool Application::isIdle() const {
+    if (!m_frameCallbacks.empty() || !InvokeQueue::main().empty()) {
+        return false;
+    }
+    // Scheduled windows pace animations to their displays, so the loop
+    // may sleep between their frames
+    return m_animator.activeCount() == 0 || !m_scheduler.empty();
 }
 
 void Application::onFrame(std::function<void(f64)> callback) {
@@ -0,0 +1,244 @@
+// ============================================
+// src/core/FrameScheduler.cpp
+// ============================================
+#include "aurora/core/FrameScheduler.hpp"
+#include "aurora/platform/IPlatform.hpp"
+#include <algorithm>
+#include <cstdio>
+
+namespace Aurora {
+
+FrameScheduler::FrameScheduler(IPlatform* platform) : m_platform(platform) {}
+
+void FrameScheduler::addWindow(Window* window, void* glContext, DrawCallback draw) {
+    if (!window || find(window)) {
+        return;
+    }
+    auto target = std::make_unique<Target>();
+    target->window = window;
+    target->context = glContext;
+    target->draw = std::move(draw);
+    if (m_platform && glContext) {
+        // Pacing comes from the vblank timing, not from blocking swaps
+        m_platform->makeCurrent(window, glContext);
+        m_platform->setSwapInterval(window, 0);
+    }
+    m_targets.push_back(std::move(target));
+}
+
+void FrameScheduler::removeWindow(Window* window) {
+    if (Target* target = find(window)) {
+        // Erased after renderDue() when a draw callback removes a window
+        target->window = nullptr;
+    }
+    if (!m_rendering) {
+        eraseRemoved();
+    }
+}
+
+void FrameScheduler::eraseRemoved() {
+    m_targets.erase(std::remove_if(m_targets.begin(), m_targets.end(),
+                                   [](const Unique<Target>& target) { return !target->window; }),
+                    m_targets.end());
+}
+
+bool FrameScheduler::contains(Window* window) const {
+    return find(window) != nullptr;
+}
+
+bool FrameScheduler::busy() const {
+    for (const auto& target : m_targets) {
+        if (target->window && (target->damaged || target->continuous)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void FrameScheduler::requestFrame(Window* window) {
+    if (Target* target = find(window)) {
+        target->damaged = true;
+        target->fullDamage = true;
+    }
+}
+
+void FrameScheduler::requestFrame() {
+    for (auto& target : m_targets) {
+        target->damaged = true;
+        target->fullDamage = true;
+    }
+}
+
+void FrameScheduler::requestFrame(Window* window, const Rect& region) {
+    Target* target = find(window);
+    if (!target) {
+        return;
+    }
+    target->damaged = true;
+    if (target->fullDamage) {
+        return;
+    }
+    // Past a handful of rectangles the compositor gains nothing
+    if (target->damage.size() >= kMaxDamageRects) {
+        target->fullDamage = true;
+        target->damage.clear();
+    } else {
+        target->damage.push_back(region);
+    }
+}
+
+void FrameScheduler::setContinuous(Window* window, bool continuous) {
+    if (Target* target = find(window)) {
+        target->continuous = continuous;
+    }
+}
+
+u32 FrameScheduler::renderDue(u64 now) {
+    // Collected first: a draw callback may add windows
+    std::vector<Target*> due;
+    for (auto& target : m_targets) {
+        if (!target->damaged && !target->continuous) {
+            // Time spent idle is not a long frame
+            target->stats.resync();
+        } else if (target->nextFrame <= now && (!m_platform || m_platform->canPresent(target->window))) {
+            due.push_back(target.get());
+        }
+    }
+
+    u32 rendered = 0;
+    m_rendering = true;
+    for (Target* target : due) {
+        if (target->window) {
+            render(*target, now);
+            ++rendered;
+        }
+    }
+    m_rendering = false;
+    eraseRemoved();
+    return rendered;
+}
+
+u64 FrameScheduler::nextDeadline() const {
+    u64 deadline = TimerWheel::kNoDeadline;
+    for (const auto& target : m_targets) {
+        // Windows waiting on the compositor are woken by its event
+        if (target->window && (target->damaged || target->continuous) &&
+            (!m_platform || m_platform->canPresent(target->window))) {
+            deadline = std::min(deadline, target->nextFrame);
+        }
+    }
+    return deadline;
+}
+
+const FrameStats* FrameScheduler::stats(Window* window) const {
+    const Target* target = find(window);
+    return target ? &target->stats : nullptr;
+}
+
+std::string FrameScheduler::toJson() const {
+    std::string json = "{\"windows\":[";
+    bool first = true;
+    for (const auto& entry : m_targets) {
+        const Target& target = *entry;
+        if (!target.window) {
+            continue;
+        }
+        std::string title;
+        for (char c : target.window->config().title) {
+            if (c == '"' || c == '\\') {
+                title += '\\';
+            }
+            if ((unsigned char)c >= 0x20) {
+                title += c;
+            }
+        }
+        char buffer[160];
+        std::snprintf(buffer, sizeof(buffer), "\",\"display\":%u,\"refreshRate\":%.2f,\"measured\":%s,\"stats\":",
+                      target.display, target.interval ? 1e9 / (f64)target.interval : 0.0,
+                      target.measured ? "true" : "false");
+        json += first ? "{\"title\":\"" : ",{\"title\":\"";
+        first = false;
+        json += title;
+        json += buffer;
+        json += target.stats.toJson();
+        json += "}";
+    }
+    json += "]}";
+    return json;
+}
+
+FrameScheduler::Target* FrameScheduler::find(Window* window) {
+    for (auto& target : m_targets) {
+        if (window && target->window == window) {
+            return target.get();
+        }
+    }
+    return nullptr;
+}
+
+const FrameScheduler::Target* FrameScheduler::find(Window* window) const {
+    return const_cast<FrameScheduler*>(this)->find(window);
+}
+
+void FrameScheduler::updateTiming(Target& target, u64 now) {
+    u64 lastVblank = 0, interval = 0;
+    target.display = m_platform ? m_platform->displayOf(target.window) : 0;
+    target.measured = m_platform && m_platform->vblankTiming(target.window, lastVblank, interval) && interval > 0;
+    if (!target.measured) {
+        // Keep the phase of the previous prediction; the first frame sets it
+        f64 hz = m_platform ? m_platform->displayRefreshRate(target.display) : 0.0;
+        if (hz <= 0.0) {
+            hz = 60.0;
+        }
+        interval = (u64)(1e9 / hz);
+        lastVblank = target.nextFrame ? target.nextFrame : now;
+    }
+
+    if (interval != target.interval) {
+        target.interval = interval;
+        target.stats.setRefreshRate(1e9 / (f64)interval);
+    }
+
+    // The frame just drawn shows at the next vblank; the one after may
+    // start once it has
+    if (lastVblank > now) {
+        target.nextFrame = lastVblank;
+    } else {
+        target.nextFrame = lastVblank + ((now - lastVblank) / interval + 1) * interval;
+    }
+}
+
+void FrameScheduler::render(Target& target, u64 now) {
+    target.stats.beginFrame(now);
+    const f64 deltaTime = target.lastFrame ? (f64)(now - target.lastFrame) * 1e-9 : 0.0;
+    target.lastFrame = now;
+    // Cleared first so the callback can ask for another frame
+    target.damaged = false;
+
+    if (m_platform) {
+        static const std::vector<Rect> kWholeWindow;
+        const bool whole = target.fullDamage || target.continuous;
+        m_platform->setFrameDamage(target.window, whole ? kWholeWindow : target.damage);
+        if (target.context) {
+            m_platform->makeCurrent(target.window, target.context);
+        }
+    }
+    target.fullDamage = false;
+    target.damage.clear();
+    {
+        FrameStats::PhaseScope phase(target.stats, FrameStats::Phase::Render);
+        target.draw(deltaTime);
+    }
+    if (!target.window) {
+        // Removed by its own callback
+        return;
+    }
+    if (m_platform && target.context) {
+        FrameStats::PhaseScope phase(target.stats, FrameStats::Phase::Swap);
+        m_platform->swapBuffers(target.window);
+    }
+
+    updateTiming(target, now);
+}
+
+} // namespace Aurora
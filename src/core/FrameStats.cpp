@@ -0,0 +1,169 @@
+// ============================================
+// src/core/FrameStats.cpp
+// ============================================
+#include "aurora/core/FrameStats.hpp"
+#include "aurora/core/Timer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+namespace Aurora {
+
+namespace {
+
+// Nearest-rank percentile of a scratch copy (reordered in place)
+f64 percentile(std::vector<f32>& values, f64 p) {
+    size_t rank = (size_t)std::ceil(p * values.size());
+    size_t index = rank > 0 ? rank - 1 : 0;
+    std::nth_element(values.begin(), values.begin() + index, values.end());
+    return values[index];
+}
+
+} // namespace
+
+FrameStats::FrameStats(u32 capacity)
+    : m_times(std::max(capacity, 1u), 0.0f),
+      m_phaseTimes(std::max(capacity, 1u) * kPhaseCount, 0.0f) {}
+
+void FrameStats::beginFrame() {
+    beginFrame(TimerWheel::clock());
+}
+
+void FrameStats::beginFrame(u64 now) {
+    // Close any phase left open so its time lands in the finished frame
+    if (m_phaseDepth > 0 && m_phaseDepth <= kMaxPhaseDepth) {
+        m_currentPhases[(u32)m_phaseStack[m_phaseDepth - 1]] += (now - m_phaseStart) * 1e-9;
+        m_phaseStart = now;
+    }
+    if (m_frameStart != 0 && now > m_frameStart) {
+        addFrame((now - m_frameStart) * 1e-9, m_currentPhases);
+    }
+    m_frameStart = now;
+    std::fill(std::begin(m_currentPhases), std::end(m_currentPhases), 0.0);
+}
+
+void FrameStats::resync() {
+    m_frameStart = 0;
+}
+
+void FrameStats::beginPhase(Phase phase) {
+    beginPhase(phase, TimerWheel::clock());
+}
+
+void FrameStats::beginPhase(Phase phase, u64 now) {
+    if (m_phaseDepth > 0 && m_phaseDepth <= kMaxPhaseDepth) {
+        m_currentPhases[(u32)m_phaseStack[m_phaseDepth - 1]] += (now - m_phaseStart) * 1e-9;
+    }
+    if (m_phaseDepth < kMaxPhaseDepth) {
+        m_phaseStack[m_phaseDepth] = phase;
+    }
+    ++m_phaseDepth;
+    m_phaseStart = now;
+}
+
+void FrameStats::endPhase() {
+    endPhase(TimerWheel::clock());
+}
+
+void FrameStats::endPhase(u64 now) {
+    if (m_phaseDepth == 0) {
+        return;
+    }
+    if (m_phaseDepth <= kMaxPhaseDepth) {
+        m_currentPhases[(u32)m_phaseStack[m_phaseDepth - 1]] += (now - m_phaseStart) * 1e-9;
+    }
+    --m_phaseDepth;
+    m_phaseStart = now;
+}
+
+void FrameStats::addFrame(f64 frameTime, const f64* phaseTimes) {
+    if (!(frameTime > 0.0)) {
+        return;     // Zero or NaN would poison the average
+    }
+
+    m_times[m_head] = (f32)frameTime;
+    f32* phases = &m_phaseTimes[m_head * kPhaseCount];
+    for (u32 i = 0; i < kPhaseCount; ++i) {
+        phases[i] = phaseTimes ? (f32)phaseTimes[i] : 0.0f;
+    }
+    m_head = (m_head + 1) % (u32)m_times.size();
+    m_count = std::min(m_count + 1, (u32)m_times.size());
+    ++m_frames;
+
+    m_smoothed = m_smoothed > 0.0 ? m_smoothed + kSmoothing * (frameTime - m_smoothed) : frameTime;
+
+    if (m_refreshRate > 0.0) {
+        // 1.4 intervals still presents on the next vblank; 1.6 skipped one
+        f64 intervals = std::round(frameTime * m_refreshRate);
+        if (intervals > 1.0) {
+            m_missedVsync += (u64)intervals - 1;
+        }
+    }
+}
+
+f64 FrameStats::frameTime(u32 age) const {
+    if (age >= m_count) {
+        return 0.0;
+    }
+    const u32 capacity = (u32)m_times.size();
+    return m_times[(m_head + capacity - 1 - age) % capacity];
+}
+
+FrameStats::Summary FrameStats::summary() const {
+    Summary summary;
+    summary.frames = m_frames;
+    summary.missedVsync = m_missedVsync;
+    summary.fps = fps();
+    if (m_count == 0) {
+        return summary;
+    }
+
+    std::vector<f32> window;
+    window.reserve(m_count);
+    f64 total = 0.0;
+    for (u32 age = 0; age < m_count; ++age) {
+        const u32 index = (m_head + (u32)m_times.size() - 1 - age) % (u32)m_times.size();
+        window.push_back(m_times[index]);
+        total += m_times[index];
+        for (u32 i = 0; i < kPhaseCount; ++i) {
+            summary.phases[i] += m_phaseTimes[index * kPhaseCount + i];
+        }
+    }
+
+    summary.mean = total / m_count;
+    for (auto& phase : summary.phases) {
+        phase /= m_count;
+    }
+    summary.worst = *std::max_element(window.begin(), window.end());
+    summary.p50 = percentile(window, 0.50);
+    summary.p95 = percentile(window, 0.95);
+    summary.p99 = percentile(window, 0.99);
+    return summary;
+}
+
+std::string FrameStats::toJson() const {
+    const Summary s = summary();
+    char buffer[512];
+    std::snprintf(buffer, sizeof(buffer),
+                  "{\"frames\":%llu,\"missedVsync\":%llu,\"fps\":%.2f,"
+                  "\"frameTimeMs\":{\"mean\":%.3f,\"p50\":%.3f,\"p95\":%.3f,\"p99\":%.3f,\"worst\":%.3f},"
+                  "\"phasesMs\":{\"events\":%.3f,\"update\":%.3f,\"render\":%.3f,\"swap\":%.3f}}",
+                  (unsigned long long)s.frames, (unsigned long long)s.missedVsync, s.fps,
+                  s.mean * 1e3, s.p50 * 1e3, s.p95 * 1e3, s.p99 * 1e3, s.worst * 1e3,
+                  s.phases[0] * 1e3, s.phases[1] * 1e3, s.phases[2] * 1e3, s.phases[3] * 1e3);
+    return buffer;
+}
+
+void FrameStats::reset() {
+    std::fill(m_times.begin(), m_times.end(), 0.0f);
+    std::fill(m_phaseTimes.begin(), m_phaseTimes.end(), 0.0f);
+    m_head = 0;
+    m_count = 0;
+    m_frames = 0;
+    m_missedVsync = 0;
+    m_smoothed = 0.0;
+    m_frameStart = 0;
+    m_phaseDepth = 0;
+}
+
+} // namespace Aurora
@@ -0,0 +1,186 @@
+// ============================================
+// src/core/Name.cpp
+// ============================================
+#include "aurora/core/Name.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <vector>
+
+namespace Aurora {
+
+namespace {
+
+// Text lives in an append-only arena and entries in fixed chunks that
+// never move, so str() reads them without the lock once an id has been
+// handed out. The index is an open-addressing table of ids.
+class NameTable {
+public:
+    static constexpr u32 kChunkBits = 12;
+    static constexpr u32 kChunkSize = 1u << kChunkBits;
+    static constexpr u32 kMaxChunks = 4096;     // 16M names
+    static constexpr size_t kArenaBlock = 64 * 1024;
+
+    NameTable() {
+        for (auto& chunk : m_chunks) {
+            chunk.store(nullptr, std::memory_order_relaxed);
+        }
+        m_slots.assign(1024, 0);
+        insert(std::string_view(), 0);
+    }
+
+    u32 intern(std::string_view text) {
+        const u32 hash = hashOf(text);
+        std::lock_guard<std::mutex> lock(m_mutex);
+        u32& slot = probe(text, hash);
+        if (slot == 0) {
+            slot = insert(text, hash);
+            if (++m_used * 10 > m_slots.size() * 7) {
+                grow();
+            }
+            return m_count.load(std::memory_order_relaxed) - 1;
+        }
+        return slot;
+    }
+
+    u32 find(std::string_view text) {
+        const u32 hash = hashOf(text);
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return probe(text, hash);
+    }
+
+    std::string_view get(u32 id) const {
+        const Entry& entry = entryAt(id);
+        return {entry.text, entry.length};
+    }
+
+    u32 size() const { return m_count.load(std::memory_order_relaxed); }
+
+    static NameTable& instance() {
+        // Never destroyed so Names stay valid during static destruction
+        static NameTable* table = new NameTable;
+        return *table;
+    }
+
+private:
+    struct Entry {
+        const char* text;
+        u32 length;
+        u32 hash;
+    };
+
+    static u32 hashOf(std::string_view text) {
+        // FNV-1a
+        u32 hash = 2166136261u;
+        for (char c : text) {
+            hash = (hash ^ (u8)c) * 16777619u;
+        }
+        return hash;
+    }
+
+    const Entry& entryAt(u32 id) const {
+        return m_chunks[id >> kChunkBits].load(std::memory_order_acquire)[id & (kChunkSize - 1)];
+    }
+
+    // Slot holding text's id, or the empty slot where it belongs
+    u32& probe(std::string_view text, u32 hash) {
+        const size_t mask = m_slots.size() - 1;
+        for (size_t i = hash & mask;; i = (i + 1) & mask) {
+            u32& slot = m_slots[i];
+            if (slot == 0) {
+                return slot;
+            }
+            const Entry& entry = entryAt(slot);
+            if (entry.hash == hash && std::string_view(entry.text, entry.length) == text) {
+                return slot;
+            }
+        }
+    }
+
+    void grow() {
+        std::vector<u32> old;
+        old.swap(m_slots);
+        m_slots.assign(old.size() * 2, 0);
+        const size_t mask = m_slots.size() - 1;
+        for (u32 id : old) {
+            if (id == 0) {
+                continue;
+            }
+            size_t i = entryAt(id).hash & mask;
+            while (m_slots[i] != 0) {
+                i = (i + 1) & mask;
+            }
+            m_slots[i] = id;
+        }
+    }
+
+    const char* store(std::string_view text) {
+        const size_t size = text.size() + 1;
+        if (size > kArenaBlock / 4) {
+            char* own = new char[size];
+            std::memcpy(own, text.data(), text.size());
+            own[text.size()] = '\0';
+            return own;
+        }
+        if (m_arenaUsed + size > kArenaBlock || !m_arena) {
+            m_arena = new char[kArenaBlock];
+            m_arenaUsed = 0;
+        }
+        char* out = m_arena + m_arenaUsed;
+        std::memcpy(out, text.data(), text.size());
+        out[text.size()] = '\0';
+        m_arenaUsed += size;
+        return out;
+    }
+
+    u32 insert(std::string_view text, u32 hash) {
+        const u32 id = m_count.load(std::memory_order_relaxed);
+        const u32 chunkIndex = id >> kChunkBits;
+        if (chunkIndex >= kMaxChunks) {
+            // Entries never move, so the chunk table cannot grow; names are
+            // meant for identifiers, not for per-item or user text
+            std::cerr << "[Name] Interned name table is full (" << kMaxChunks * kChunkSize
+                      << " names)" << std::endl;
+            std::abort();
+        }
+        Entry* chunk = m_chunks[chunkIndex].load(std::memory_order_relaxed);
+        if (!chunk) {
+            chunk = new Entry[kChunkSize];
+            m_chunks[chunkIndex].store(chunk, std::memory_order_release);
+        }
+        chunk[id & (kChunkSize - 1)] = {store(text), (u32)text.size(), hash};
+        m_count.store(id + 1, std::memory_order_release);
+        return id;
+    }
+
+    std::mutex m_mutex;
+    std::vector<u32> m_slots;
+    size_t m_used = 0;
+    std::atomic<Entry*> m_chunks[kMaxChunks];
+    std::atomic<u32> m_count{0};
+    char* m_arena = nullptr;
+    size_t m_arenaUsed = 0;
+};
+
+} // namespace
+
+Name::Name(std::string_view text)
+    : m_id(text.empty() ? 0 : NameTable::instance().intern(text)) {}
+
+Name Name::find(std::string_view text) {
+    Name name;
+    name.m_id = text.empty() ? 0 : NameTable::instance().find(text);
+    return name;
+}
+
+std::string_view Name::str() const {
+    return NameTable::instance().get(m_id);
+}
+
+u32 Name::tableSize() {
+    return NameTable::instance().size();
+}
+
+} // namespace Aurora
@@ -0,0 +1,38 @@
+// ============================================
+// src/core/Object.cpp
+// ============================================
+#include "aurora/core/Object.hpp"
+#include <algorithm>
+
+namespace Aurora {
+
+Object::Object() = default;
+
+Object::~Object() {
+    // Children are not owned; they are only detached
+    for (Object* child : m_children) {
+        child->m_parent = nullptr;
+    }
+    if (m_parent) {
+        auto& siblings = m_parent->m_children;
+        siblings.erase(std::remove(siblings.begin(), siblings.end(), this), siblings.end());
+    }
+}
+
+void Object::setParent(Object* parent) {
+    if (m_parent == parent) {
+        return;
+    }
+    Object* oldParent = m_parent;
+    if (oldParent) {
+        auto& siblings = oldParent->m_children;
+        siblings.erase(std::remove(siblings.begin(), siblings.end(), this), siblings.end());
+    }
+    m_parent = parent;
+    if (parent) {
+        parent->m_children.push_back(this);
+    }
+    onParentChanged(oldParent);
+}
+
+} // namespace Aurora
@@ -0,0 +1,35 @@
+// ============================================
+// src/core/Pool.cpp
+// ============================================
+#include "aurora/core/Pool.hpp"
+#include <algorithm>
+
+namespace Aurora {
+
+SlabAllocator::SlabAllocator(size_t blockSize, size_t slabSize)
+    : m_blockSize(std::max(blockSize, sizeof(FreeBlock))),
+      m_slabSize(std::max(slabSize, m_blockSize)) {
+    // Keep every block aligned like operator new would
+    const size_t align = alignof(std::max_align_t);
+    m_blockSize = (m_blockSize + align - 1) / align * align;
+}
+
+SlabAllocator::~SlabAllocator() {
+    for (void* slab : m_slabs) {
+        ::operator delete(slab);
+    }
+}
+
+void* SlabAllocator::allocateSlow() {
+    if (!m_cursor || m_cursor + m_blockSize > m_end) {
+        m_cursor = static_cast<char*>(::operator new(m_slabSize));
+        m_end = m_cursor + m_slabSize;
+        m_slabs.push_back(m_cursor);
+    }
+    void* block = m_cursor;
+    m_cursor += m_blockSize;
+    ++m_live;
+    return block;
+}
+
+} // namespace Aurora
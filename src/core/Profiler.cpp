@@ -0,0 +1,173 @@
+// ============================================
+// src/core/Profiler.cpp
+// ============================================
+#include "aurora/core/Profiler.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+
+namespace Aurora {
+
+namespace {
+
+constexpr u32 kDefaultCapacity = 300;   // ~5 s at 60 Hz
+
+thread_local u32 t_depth = 0;
+
+void appendEscaped(std::string& out, std::string_view text) {
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += c;
+        } else if ((u8)c < 0x20) {
+            char buffer[8];
+            std::snprintf(buffer, sizeof(buffer), "\\u%04x", (u32)(u8)c);
+            out += buffer;
+        } else {
+            out += c;
+        }
+    }
+}
+
+void appendEvent(std::string& out, std::string_view name, u64 start, u64 duration, u64 origin, u32 thread) {
+    char buffer[128];
+    out += out.back() == '[' ? "\n{\"name\":\"" : ",\n{\"name\":\"";
+    appendEscaped(out, name);
+    std::snprintf(buffer, sizeof(buffer), "\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+                  thread, (start - origin) / 1000.0, duration / 1000.0);
+    out += buffer;
+}
+
+} // namespace
+
+Profiler& Profiler::shared() {
+    static Profiler profiler;
+    return profiler;
+}
+
+Profiler::Profiler() : m_frames(kDefaultCapacity) {}
+
+u64 Profiler::now() {
+    return (u64)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+u32 Profiler::threadId() {
+    static std::atomic<u32> next{0};
+    thread_local u32 id = next.fetch_add(1, std::memory_order_relaxed);
+    return id;
+}
+
+void Profiler::setCapacity(u32 frames) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_frames.assign(std::max(frames, 1u), Frame());
+}
+
+void Profiler::beginFrame() {
+    if (!enabled()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_mainThread = threadId();
+    Frame& frame = slot(++m_frameIndex);
+    frame.index = m_frameIndex;
+    frame.start = now();
+    frame.end = 0;
+    frame.gpuTime = 0;
+    frame.events.clear();   // Keeps capacity, so steady state allocates nothing
+}
+
+void Profiler::endFrame() {
+    if (!enabled()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    slot(m_frameIndex).end = now();
+}
+
+void Profiler::record(Name name, u64 start, u64 end, u32 depth) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    slot(m_frameIndex).events.push_back({name, start, end - start, threadId(), depth});
+}
+
+void Profiler::recordGpu(u64 frameIndex, Name name, u64 start, u64 duration) {
+    if (!enabled()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Frame& frame = slot(frameIndex);
+    if (frame.index != frameIndex) {
+        return;     // Resolved too late; the frame was overwritten
+    }
+    frame.events.push_back({name, start, duration, kGpuThread, 0});
+    frame.gpuTime += duration;
+}
+
+const Profiler::Frame* Profiler::frame(u64 index) const {
+    const Frame& frame = m_frames[index % m_frames.size()];
+    return frame.index == index && index != 0 ? &frame : nullptr;
+}
+
+std::string Profiler::chromeTrace() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Oldest complete frame first
+    std::vector<const Frame*> frames;
+    const u64 count = std::min<u64>(m_frameIndex, m_frames.size());
+    for (u64 index = m_frameIndex - count + 1; index <= m_frameIndex; ++index) {
+        const Frame& frame = m_frames[index % m_frames.size()];
+        if (frame.index == index && frame.end != 0) {
+            frames.push_back(&frame);
+        }
+    }
+
+    std::string out = "{\"traceEvents\":[";
+    if (frames.empty()) {
+        return out + "]}\n";
+    }
+    const u64 origin = frames.front()->start;
+
+    char buffer[128];
+    std::snprintf(buffer, sizeof(buffer),
+                  "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"Main\"}}",
+                  m_mainThread);
+    out += buffer;
+    std::snprintf(buffer, sizeof(buffer),
+                  ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"GPU\"}}",
+                  kGpuThread);
+    out += buffer;
+
+    for (const Frame* frame : frames) {
+        std::snprintf(buffer, sizeof(buffer), "Frame %llu", (unsigned long long)frame->index);
+        appendEvent(out, buffer, frame->start, frame->end - frame->start, origin, m_mainThread);
+        for (const Event& event : frame->events) {
+            if (event.start >= origin) {
+                appendEvent(out, event.name.str(), event.start, event.duration, origin, event.thread);
+            }
+        }
+    }
+    out += "\n]}\n";
+    return out;
+}
+
+bool Profiler::writeChromeTrace(const std::string& path) const {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    const std::string trace = chromeTrace();
+    return (bool)file.write(trace.data(), trace.size());
+}
+
+ProfileScope::ProfileScope(Name name)
+    : m_name(name), m_active(Profiler::shared().enabled()) {
+    m_depth = m_active ? t_depth++ : 0;
+    m_start = m_active ? Profiler::now() : 0;
+}
+
+ProfileScope::~ProfileScope() {
+    if (m_active) {
+        --t_depth;
+        Profiler::shared().record(m_name, m_start, Profiler::now(), m_depth);
+    }
+}
+
+} // namespace Aurora
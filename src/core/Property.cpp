@@ -0,0 +1,239 @@
+// ============================================
+// src/core/Property.cpp
+// ============================================
+#include "aurora/core/Property.hpp"
+#include <algorithm>
+
+namespace Aurora {
+
+namespace {
+
+// Binding currently being evaluated, with the inputs it had before
+struct EvaluationFrame {
+    PropertyBase* node;
+    const void* previous;
+    EvaluationFrame* outer;
+};
+
+thread_local EvaluationFrame* s_frame = nullptr;
+thread_local u32 s_batchDepth = 0;
+thread_local std::vector<PropertyWatcher*> s_pending;
+
+} // namespace
+
+// ---- PropertyBase ----
+
+PropertyBase::PropertyBase() = default;
+
+PropertyBase::~PropertyBase() {
+    unlinkInputs(m_inputs);
+    for (PropertyBase* dependent : m_dependents) {
+        auto& inputs = dependent->m_inputs;
+        inputs.erase(std::remove_if(inputs.begin(), inputs.end(),
+                                    [this](const Dependency& d) { return d.node == this; }),
+                     inputs.end());
+    }
+}
+
+void PropertyBase::track() const {
+    EvaluationFrame* frame = s_frame;
+    if (!frame || frame->node == this) {
+        return;
+    }
+
+    auto& inputs = frame->node->m_inputs;
+    for (const Dependency& d : inputs) {
+        if (d.node == this) {
+            return;
+        }
+    }
+    inputs.push_back({const_cast<PropertyBase*>(this), m_version});
+
+    // Inputs kept from the previous evaluation are already linked, so a
+    // steady-state recompute never scans the dependents list
+    const auto& previous = *static_cast<const std::vector<Dependency>*>(frame->previous);
+    for (const Dependency& d : previous) {
+        if (d.node == this) {
+            return;
+        }
+    }
+    m_dependents.push_back(frame->node);
+}
+
+void PropertyBase::changed() {
+    ++m_version;
+    PropertyBatch batch;
+    for (PropertyBase* dependent : m_dependents) {
+        dependent->invalidate();
+    }
+}
+
+void PropertyBase::rebound() {
+    // Watchers queued by the invalidation are flushed when this closes
+    PropertyBatch batch;
+    invalidate();
+}
+
+void PropertyBase::invalidate() {
+    if (m_stale) {
+        return;
+    }
+    m_stale = true;
+    for (PropertyBase* dependent : m_dependents) {
+        dependent->invalidate();
+    }
+}
+
+void PropertyBase::refresh() {
+    if (!m_stale || !m_bound) {
+        m_stale = false;
+        return;
+    }
+    m_stale = false;
+
+    // Only recompute if an input's value really moved
+    if (m_evaluated) {
+        bool inputChanged = false;
+        for (size_t i = 0; i < m_inputs.size(); ++i) {
+            PropertyBase* input = m_inputs[i].node;
+            input->refresh();
+            if (input->m_version != m_inputs[i].version) {
+                inputChanged = true;
+                break;
+            }
+        }
+        if (!inputChanged) {
+            return;
+        }
+    }
+    reevaluate();
+}
+
+void PropertyBase::reevaluate() {
+    std::vector<Dependency> previous;
+    previous.swap(m_inputs);
+    m_inputs.reserve(previous.size());
+
+    EvaluationFrame frame{this, &previous, s_frame};
+    s_frame = &frame;
+    struct Restore {
+        EvaluationFrame* outer;
+        ~Restore() { s_frame = outer; }
+    } restore{frame.outer};
+
+    bool valueChanged = evaluate();
+
+    // Drop edges to inputs this evaluation no longer read
+    for (const Dependency& old : previous) {
+        bool kept = std::any_of(m_inputs.begin(), m_inputs.end(),
+                                [&](const Dependency& d) { return d.node == old.node; });
+        if (!kept) {
+            old.node->removeDependent(this);
+        }
+    }
+
+    m_evaluated = true;
+    ++m_evaluations;
+    if (valueChanged) {
+        ++m_version;
+    }
+}
+
+void PropertyBase::unbind() {
+    unlinkInputs(m_inputs);
+    m_inputs.clear();
+    m_bound = false;
+    m_stale = false;
+    m_evaluated = false;
+}
+
+void PropertyBase::unlinkInputs(const std::vector<Dependency>& inputs) {
+    for (const Dependency& d : inputs) {
+        d.node->removeDependent(this);
+    }
+}
+
+void PropertyBase::removeDependent(PropertyBase* dependent) {
+    auto it = std::find(m_dependents.begin(), m_dependents.end(), dependent);
+    if (it != m_dependents.end()) {
+        *it = m_dependents.back();
+        m_dependents.pop_back();
+    }
+}
+
+// ---- PropertyWatcher ----
+
+PropertyWatcher::PropertyWatcher(std::function<void()> callback)
+    : m_callback(std::move(callback)) {}
+
+PropertyWatcher::~PropertyWatcher() {
+    if (m_queued) {
+        std::replace(s_pending.begin(), s_pending.end(), this, (PropertyWatcher*)nullptr);
+    }
+}
+
+void PropertyWatcher::watch(const PropertyBase& property) {
+    auto* node = const_cast<PropertyBase*>(&property);
+    for (const Dependency& d : m_inputs) {
+        if (d.node == node) {
+            return;
+        }
+    }
+    node->refresh();
+    m_inputs.push_back({node, node->m_version});
+    node->m_dependents.push_back(this);
+}
+
+void PropertyWatcher::invalidate() {
+    if (m_queued) {
+        return;
+    }
+    m_queued = true;
+    s_pending.push_back(this);
+}
+
+void PropertyWatcher::dispatch() {
+    bool inputChanged = false;
+    for (Dependency& d : m_inputs) {
+        d.node->refresh();
+        if (d.node->m_version != d.version) {
+            d.version = d.node->m_version;
+            inputChanged = true;
+        }
+    }
+    if (inputChanged && m_callback) {
+        m_callback();
+    }
+}
+
+// ---- PropertyBatch ----
+
+PropertyBatch::PropertyBatch() {
+    ++s_batchDepth;
+}
+
+PropertyBatch::~PropertyBatch() {
+    if (--s_batchDepth == 0) {
+        flush();
+    }
+}
+
+void PropertyBatch::flush() {
+    if (s_pending.empty()) {
+        return;
+    }
+
+    // Writes made by callbacks queue onto the list being walked
+    ++s_batchDepth;
+    for (size_t i = 0; i < s_pending.size(); ++i) {
+        PropertyWatcher* watcher = s_pending[i];
+        if (watcher) {
+            watcher->m_queued = false;
+            watcher->dispatch();
+        }
+    }
+    s_pending.clear();
+    --s_batchDepth;
+}
+
+} // namespace Aurora
@@ -0,0 +1,55 @@
+// ============================================
+// src/core/Signal.cpp
+// ============================================
+#include "aurora/core/Signal.hpp"
+
+namespace Aurora {
+
+InvokeQueue& InvokeQueue::main() {
+    static InvokeQueue queue;
+    return queue;
+}
+
+void InvokeQueue::post(std::function<void()> call) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pending.push_back(std::move(call));
+    }
+    if (m_wake) {
+        m_wake();
+    }
+}
+
+void InvokeQueue::setWakeHandler(std::function<void()> handler) {
+    m_wake = std::move(handler);
+}
+
+void InvokeQueue::drain() {
+    std::vector<std::function<void()>> running;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_pending.empty()) {
+            return;
+        }
+        running.swap(m_pending);
+    }
+
+    // Calls posted while draining run on the next drain
+    for (auto& call : running) {
+        call();
+    }
+
+    // Hand the buffer back so steady-state posting does not reallocate
+    running.clear();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_pending.empty()) {
+        m_pending.swap(running);
+    }
+}
+
+bool InvokeQueue::empty() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_pending.empty();
+}
+
+} // namespace Aurora
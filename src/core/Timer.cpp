@@ -0,0 +1,309 @@
+// ============================================
+// src/core/Timer.cpp
+// ============================================
+#include "aurora/core/Timer.hpp"
+#include <algorithm>
+#include <chrono>
+
+namespace Aurora {
+
+namespace {
+
+TimerId makeId(u32 index, u32 generation) {
+    return ((u64)generation << 32) | index;
+}
+
+u64 toNanoseconds(f64 seconds) {
+    return seconds > 0 ? (u64)(seconds * 1e9) : 0;
+}
+
+u64 rotateRight(u64 bits, u32 count) {
+    count &= 63;
+    return count ? (bits >> count) | (bits << (64 - count)) : bits;
+}
+
+} // namespace
+
+TimerWheel::TimerWheel() : TimerWheel(clock()) {}
+
+TimerWheel::TimerWheel(u64 startTime) : m_now(startTime), m_tick(startTime >> kTickShift) {
+    std::fill(std::begin(m_heads), std::end(m_heads), kNone);
+}
+
+TimerWheel::~TimerWheel() = default;
+
+u64 TimerWheel::clock() {
+    return (u64)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+TimerId TimerWheel::schedule(f64 delay, Callback callback, f64 tolerance) {
+    return add(toNanoseconds(delay), 0, toNanoseconds(tolerance), std::move(callback));
+}
+
+TimerId TimerWheel::scheduleRepeating(f64 interval, Callback callback, f64 tolerance) {
+    // A zero period would refire forever within one advance()
+    u64 period = std::max<u64>(toNanoseconds(interval), 1ull << kTickShift);
+    return add(period, period, toNanoseconds(tolerance), std::move(callback));
+}
+
+TimerId TimerWheel::add(u64 delay, u64 interval, u64 tolerance, Callback callback) {
+    u32 index;
+    if (!m_freeNodes.empty()) {
+        index = m_freeNodes.back();
+        m_freeNodes.pop_back();
+    } else {
+        index = (u32)m_nodes.size();
+        m_nodes.emplace_back();
+    }
+
+    Node& node = m_nodes[index];
+    node.callback = std::move(callback);
+    node.deadline = m_now + delay;
+    node.interval = interval;
+    node.tolerance = tolerance;
+    node.tick = fireTick(node.deadline, tolerance);
+    node.state = State::Scheduled;
+    link(index);
+
+    ++m_activeCount;
+    return makeId(index, node.generation);
+}
+
+bool TimerWheel::cancel(TimerId id) {
+    Node* node = lookup(id);
+    if (!node) {
+        return false;
+    }
+    u32 index = (u32)(node - m_nodes.data());
+    if (node->state == State::Scheduled) {
+        unlink(index);
+    }
+    release(index);
+    return true;
+}
+
+bool TimerWheel::isActive(TimerId id) const {
+    return lookup(id) != nullptr;
+}
+
+void TimerWheel::clear() {
+    for (u32 i = 0; i < (u32)m_nodes.size(); ++i) {
+        if (m_nodes[i].state != State::Free) {
+            release(i);
+        }
+    }
+    std::fill(std::begin(m_heads), std::end(m_heads), kNone);
+    std::fill(std::begin(m_occupied), std::end(m_occupied), 0);
+}
+
+u32 TimerWheel::advance(u64 time) {
+    m_now = std::max(m_now, time);
+    const u64 target = m_now >> kTickShift;
+    u32 fired = 0;
+
+    while (m_tick <= target) {
+        const u32 slot = (u32)(m_tick & (kSlots - 1));
+        if (slot == 0) {
+            cascade();
+        }
+
+        // Skip to the next occupied slot or the next cascade boundary, but
+        // never past target so later inserts are not pushed back
+        const u64 ahead = m_occupied[0] >> slot;
+        if (!(ahead & 1)) {
+            u64 skip = ahead ? (u64)__builtin_ctzll(ahead) : kSlots - slot;
+            m_tick = std::min(m_tick + skip, target + 1);
+            continue;
+        }
+
+        // Detach the slot first so callbacks may schedule and cancel freely
+        u32 index = m_heads[slot];
+        m_heads[slot] = kNone;
+        m_occupied[0] &= ~(1ull << slot);
+        while (index != kNone) {
+            Node& node = m_nodes[index];
+            u32 next = node.next;
+            node.prev = node.next = kNone;
+            node.state = State::Firing;
+            m_firing.push_back(index);
+            index = next;
+        }
+        ++m_tick;
+
+        for (size_t i = 0; i < m_firing.size(); ++i) {
+            const u32 firing = m_firing[i];
+            Node& node = m_nodes[firing];
+            if (node.state != State::Firing) {
+                continue;   // Cancelled by an earlier callback
+            }
+
+            Callback callback = std::move(node.callback);
+            const u32 generation = node.generation;
+            const bool repeating = node.interval != 0;
+            if (repeating) {
+                // Keep the phase; skip periods missed during a stall
+                node.deadline += node.interval;
+                if (node.deadline <= m_now) {
+                    node.deadline = m_now + node.interval;
+                }
+                node.tick = fireTick(node.deadline, node.tolerance);
+                node.state = State::Scheduled;
+                link(firing);
+            } else {
+                release(firing);
+            }
+
+            ++fired;
+            if (callback) {
+                callback();
+            }
+
+            if (repeating) {
+                Node& after = m_nodes[firing];
+                if (after.generation == generation && after.state != State::Free) {
+                    after.callback = std::move(callback);
+                }
+            }
+        }
+        m_firing.clear();
+    }
+
+    return fired;
+}
+
+u64 TimerWheel::nextDeadline() const {
+    if (m_activeCount == 0) {
+        return kNoDeadline;
+    }
+
+    u64 best = kNoDeadline;
+    if (m_occupied[0]) {
+        u64 rotated = rotateRight(m_occupied[0], (u32)(m_tick & (kSlots - 1)));
+        best = m_tick + (u64)__builtin_ctzll(rotated);
+    }
+
+    // Higher levels only need service at the boundary where they cascade.
+    // If m_tick sits on a boundary not yet processed, the current slot of
+    // each level turning over there is still due.
+    for (u32 level = 1; level < kLevels; ++level) {
+        if (!m_occupied[level]) {
+            continue;
+        }
+        const u32 shift = kSlotBits * level;
+        const u64 current = m_tick >> shift;
+        const u64 first = (m_tick & ((1ull << shift) - 1)) == 0 ? current : current + 1;
+        u64 rotated = rotateRight(m_occupied[level], (u32)(first & (kSlots - 1)));
+        u64 boundary = (first + (u64)__builtin_ctzll(rotated)) << shift;
+        best = std::min(best, boundary);
+    }
+
+    return best == kNoDeadline ? kNoDeadline : best << kTickShift;
+}
+
+u64 TimerWheel::fireTick(u64 deadline, u64 tolerance) const {
+    const u64 earliest = (deadline + (1ull << kTickShift) - 1) >> kTickShift;
+    const u64 latest = (deadline + tolerance) >> kTickShift;
+    if (latest <= earliest) {
+        return earliest;
+    }
+    // Most aligned tick in the window: clear everything below the highest
+    // bit where the two ends differ
+    u32 bit = 63 - (u32)__builtin_clzll(earliest ^ latest);
+    return latest & ~((1ull << bit) - 1);
+}
+
+void TimerWheel::link(u32 index) {
+    Node& node = m_nodes[index];
+    u64 expires = std::max(node.tick, m_tick);
+    const u64 delta = expires - m_tick;
+
+    u32 level = 0;
+    while (level < kLevels - 1 && delta >= (1ull << (kSlotBits * (level + 1)))) {
+        ++level;
+    }
+    // Beyond the wheel's range: park in the farthest slot and cascade again
+    const u64 range = 1ull << (kSlotBits * kLevels);
+    if (delta >= range) {
+        expires = m_tick + range - 1;
+    }
+
+    const u32 slot = (u32)((expires >> (kSlotBits * level)) & (kSlots - 1));
+    const u32 bucket = level * kSlots + slot;
+
+    node.bucket = (u16)bucket;
+    node.prev = kNone;
+    node.next = m_heads[bucket];
+    if (node.next != kNone) {
+        m_nodes[node.next].prev = index;
+    }
+    m_heads[bucket] = index;
+    m_occupied[level] |= 1ull << slot;
+}
+
+void TimerWheel::unlink(u32 index) {
+    Node& node = m_nodes[index];
+    if (node.prev != kNone) {
+        m_nodes[node.prev].next = node.next;
+    } else {
+        m_heads[node.bucket] = node.next;
+        if (node.next == kNone) {
+            m_occupied[node.bucket / kSlots] &= ~(1ull << (node.bucket % kSlots));
+        }
+    }
+    if (node.next != kNone) {
+        m_nodes[node.next].prev = node.prev;
+    }
+    node.prev = node.next = kNone;
+}
+
+void TimerWheel::cascade() {
+    // Re-file the slot of each level whose turn has come; a level only
+    // turns over when the one below wrapped to slot 0
+    for (u32 level = 1; level < kLevels; ++level) {
+        const u32 slot = (u32)((m_tick >> (kSlotBits * level)) & (kSlots - 1));
+        const u32 bucket = level * kSlots + slot;
+
+        u32 index = m_heads[bucket];
+        m_heads[bucket] = kNone;
+        m_occupied[level] &= ~(1ull << slot);
+        while (index != kNone) {
+            u32 next = m_nodes[index].next;
+            link(index);
+            index = next;
+        }
+
+        if (slot != 0) {
+            break;
+        }
+    }
+}
+
+void TimerWheel::release(u32 index) {
+    Node& node = m_nodes[index];
+    node.callback = nullptr;
+    node.state = State::Free;
+    node.prev = node.next = kNone;
+    ++node.generation;
+    m_freeNodes.push_back(index);
+    --m_activeCount;
+}
+
+TimerWheel::Node* TimerWheel::lookup(TimerId id) {
+    return const_cast<Node*>(static_cast<const TimerWheel*>(this)->lookup(id));
+}
+
+const TimerWheel::Node* TimerWheel::lookup(TimerId id) const {
+    u32 index = (u32)(id & 0xFFFFFFFFu);
+    u32 generation = (u32)(id >> 32);
+    if (index >= m_nodes.size()) {
+        return nullptr;
+    }
+    const Node& node = m_nodes[index];
+    if (node.state == State::Free || node.generation != generation) {
+        return nullptr;
+    }
+    return &node;
+}
+
+} // namespace Aurora
@@ -0,0 +1,92 @@
+// ============================================
+// src/graphics/opengl/GLContext.cpp
+// ============================================
+#include "aurora/graphics/GLContext.hpp"
+#include "aurora/graphics/OpenGL.hpp"
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace Aurora {
+
+namespace {
+
+struct PendingDelete {
+    u64 context;
+    GLContext::Object type;
+    GLuint name;
+};
+
+thread_local u64 t_current = 0;
+std::atomic<u64> s_next{1};
+
+// Names waiting for their context; s_pendingCount lets setCurrent() skip
+// the lock when nothing is queued, which is almost always
+std::mutex s_pendingMutex;
+std::vector<PendingDelete> s_pending;
+std::atomic<size_t> s_pendingCount{0};
+
+void deleteNow(GLContext::Object type, GLuint name) {
+    switch (type) {
+        case GLContext::Object::Framebuffer:
+            glDeleteFramebuffers(1, &name);
+            break;
+        case GLContext::Object::VertexArray:
+            glDeleteVertexArrays(1, &name);
+            break;
+    }
+}
+
+// Moves the entries of one context out of the queue
+std::vector<PendingDelete> takePending(u64 serial) {
+    std::vector<PendingDelete> taken;
+    if (s_pendingCount.load(std::memory_order_acquire) == 0) {
+        return taken;
+    }
+    std::lock_guard<std::mutex> lock(s_pendingMutex);
+    auto split = std::stable_partition(s_pending.begin(), s_pending.end(),
+                                       [serial](const PendingDelete& entry) { return entry.context != serial; });
+    taken.assign(split, s_pending.end());
+    s_pending.erase(split, s_pending.end());
+    s_pendingCount.store(s_pending.size(), std::memory_order_release);
+    return taken;
+}
+
+} // namespace
+
+u64 GLContext::current() {
+    return t_current;
+}
+
+void GLContext::setCurrent(u64 serial) {
+    t_current = serial;
+    if (serial) {
+        for (const auto& entry : takePending(serial)) {
+            deleteNow(entry.type, entry.name);
+        }
+    }
+}
+
+u64 GLContext::allocate() {
+    return s_next.fetch_add(1, std::memory_order_relaxed);
+}
+
+void GLContext::release(u64 serial) {
+    takePending(serial);
+}
+
+void GLContext::deleteObject(u64 context, Object type, u32 name) {
+    if (!name) {
+        return;
+    }
+    if (context == t_current) {
+        deleteNow(type, name);
+        return;
+    }
+    std::lock_guard<std::mutex> lock(s_pendingMutex);
+    s_pending.push_back({context, type, name});
+    s_pendingCount.store(s_pending.size(), std::memory_order_release);
+}
+
+} // namespace Aurora
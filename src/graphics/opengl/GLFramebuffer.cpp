@@ -0,0 +1,111 @@
+// ============================================
+// src/graphics/opengl/GLFramebuffer.cpp
+// ============================================
+#include "aurora/graphics/RenderTarget.hpp"
+#include "aurora/graphics/GLContext.hpp"
+
+namespace Aurora {
+
+RenderTarget::RenderTarget(u32 width, u32 height)
+    : RenderTarget(width, height, Config()) {}
+
+RenderTarget::RenderTarget(u32 width, u32 height, const Config& config)
+    : m_width(width), m_height(height), m_config(config) {
+    create();
+}
+
+RenderTarget::~RenderTarget() {
+    destroy();
+    // Framebuffers of other contexts are deleted when those are next current
+    for (const auto& entry : m_framebuffers) {
+        GLContext::deleteObject(entry.context, GLContext::Object::Framebuffer, entry.name);
+    }
+}
+
+void RenderTarget::bind() const {
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer().name);
+    glViewport(0, 0, m_width, m_height);
+}
+
+void RenderTarget::unbind() const {
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+void RenderTarget::resize(u32 width, u32 height) {
+    if (width == m_width && height == m_height) {
+        return;
+    }
+    destroy();
+    m_width = width;
+    m_height = height;
+    create();
+}
+
+void RenderTarget::create() {
+    Texture::Config texConfig;
+    texConfig.format = m_config.format;
+    texConfig.minFilter = m_config.filter;
+    texConfig.magFilter = m_config.filter;
+    texConfig.generateMipmaps = false;
+    m_texture = std::make_shared<Texture>(m_width, m_height, texConfig);
+
+    if (m_config.depth) {
+        glGenRenderbuffers(1, &m_depthBuffer);
+        glBindRenderbuffer(GL_RENDERBUFFER, m_depthBuffer);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, m_width, m_height);
+        glBindRenderbuffer(GL_RENDERBUFFER, 0);
+    }
+
+    // Framebuffers already made in other contexts reattach when next bound
+    ++m_attachments;
+    framebuffer();
+}
+
+void RenderTarget::destroy() {
+    if (m_depthBuffer) {
+        glDeleteRenderbuffers(1, &m_depthBuffer);
+        m_depthBuffer = 0;
+    }
+    m_texture.reset();
+}
+
+bool RenderTarget::isComplete() const {
+    return framebuffer().complete;
+}
+
+RenderTarget::Framebuffer& RenderTarget::framebuffer() const {
+    const u64 context = GLContext::current();
+    for (auto& entry : m_framebuffers) {
+        if (entry.context == context) {
+            if (entry.attachments != m_attachments) {
+                attach(entry);
+            }
+            return entry;
+        }
+    }
+
+    Framebuffer entry{context, 0, 0, false};
+    glGenFramebuffers(1, &entry.name);
+    attach(entry);
+    m_framebuffers.push_back(entry);
+    return m_framebuffers.back();
+}
+
+void RenderTarget::attach(Framebuffer& entry) const {
+    GLint previous = 0;
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previous);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, entry.name);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D,
+                           m_texture ? m_texture->textureId() : 0, 0);
+    if (m_config.depth) {
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT,
+                                  GL_RENDERBUFFER, m_depthBuffer);
+    }
+    entry.complete = glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+    entry.attachments = m_attachments;
+
+    glBindFramebuffer(GL_FRAMEBUFFER, (GLuint)previous);
+}
+
+} // namespace Aurora
@@ -0,0 +1,97 @@
+// ============================================
+// src/graphics/opengl/GLGpuTimer.cpp
+// ============================================
+#include "aurora/graphics/GpuTimer.hpp"
+#include "aurora/core/Profiler.hpp"
+
+namespace Aurora {
+
+GpuTimer::~GpuTimer() {
+    for (auto& frame : m_frames) {
+        if (!frame.queries.empty()) {
+            glDeleteQueries((GLsizei)frame.queries.size(), frame.queries.data());
+        }
+    }
+}
+
+void GpuTimer::beginFrame() {
+    // Oldest first, stopping at the first frame the GPU is still on
+    for (u64 i = kFramesInFlight - 1; i > 0; --i) {
+        if (m_frame < i) {
+            continue;
+        }
+        FrameQueries& frame = m_frames[(m_frame - i) % kFramesInFlight];
+        if (frame.pending && !resolve(frame)) {
+            break;
+        }
+    }
+
+    ++m_frame;
+    FrameQueries& frame = m_frames[m_frame % kFramesInFlight];
+    if (frame.pending) {
+        // Still unresolved after kFramesInFlight frames; give up on it
+        ++m_dropped;
+    }
+    frame.pending = false;
+    frame.passes.clear();
+    frame.profilerFrame = Profiler::shared().frameIndex();
+}
+
+void GpuTimer::endFrame() {
+    end();
+    FrameQueries& frame = m_frames[m_frame % kFramesInFlight];
+    frame.pending = !frame.passes.empty();
+}
+
+void GpuTimer::begin(Name pass) {
+    end();
+
+    FrameQueries& frame = m_frames[m_frame % kFramesInFlight];
+    if (frame.passes.size() == frame.queries.size()) {
+        GLuint query = 0;
+        glGenQueries(1, &query);
+        frame.queries.push_back(query);
+    }
+
+    GLuint query = frame.queries[frame.passes.size()];
+    frame.passes.push_back({pass, Profiler::now(), query});
+    glBeginQuery(GL_TIME_ELAPSED, query);
+    m_open = true;
+}
+
+void GpuTimer::end() {
+    if (m_open) {
+        glEndQuery(GL_TIME_ELAPSED);
+        m_open = false;
+    }
+}
+
+bool GpuTimer::resolve(FrameQueries& frame) {
+    // Queries complete in order, so the last one answers for the frame
+    GLint available = 0;
+    glGetQueryObjectiv(frame.passes.back().query, GL_QUERY_RESULT_AVAILABLE, &available);
+    if (!available) {
+        return false;
+    }
+
+    u64 total = 0;
+    const u64 now = Profiler::now();
+    Profiler& profiler = Profiler::shared();
+    for (const Pass& pass : frame.passes) {
+        GLuint64 elapsed = 0;
+        glGetQueryObjectui64v(pass.query, GL_QUERY_RESULT, &elapsed);
+        // A pass cannot take longer than the wall time since it was
+        // submitted; llvmpipe reports its first query against time zero
+        if (elapsed > now - pass.cpuStart) {
+            continue;
+        }
+        total += elapsed;
+        profiler.recordGpu(frame.profilerFrame, pass.name, pass.cpuStart, elapsed);
+    }
+
+    m_lastFrameTime = total * 1e-9;
+    frame.pending = false;
+    return true;
+}
+
+} // namespace Aurora
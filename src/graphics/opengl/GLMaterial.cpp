@@ -0,0 +1,185 @@
+// ============================================
+// src/graphics/opengl/GLMaterial.cpp
+// ============================================
+#include "aurora/graphics/Material.hpp"
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+namespace Aurora {
+
+namespace {
+
+const u32 s_blurTaps[] = {0, 5, 9, 17};
+
+bool readFile(const std::string& path, std::string& out) {
+    std::ifstream file(path);
+    if (!file) {
+        return false;
+    }
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    out = buffer.str();
+    return true;
+}
+
+void pack(f32* out, const Color& color) {
+    out[0] = color.r;
+    out[1] = color.g;
+    out[2] = color.b;
+    out[3] = color.a;
+}
+
+void pack(f32* out, const Vec2& value) {
+    out[0] = value.x;
+    out[1] = value.y;
+}
+
+} // namespace
+
+u32 Material::blurTaps(u32 features) {
+    return s_blurTaps[(features & kBlurMask) >> kBlurShift];
+}
+
+u32 Material::features() const {
+    u32 features = 0;
+    if (texture) {
+        features |= Textured;
+        // A Gaussian with sigma = radius / 2 is negligible past 2 sigma
+        if (blurRadius > 0.0f) {
+            u32 tier = blurRadius <= 2.0f ? 1 : blurRadius <= 4.0f ? 2 : 3;
+            features |= tier << kBlurShift;
+        }
+    }
+    if (cornerRadius > 0.0f) {
+        features |= Rounded;
+    }
+    if (borderWidth > 0.0f && borderColor.a > 0.0f) {
+        features |= Border;
+    }
+    if (gradient && gradientEnd != color) {
+        features |= Gradient;
+    }
+    return features;
+}
+
+ShaderVariants::ShaderVariants(const std::string& vertexSource, const std::string& fragmentSource,
+                               Shader::CompileMode mode)
+    : m_vertexSource(vertexSource), m_fragmentSource(fragmentSource), m_mode(mode) {}
+
+std::string ShaderVariants::preprocess(const std::string& source, u32 features) {
+    std::string defines;
+    if (features & Material::Textured) defines += "#define FEATURE_TEXTURED\n";
+    if (features & Material::Rounded) defines += "#define FEATURE_ROUNDED\n";
+    if (features & Material::Border) defines += "#define FEATURE_BORDER\n";
+    if (features & Material::Gradient) defines += "#define FEATURE_GRADIENT\n";
+    if (u32 taps = Material::blurTaps(features)) {
+        defines += "#define BLUR_TAPS " + std::to_string(taps) + "\n";
+    }
+
+    // #version must stay the first directive
+    size_t insertAt = 0;
+    if (source.compare(0, 8, "#version") == 0) {
+        size_t end = source.find('\n');
+        insertAt = end == std::string::npos ? source.size() : end + 1;
+    }
+    std::string result = source;
+    result.insert(insertAt, defines);
+    return result;
+}
+
+ShaderVariants::Variant* ShaderVariants::variant(u32 features) {
+    ++m_stats.requests;
+    auto it = m_variants.find(features);
+    if (it != m_variants.end()) {
+        ++m_stats.hits;
+        return &it->second;
+    }
+
+    Variant& entry = m_variants[features];
+    entry.shader = std::make_shared<Shader>(preprocess(m_vertexSource, features),
+                                            preprocess(m_fragmentSource, features), m_mode);
+    ++m_stats.variants;
+    return &entry;
+}
+
+Shader* ShaderVariants::get(u32 features) {
+    Variant* entry = variant(features);
+    return entry->shader->isValid() ? entry->shader.get() : nullptr;
+}
+
+void ShaderVariants::resolve(Variant& entry) {
+    entry.texture = entry.shader->uniform("uTexture");
+    entry.uniforms = std::make_unique<UniformBuffer>((u32)sizeof(MaterialUniforms));
+    entry.resolved = true;
+}
+
+Shader* ShaderVariants::bind(const Material& material) {
+    const u32 features = material.features();
+    Variant* entry = variant(features);
+    Shader& shader = *entry->shader;
+
+    shader.use();
+    if (!shader.isValid()) {
+        return nullptr;
+    }
+    if (!entry->resolved) {
+        resolve(*entry);
+    }
+    const u64 uploaded = shader.stats().uploadedBytes;
+
+    // Equal materials pack to equal bytes (blur fields stay zero when
+    // unused), so redrawing one skips the upload
+    MaterialUniforms block = {};
+    pack(block.color, material.color);
+    pack(block.borderColor, material.borderColor);
+    pack(block.gradientEnd, material.gradientEnd);
+    pack(block.size, material.size);
+    pack(block.gradientDirection, material.gradientDirection);
+    block.radius = material.cornerRadius;
+    block.borderWidth = material.borderWidth;
+
+    if (material.texture && (features & Material::Textured)) {
+        material.texture->bind(0);
+        shader.set(entry->texture, (i32)0);
+        if (features & Material::kBlurMask) {
+            pack(block.blurDirection, Vec2(material.blurDirection.x / (f32)material.texture->width(),
+                                           material.blurDirection.y / (f32)material.texture->height()));
+            block.blurSigma = material.blurRadius * 0.5f;
+        }
+    }
+
+    m_stats.uniformBytes += entry->uniforms->update(&block, sizeof(block));
+    entry->uniforms->bind(UniformBlock::Material);
+    m_stats.uniformBytes += shader.stats().uploadedBytes - uploaded;
+    return &shader;
+}
+
+void ShaderVariants::clear() {
+    m_variants.clear();
+    m_stats.variants = 0;
+}
+
+void ShaderVariants::resetStats() {
+    m_stats.requests = 0;
+    m_stats.hits = 0;
+    m_stats.uniformBytes = 0;
+}
+
+Ref<ShaderVariants> ShaderVariants::fromFiles(const std::string& vertexPath,
+                                              const std::string& fragmentPath,
+                                              Shader::CompileMode mode) {
+    std::string vertexSource, fragmentSource;
+    if (!readFile(vertexPath, vertexSource) || !readFile(fragmentPath, fragmentSource)) {
+        std::cerr << "[ShaderVariants] Failed to read " << vertexPath << " / " << fragmentPath << std::endl;
+        return nullptr;
+    }
+    return std::make_shared<ShaderVariants>(vertexSource, fragmentSource, mode);
+}
+
+Ref<ShaderVariants> ShaderVariants::createBuiltin(Shader::CompileMode mode) {
+    return std::make_shared<ShaderVariants>(Shader::basicVertexSource(),
+                                            Shader::basicFragmentSource(), mode);
+}
+
+} // namespace Aurora
@@ -0,0 +1,183 @@
+// ============================================
+// src/graphics/opengl/GLMesh.cpp
+// ============================================
+#include "aurora/graphics/Mesh.hpp"
+#include "aurora/graphics/GLContext.hpp"
+#include <cmath>
+#include <cstddef>
+
+namespace Aurora {
+
+namespace {
+
+GLenum toGL(Mesh::DrawMode mode) {
+    switch (mode) {
+        case Mesh::DrawMode::Triangles: return GL_TRIANGLES;
+        case Mesh::DrawMode::Lines: return GL_LINES;
+        case Mesh::DrawMode::Points: return GL_POINTS;
+        case Mesh::DrawMode::TriangleStrip: return GL_TRIANGLE_STRIP;
+        case Mesh::DrawMode::TriangleFan: return GL_TRIANGLE_FAN;
+    }
+    return GL_TRIANGLES;
+}
+
+constexpr f32 kPi = 3.14159265358979f;
+
+} // namespace
+
+Mesh::Mesh() : m_vbo(0), m_ebo(0) {
+    setupMesh();
+}
+
+Mesh::~Mesh() {
+    if (m_ebo) glDeleteBuffers(1, &m_ebo);
+    if (m_vbo) glDeleteBuffers(1, &m_vbo);
+    // Arrays of other contexts are deleted when those are next current
+    for (const auto& entry : m_vaos) {
+        GLContext::deleteObject(entry.first, GLContext::Object::VertexArray, entry.second);
+    }
+}
+
+void Mesh::setupMesh() {
+    glGenBuffers(1, &m_vbo);
+    glGenBuffers(1, &m_ebo);
+    vertexArray();
+}
+
+GLuint Mesh::vertexArray() const {
+    const u64 context = GLContext::current();
+    for (const auto& entry : m_vaos) {
+        if (entry.first == context) {
+            return entry.second;
+        }
+    }
+    
+    GLuint vao = 0;
+    glGenVertexArrays(1, &vao);
+    glBindVertexArray(vao);
+    glBindBuffer(GL_ARRAY_BUFFER, m_vbo);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_ebo);
+
+    // Locations match shaders/basic.vert
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, position));
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, texCoord));
+    glEnableVertexAttribArray(2);
+    glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, color));
+
+    glBindVertexArray(0);
+    m_vaos.emplace_back(context, vao);
+    return vao;
+}
+
+void Mesh::setVertices(const std::vector<Vertex>& vertices) {
+    glBindBuffer(GL_ARRAY_BUFFER, m_vbo);
+    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(Vertex), vertices.data(), GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    m_vertexCount = (u32)vertices.size();
+}
+
+void Mesh::setIndices(const std::vector<u32>& indices) {
+    // The element buffer binding is VAO state
+    glBindVertexArray(vertexArray());
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(u32), indices.data(), GL_STATIC_DRAW);
+    glBindVertexArray(0);
+    m_indexCount = (u32)indices.size();
+}
+
+void Mesh::updateVertices(u32 offset, const std::vector<Vertex>& vertices) {
+    if (offset + vertices.size() > m_vertexCount) {
+        return;
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, m_vbo);
+    glBufferSubData(GL_ARRAY_BUFFER, offset * sizeof(Vertex), vertices.size() * sizeof(Vertex), vertices.data());
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void Mesh::draw(DrawMode mode) const {
+    glBindVertexArray(vertexArray());
+    if (m_indexCount > 0) {
+        glDrawElements(toGL(mode), (GLsizei)m_indexCount, GL_UNSIGNED_INT, nullptr);
+    } else {
+        glDrawArrays(toGL(mode), 0, (GLsizei)m_vertexCount);
+    }
+}
+
+void Mesh::drawInstanced(u32 instanceCount, DrawMode mode) const {
+    glBindVertexArray(vertexArray());
+    if (m_indexCount > 0) {
+        glDrawElementsInstanced(toGL(mode), (GLsizei)m_indexCount, GL_UNSIGNED_INT, nullptr,
+                                (GLsizei)instanceCount);
+    } else {
+        glDrawArraysInstanced(toGL(mode), 0, (GLsizei)m_vertexCount, (GLsizei)instanceCount);
+    }
+}
+
+Ref<Mesh> Mesh::createQuad(f32 width, f32 height) {
+    // Origin at the top-left corner, texture v growing downwards
+    auto mesh = std::make_shared<Mesh>();
+    mesh->setVertices({
+        Vertex({0, 0}, {0, 0}),
+        Vertex({width, 0}, {1, 0}),
+        Vertex({width, height}, {1, 1}),
+        Vertex({0, height}, {0, 1}),
+    });
+    mesh->setIndices({0, 1, 2, 2, 3, 0});
+    return mesh;
+}
+
+Ref<Mesh> Mesh::createCircle(f32 radius, u32 segments) {
+    std::vector<Vertex> vertices;
+    std::vector<u32> indices;
+    vertices.reserve(segments + 1);
+    indices.reserve(segments * 3);
+
+    vertices.emplace_back(Vec2(0, 0), Vec2(0.5f, 0.5f));
+    for (u32 i = 0; i < segments; ++i) {
+        const f32 angle = 2.0f * kPi * (f32)i / (f32)segments;
+        const f32 c = std::cos(angle), s = std::sin(angle);
+        vertices.emplace_back(Vec2(c * radius, s * radius), Vec2(0.5f + c * 0.5f, 0.5f + s * 0.5f));
+        indices.insert(indices.end(), {0, i + 1, (i + 1) % segments + 1});
+    }
+
+    auto mesh = std::make_shared<Mesh>();
+    mesh->setVertices(vertices);
+    mesh->setIndices(indices);
+    return mesh;
+}
+
+Ref<Mesh> Mesh::createRoundedRect(f32 width, f32 height, f32 radius, u32 segments) {
+    radius = std::fmin(radius, std::fmin(width, height) * 0.5f);
+    const Vec2 corners[4] = {
+        {width - radius, radius},           // Top-right
+        {radius, radius},                   // Top-left
+        {radius, height - radius},          // Bottom-left
+        {width - radius, height - radius},  // Bottom-right
+    };
+
+    std::vector<Vertex> vertices;
+    std::vector<u32> indices;
+    vertices.emplace_back(Vec2(width * 0.5f, height * 0.5f), Vec2(0.5f, 0.5f));
+
+    // Fan around the outline, one arc per corner
+    for (u32 corner = 0; corner < 4; ++corner) {
+        for (u32 i = 0; i <= segments; ++i) {
+            const f32 angle = kPi * 0.5f * ((f32)corner + (f32)i / (f32)segments);
+            const Vec2 p(corners[corner].x + std::cos(angle) * radius,
+                         corners[corner].y - std::sin(angle) * radius);
+            vertices.emplace_back(p, Vec2(p.x / width, p.y / height));
+        }
+    }
+    const u32 outline = (u32)vertices.size() - 1;
+    for (u32 i = 0; i < outline; ++i) {
+        indices.insert(indices.end(), {0, i + 1, (i + 1) % outline + 1});
+    }
+
+    auto mesh = std::make_shared<Mesh>();
+    mesh->setVertices(vertices);
+    mesh->setIndices(indices);
+    return mesh;
+}
+
+} // namespace Aurora
@@ -0,0 +1,465 @@
+// ============================================
+// src/graphics/opengl/GLRenderer.cpp
+// ============================================
+#include "aurora/graphics/Renderer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+
+namespace Aurora {
+
+namespace {
+
+void identityMatrix(f32* out) {
+    std::memset(out, 0, 16 * sizeof(f32));
+    out[0] = out[5] = out[10] = out[15] = 1.0f;
+}
+
+} // namespace
+
+Renderer::Renderer() {
+    identityMatrix(m_projectionMatrix);
+    identityMatrix(m_viewMatrix);
+    identityMatrix(m_modelMatrix);
+}
+
+Renderer::~Renderer() {
+    shutdown();
+}
+
+bool Renderer::initialize() {
+    if (m_initialized) {
+        return true;
+    }
+
+#ifdef AURORA_USE_GLEW
+    glewExperimental = GL_TRUE;
+    if (glewInit() != GLEW_OK) {
+        std::cerr << "[Renderer] Failed to load OpenGL entry points" << std::endl;
+        return false;
+    }
+#endif
+
+    // Every draw goes through a material variant; without one nothing
+    // would render, so a broken built-in shader fails initialization
+    if (!m_materialShaders) {
+        m_materialShaders = ShaderVariants::createBuiltin();
+        if (!m_materialShaders->get(0)) {
+            std::cerr << "[Renderer] Built-in UI shader failed to compile" << std::endl;
+            m_materialShaders.reset();
+            return false;
+        }
+    }
+
+    // Unit quad, scaled and placed by the model matrix
+    m_quadMesh = Mesh::createQuad(1.0f, 1.0f);
+    frameUniforms();
+
+    glDisable(GL_DEPTH_TEST);
+    applyBlendMode(m_currentState.blendMode);
+
+    GLint viewport[4] = {0, 0, 0, 0};
+    glGetIntegerv(GL_VIEWPORT, viewport);
+    m_initialized = true;
+    setViewport(viewport[0], viewport[1], (u32)viewport[2], (u32)viewport[3]);
+    return true;
+}
+
+void Renderer::shutdown() {
+    if (!m_initialized) {
+        return;
+    }
+    m_commandBuffer.clear();
+    while (!m_stateStack.empty()) {
+        m_stateStack.pop();
+    }
+    m_currentState = RenderState();
+    m_quadMesh.reset();
+    m_circleMesh.reset();
+    m_frameUniforms.reset();
+    m_initialized = false;
+}
+
+void Renderer::beginFrame() {
+    m_gpuTimer.beginFrame();
+    m_stats.gpuTime = m_gpuTimer.lastFrameTime();
+}
+
+void Renderer::endFrame() {
+    executeCommands();
+    m_gpuTimer.endFrame();
+}
+
+void Renderer::beginPass(Name name) {
+    // Queries wrap the GL calls, so recorded commands must be issued first
+    executeCommands();
+    m_gpuTimer.begin(name);
+}
+
+void Renderer::endPass() {
+    executeCommands();
+    m_gpuTimer.end();
+}
+
+void Renderer::setViewport(i32 x, i32 y, u32 width, u32 height) {
+    executeCommands();
+    m_currentState.viewport = {(f32)x, (f32)y, (f32)width, (f32)height};
+    if (!m_renderTarget) {
+        glViewport(x, y, (GLsizei)width, (GLsizei)height);
+    }
+
+    const f32 viewport[4] = {(f32)x, (f32)y, (f32)width, (f32)height};
+    m_stats.bytesUploaded += frameUniforms().update(viewport, sizeof(viewport), offsetof(FrameUniforms, viewport));
+}
+
+void Renderer::setScissor(i32 x, i32 y, u32 width, u32 height) {
+    m_currentState.scissorEnabled = true;
+    m_currentState.scissorRect = {(f32)x, (f32)y, (f32)width, (f32)height};
+
+    // Callers use top-left window coordinates; GL counts rows from the bottom
+    const f32 surfaceHeight = m_renderTarget ? (f32)m_renderTarget->height()
+                                             : m_currentState.viewport.height;
+    RenderCommand cmd;
+    cmd.type = RenderCommand::Type::SetScissor;
+    cmd.scissor = {x, (i32)surfaceHeight - y - (i32)height, (i32)width, (i32)height};
+    m_commandBuffer.push_back(cmd);
+}
+
+void Renderer::disableScissor() {
+    if (!m_currentState.scissorEnabled) {
+        return;
+    }
+    m_currentState.scissorEnabled = false;
+
+    RenderCommand cmd;
+    cmd.type = RenderCommand::Type::SetScissor;
+    cmd.scissor = {0, 0, -1, -1};
+    m_commandBuffer.push_back(cmd);
+}
+
+void Renderer::setRenderTarget(RenderTarget* target) {
+    if (target == m_renderTarget) {
+        return;
+    }
+
+    // Commands recorded so far belong to the previous target
+    executeCommands();
+    m_renderTarget = target;
+    ++m_stats.stateChanges;
+
+    if (target) {
+        target->bind();
+    } else {
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        const Rect& vp = m_currentState.viewport;
+        glViewport((GLint)vp.x, (GLint)vp.y, (GLsizei)vp.width, (GLsizei)vp.height);
+    }
+}
+
+void Renderer::clear(const Color& color) {
+    RenderCommand cmd;
+    cmd.type = RenderCommand::Type::Clear;
+    cmd.clear = {color.r, color.g, color.b, color.a, GL_COLOR_BUFFER_BIT};
+    m_commandBuffer.push_back(cmd);
+}
+
+void Renderer::clearDepth(f32 depth) {
+    executeCommands();
+    glClearDepth(depth);
+    glClear(GL_DEPTH_BUFFER_BIT);
+}
+
+void Renderer::pushState() {
+    m_stateStack.push(m_currentState);
+}
+
+void Renderer::popState() {
+    if (m_stateStack.empty()) {
+        return;
+    }
+    executeCommands();
+    RenderState saved = m_stateStack.top();
+    m_stateStack.pop();
+
+    if (saved.blendMode != m_currentState.blendMode) {
+        setBlendMode(saved.blendMode);
+    }
+    if (saved.depthTest != m_currentState.depthTest) {
+        enableDepthTest(saved.depthTest);
+    }
+    if (saved.viewport != m_currentState.viewport) {
+        setViewport((i32)saved.viewport.x, (i32)saved.viewport.y,
+                    (u32)saved.viewport.width, (u32)saved.viewport.height);
+    }
+    if (saved.scissorEnabled) {
+        if (!m_currentState.scissorEnabled || saved.scissorRect != m_currentState.scissorRect) {
+            const Rect& r = saved.scissorRect;
+            setScissor((i32)r.x, (i32)r.y, (u32)r.width, (u32)r.height);
+        }
+    } else {
+        disableScissor();
+    }
+    setShader(saved.shader);
+    executeCommands();
+}
+
+void Renderer::setShader(Shader* shader) {
+    if (shader == m_currentState.shader) {
+        return;
+    }
+    m_currentState.shader = shader;
+
+    RenderCommand cmd;
+    cmd.type = RenderCommand::Type::SetShader;
+    cmd.setShader = {shader};
+    m_commandBuffer.push_back(cmd);
+}
+
+void Renderer::setMaterial(const Material& material) {
+    if (!m_materialShaders) {
+        return;
+    }
+
+    // Binding happens now, so earlier commands must run with the old state
+    executeCommands();
+    const u64 uploaded = m_materialShaders->stats().uniformBytes;
+    Shader* shader = m_materialShaders->bind(material);
+    m_stats.bytesUploaded += m_materialShaders->stats().uniformBytes - uploaded;
+
+    if (shader != m_currentState.shader) {
+        ++m_stats.stateChanges;
+    }
+    if (material.texture) {
+        ++m_stats.stateChanges;
+    }
+    m_currentState.shader = shader;
+    applyModelMatrix(shader);
+}
+
+void Renderer::setTexture(Texture* texture, u32 slot) {
+    if (!texture) {
+        return;
+    }
+    RenderCommand cmd;
+    cmd.type = RenderCommand::Type::SetTexture;
+    cmd.setTexture = {texture, slot};
+    m_commandBuffer.push_back(cmd);
+}
+
+void Renderer::draw(Mesh* mesh) {
+    if (!mesh) {
+        return;
+    }
+    RenderCommand cmd;
+    cmd.type = RenderCommand::Type::DrawMesh;
+    cmd.drawMesh = {mesh};
+    m_commandBuffer.push_back(cmd);
+}
+
+void Renderer::drawQuad(const Rect& rect, const Color& color) {
+    Material material;
+    material.color = color;
+    material.size = {rect.width, rect.height};
+    drawQuad(rect, material);
+}
+
+void Renderer::drawCircle(const Vec2& center, f32 radius, const Color& color) {
+    drawRoundedRect({center.x - radius, center.y - radius, radius * 2.0f, radius * 2.0f}, radius, color);
+}
+
+void Renderer::drawRoundedRect(const Rect& rect, f32 radius, const Color& color) {
+    Material material;
+    material.color = color;
+    material.size = {rect.width, rect.height};
+    material.cornerRadius = std::min(radius, std::min(rect.width, rect.height) * 0.5f);
+    drawQuad(rect, material);
+}
+
+void Renderer::drawQuad(const Rect& rect, const Material& material) {
+    if (!m_quadMesh) {
+        std::cerr << "[Renderer] drawQuad before initialize()" << std::endl;
+        return;
+    }
+
+    // Scale the unit quad, then move it into place; setMaterial uploads it
+    identityMatrix(m_modelMatrix);
+    m_modelMatrix[0] = rect.width;
+    m_modelMatrix[5] = rect.height;
+    m_modelMatrix[12] = rect.x;
+    m_modelMatrix[13] = rect.y;
+    setMaterial(material);
+    draw(m_quadMesh.get());
+}
+
+void Renderer::setBlendMode(BlendMode mode) {
+    if (mode == m_currentState.blendMode) {
+        return;
+    }
+    executeCommands();
+    applyBlendMode(mode);
+    m_currentState.blendMode = mode;
+    ++m_stats.stateChanges;
+}
+
+void Renderer::applyBlendMode(BlendMode mode) {
+    switch (mode) {
+        case BlendMode::None:
+            glDisable(GL_BLEND);
+            break;
+        case BlendMode::Alpha:
+            glEnable(GL_BLEND);
+            glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+            break;
+        case BlendMode::Additive:
+            glEnable(GL_BLEND);
+            glBlendFunc(GL_SRC_ALPHA, GL_ONE);
+            break;
+        case BlendMode::Multiply:
+            glEnable(GL_BLEND);
+            glBlendFunc(GL_DST_COLOR, GL_ONE_MINUS_SRC_ALPHA);
+            break;
+    }
+}
+
+void Renderer::enableDepthTest(bool enable) {
+    if (enable == m_currentState.depthTest) {
+        return;
+    }
+    executeCommands();
+    if (enable) {
+        glEnable(GL_DEPTH_TEST);
+    } else {
+        glDisable(GL_DEPTH_TEST);
+    }
+    m_currentState.depthTest = enable;
+    ++m_stats.stateChanges;
+}
+
+void Renderer::setDepthFunc(GLenum func) {
+    executeCommands();
+    glDepthFunc(func);
+}
+
+void Renderer::resetStats() {
+    // gpuTime belongs to a finished frame and is refreshed by beginFrame()
+    const f64 gpuTime = m_stats.gpuTime;
+    m_stats = Stats();
+    m_stats.gpuTime = gpuTime;
+}
+
+void Renderer::setProjectionMatrix(const f32* matrix) {
+    // Recorded draws must see the matrices they were issued under
+    executeCommands();
+    std::memcpy(m_projectionMatrix, matrix, sizeof(m_projectionMatrix));
+    m_stats.bytesUploaded +=
+        frameUniforms().update(matrix, sizeof(m_projectionMatrix), offsetof(FrameUniforms, projection));
+}
+
+void Renderer::setViewMatrix(const f32* matrix) {
+    executeCommands();
+    std::memcpy(m_viewMatrix, matrix, sizeof(m_viewMatrix));
+    m_stats.bytesUploaded += frameUniforms().update(matrix, sizeof(m_viewMatrix), offsetof(FrameUniforms, view));
+}
+
+void Renderer::setModelMatrix(const f32* matrix) {
+    // The bound program gets the new value now, after what it already drew
+    executeCommands();
+    std::memcpy(m_modelMatrix, matrix, sizeof(m_modelMatrix));
+    applyModelMatrix(m_currentState.shader);
+}
+
+void Renderer::applyModelMatrix(Shader* shader) {
+    if (!shader) {
+        return;
+    }
+    static const Name model("uModel");
+    const u64 uploaded = shader->stats().uploadedBytes;
+    shader->setMat4(model, m_modelMatrix);
+    m_stats.bytesUploaded += shader->stats().uploadedBytes - uploaded;
+}
+
+void Renderer::orthoMatrix(f32* out, f32 left, f32 right, f32 bottom, f32 top) {
+    identityMatrix(out);
+    out[0] = 2.0f / (right - left);
+    out[5] = 2.0f / (top - bottom);
+    out[10] = -1.0f;
+    out[12] = -(right + left) / (right - left);
+    out[13] = -(top + bottom) / (top - bottom);
+}
+
+void Renderer::translateMatrix(f32* out, f32 x, f32 y) {
+    identityMatrix(out);
+    out[12] = x;
+    out[13] = y;
+}
+
+void Renderer::scaleMatrix(f32* out, f32 x, f32 y) {
+    identityMatrix(out);
+    out[0] = x;
+    out[5] = y;
+}
+
+void Renderer::rotateMatrix(f32* out, f32 angle) {
+    identityMatrix(out);
+    const f32 c = std::cos(angle);
+    const f32 s = std::sin(angle);
+    out[0] = c;
+    out[1] = s;
+    out[4] = -s;
+    out[5] = c;
+}
+
+void Renderer::executeCommands() {
+    for (const RenderCommand& cmd : m_commandBuffer) {
+        switch (cmd.type) {
+            case RenderCommand::Type::DrawMesh: {
+                const Mesh* mesh = cmd.drawMesh.mesh;
+                mesh->draw();
+                const u32 count = mesh->indexCount() ? mesh->indexCount() : mesh->vertexCount();
+                ++m_stats.drawCalls;
+                m_stats.vertices += mesh->vertexCount();
+                m_stats.triangles += count / 3;
+                break;
+            }
+            case RenderCommand::Type::SetShader:
+                if (Shader* shader = cmd.setShader.shader) {
+                    shader->use();
+                    applyModelMatrix(shader);
+                } else {
+                    glUseProgram(0);
+                }
+                ++m_stats.stateChanges;
+                break;
+            case RenderCommand::Type::SetTexture:
+                cmd.setTexture.texture->bind(cmd.setTexture.slot);
+                ++m_stats.stateChanges;
+                break;
+            case RenderCommand::Type::SetScissor:
+                if (cmd.scissor.width < 0) {
+                    glDisable(GL_SCISSOR_TEST);
+                } else {
+                    glEnable(GL_SCISSOR_TEST);
+                    glScissor(cmd.scissor.x, cmd.scissor.y, cmd.scissor.width, cmd.scissor.height);
+                }
+                ++m_stats.stateChanges;
+                break;
+            case RenderCommand::Type::Clear:
+                glClearColor(cmd.clear.r, cmd.clear.g, cmd.clear.b, cmd.clear.a);
+                glClear(cmd.clear.flags);
+                break;
+        }
+    }
+    m_commandBuffer.clear();
+}
+
+UniformBuffer& Renderer::frameUniforms() {
+    if (!m_frameUniforms) {
+        m_frameUniforms = std::make_unique<UniformBuffer>((u32)sizeof(FrameUniforms));
+        m_frameUniforms->bind(UniformBlock::Frame);
+    }
+    return *m_frameUniforms;
+}
+
+} // namespace Aurora
@@ -1,85 +1,412 @@
-#include "graphics/opengl/Shader.h"
+// ============================================
+// src/graphics/opengl/GLShader.cpp
+// ============================================
+#include "aurora/graphics/Shader.hpp"
+#include "aurora/graphics/GLContext.hpp"
+#include "aurora/graphics/Material.hpp"
+#include "aurora/graphics/ShaderCache.hpp"
+#include <cstring>
+#include <fstream>
 #include <iostream>
-#include <glm/gtc/type_ptr.hpp>
+#include <mutex>
+#include <sstream>
+#include <vector>
+#ifndef AURORA_USE_GLEW
+#include <GL/glx.h>
+#endif
 
-OpenGLShader::OpenGLShader(const std::string& vertexSrc, const std::string& fragmentSrc) {
-    m_RendererID = createProgram(vertexSrc, fragmentSrc);
+namespace Aurora {
+
+namespace {
+
+// Shadow size of one element of a uniform type, in 32-bit words
+u32 componentWords(GLenum type) {
+    switch (type) {
+        case GL_FLOAT_VEC2: case GL_INT_VEC2: case GL_BOOL_VEC2: return 2;
+        case GL_FLOAT_VEC3: case GL_INT_VEC3: case GL_BOOL_VEC3: return 3;
+        case GL_FLOAT_VEC4: case GL_INT_VEC4: case GL_BOOL_VEC4: return 4;
+        case GL_FLOAT_MAT2: return 4;
+        case GL_FLOAT_MAT3: return 9;
+        case GL_FLOAT_MAT4: return 16;
+        default: return 1;  // Scalars and samplers
+    }
+}
+
+const char* const s_standardBlocks[] = {
+    "FrameUniforms",
+    "MaterialUniforms",
+};
+static_assert(sizeof(s_standardBlocks) / sizeof(s_standardBlocks[0]) == (size_t)UniformBlock::Count,
+              "Standard block names out of sync with UniformBlock");
+
+// Extension support and the compiler thread count are context state, so
+// each context is queried and configured on its own
+struct CompilerState {
+    u64 context;            // GLContext serial
+    bool parallel;          // GL_KHR_parallel_shader_compile
+    bool threadsSet;
+};
+
+std::mutex s_compilerMutex;
+std::vector<CompilerState> s_compilerStates;
+
+bool hasParallelCompile() {
+    GLint count = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+    for (GLint i = 0; i < count; ++i) {
+        const char* name = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, (GLuint)i));
+        if (name && std::strcmp(name, "GL_KHR_parallel_shader_compile") == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// State of the current context; s_compilerMutex must be held
+CompilerState& compilerState() {
+    const u64 context = GLContext::current();
+    for (CompilerState& state : s_compilerStates) {
+        if (state.context == context) {
+            return state;
+        }
+    }
+    s_compilerStates.push_back({context, hasParallelCompile(), false});
+    return s_compilerStates.back();
 }
 
-OpenGLShader::~OpenGLShader() {
-    glDeleteProgram(m_RendererID);
+void setMaxCompilerThreads(GLuint count) {
+#ifdef AURORA_USE_GLEW
+    glMaxShaderCompilerThreadsKHR(count);
+#else
+    // libGL does not export extension entry points; the GLX loader hands
+    // out dispatch stubs that also work for EGL contexts under GLVND
+    static auto maxThreads = (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)
+        glXGetProcAddressARB((const GLubyte*)"glMaxShaderCompilerThreadsKHR");
+    if (maxThreads) {
+        maxThreads(count);
+    }
+#endif
 }
 
-void OpenGLShader::bind() const {
-    glUseProgram(m_RendererID);
+bool readFile(const std::string& path, std::string& out) {
+    std::ifstream file(path);
+    if (!file) {
+        return false;
+    }
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    out = buffer.str();
+    return true;
 }
 
-void OpenGLShader::unbind() const {
+} // namespace
+
+Shader::Shader(const std::string& vertexSource, const std::string& fragmentSource,
+               CompileMode mode) {
+    ShaderCache& cache = ShaderCache::shared();
+    if (cache.enabled()) {
+        m_cacheKey = cache.key(vertexSource, fragmentSource);
+        m_program = cache.load(m_cacheKey);
+        if (m_program) {
+            reflect();
+            return;
+        }
+    }
+
+    if (mode == CompileMode::Deferred) {
+        std::lock_guard<std::mutex> lock(s_compilerMutex);
+        CompilerState& state = compilerState();
+        if (state.parallel && !state.threadsSet) {
+            setMaxCompilerThreads(0xFFFFFFFF);
+            state.threadsSet = true;
+        }
+    }
+
+    // Status is not queried until finish(): asking earlier would make the
+    // driver wait for each stage in turn
+    m_vertexShader = compileShader(GL_VERTEX_SHADER, vertexSource);
+    m_fragmentShader = compileShader(GL_FRAGMENT_SHADER, fragmentSource);
+
+    m_program = glCreateProgram();
+    if (cache.enabled()) {
+        glProgramParameteri(m_program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+    glAttachShader(m_program, m_vertexShader);
+    glAttachShader(m_program, m_fragmentShader);
+    glLinkProgram(m_program);
+    m_pending = true;
+
+    if (mode == CompileMode::Immediate) {
+        finish();
+    }
+}
+
+Shader::~Shader() {
+    if (m_vertexShader) glDeleteShader(m_vertexShader);
+    if (m_fragmentShader) glDeleteShader(m_fragmentShader);
+    if (m_program) {
+        glDeleteProgram(m_program);
+    }
+}
+
+void Shader::use() {
+    if (m_pending) {
+        finish();
+    }
+    glUseProgram(m_program);
+}
+
+void Shader::unbind() const {
     glUseProgram(0);
 }
 
-void OpenGLShader::setUniform(const std::string& name, int value) {
-    glUniform1i(getUniformLocation(name), value);
+bool Shader::isReady() const {
+    if (!m_pending || !parallelCompileSupported()) {
+        return true;
+    }
+    GLint done = GL_TRUE;
+    glGetProgramiv(m_program, GL_COMPLETION_STATUS_KHR, &done);
+    return done == GL_TRUE;
+}
+
+bool Shader::finish() {
+    if (!m_pending) {
+        return m_program != 0;
+    }
+    m_pending = false;
+
+    GLint result;
+    glGetProgramiv(m_program, GL_LINK_STATUS, &result);
+    if (result == GL_FALSE) {
+        logCompileErrors(m_vertexShader);
+        logCompileErrors(m_fragmentShader);
+
+        GLint length = 0;
+        glGetProgramiv(m_program, GL_INFO_LOG_LENGTH, &length);
+        std::string message(length > 0 ? length : 1, '\0');
+        glGetProgramInfoLog(m_program, (GLsizei)message.size(), nullptr, &message[0]);
+        std::cerr << "[Shader] Failed to link program: " << message.c_str() << std::endl;
+        glDeleteProgram(m_program);
+        m_program = 0;
+    } else {
+        glDetachShader(m_program, m_vertexShader);
+        glDetachShader(m_program, m_fragmentShader);
+    }
+
+    glDeleteShader(m_vertexShader);
+    glDeleteShader(m_fragmentShader);
+    m_vertexShader = m_fragmentShader = 0;
+
+    if (!m_program) {
+        return false;
+    }
+
+    ShaderCache::shared().store(m_cacheKey, m_program);
+    reflect();
+    return true;
+}
+
+UniformHandle Shader::uniform(Name name) {
+    if (m_pending) {
+        finish();
+    }
+    auto it = m_uniformCache.find(name);
+    return it != m_uniformCache.end() ? UniformHandle{it->second} : UniformHandle{};
+}
+
+Name Shader::uniformName(UniformHandle handle) const {
+    return handle.index < m_uniforms.size() ? m_uniforms[handle.index].name : Name();
+}
+
+bool Shader::store(UniformHandle handle, const void* value, u32 words) {
+    if (handle.index >= m_uniforms.size()) {
+        return false;
+    }
+    Uniform& u = m_uniforms[handle.index];
+    if (words <= u.words) {
+        u32* shadow = &m_shadow[u.offset];
+        if (u.initialized && std::memcmp(shadow, value, words * 4) == 0) {
+            ++m_stats.redundantWrites;
+            return false;
+        }
+        std::memcpy(shadow, value, words * 4);
+        u.initialized = true;
+    }
+    ++m_stats.uniformWrites;
+    m_stats.uploadedBytes += words * 4;
+    return true;
+}
+
+void Shader::set(UniformHandle handle, i32 value) {
+    if (store(handle, &value, 1)) {
+        glUniform1i(m_uniforms[handle.index].location, value);
+    }
+}
+
+void Shader::set(UniformHandle handle, f32 value) {
+    if (store(handle, &value, 1)) {
+        glUniform1f(m_uniforms[handle.index].location, value);
+    }
+}
+
+void Shader::set(UniformHandle handle, const Vec2& value) {
+    const f32 v[2] = {value.x, value.y};
+    if (store(handle, v, 2)) {
+        glUniform2f(m_uniforms[handle.index].location, v[0], v[1]);
+    }
+}
+
+void Shader::set(UniformHandle handle, const Color& value) {
+    const f32 v[4] = {value.r, value.g, value.b, value.a};
+    if (store(handle, v, 4)) {
+        glUniform4f(m_uniforms[handle.index].location, v[0], v[1], v[2], v[3]);
+    }
+}
+
+void Shader::setVec3(UniformHandle handle, f32 x, f32 y, f32 z) {
+    const f32 v[3] = {x, y, z};
+    if (store(handle, v, 3)) {
+        glUniform3f(m_uniforms[handle.index].location, x, y, z);
+    }
 }
 
-void OpenGLShader::setUniform(const std::string& name, float value) {
-    glUniform1f(getUniformLocation(name), value);
+void Shader::setVec4(UniformHandle handle, f32 x, f32 y, f32 z, f32 w) {
+    const f32 v[4] = {x, y, z, w};
+    if (store(handle, v, 4)) {
+        glUniform4f(m_uniforms[handle.index].location, x, y, z, w);
+    }
 }
 
-void OpenGLShader::setUniform(const std::string& name, const glm::vec3& value) {
-    glUniform3fv(getUniformLocation(name), 1, glm::value_ptr(value));
+void Shader::setMat4(UniformHandle handle, const f32* matrix) {
+    if (store(handle, matrix, 16)) {
+        glUniformMatrix4fv(m_uniforms[handle.index].location, 1, GL_FALSE, matrix);
+    }
 }
 
-void OpenGLShader::setUniform(const std::string& name, const glm::mat4& value) {
-    glUniformMatrix4fv(getUniformLocation(name), 1, GL_FALSE, glm::value_ptr(value));
+bool Shader::hasBlock(UniformBlock block) const {
+    return (m_blockMask >> (u32)block) & 1;
 }
 
-GLint OpenGLShader::getUniformLocation(const std::string& name) const {
-    if (m_UniformLocationCache.find(name) != m_UniformLocationCache.end())
-        return m_UniformLocationCache[name];
+void Shader::bindBlock(Name blockName, u32 binding) {
+    auto it = m_blocks.find(blockName);
+    if (it != m_blocks.end()) {
+        glUniformBlockBinding(m_program, it->second, binding);
+    }
+}
 
-    GLint location = glGetUniformLocation(m_RendererID, name.c_str());
-    if (location == -1) {
-        std::cerr << "[OpenGLShader] Warning: uniform '" << name << "' not found!\n";
+Ref<Shader> Shader::fromFiles(const std::string& vertexPath, const std::string& fragmentPath,
+                              CompileMode mode) {
+    std::string vertexSource, fragmentSource;
+    if (!readFile(vertexPath, vertexSource) || !readFile(fragmentPath, fragmentSource)) {
+        std::cerr << "[Shader] Failed to read " << vertexPath << " / " << fragmentPath << std::endl;
+        return nullptr;
     }
-    m_UniformLocationCache[name] = location;
-    return location;
+    auto shader = std::make_shared<Shader>(vertexSource, fragmentSource, mode);
+    return shader->isValid() ? shader : nullptr;
 }
 
-GLuint OpenGLShader::compileShader(GLenum type, const std::string& source) {
+namespace {
+
+Ref<Shader> createBuiltin(u32 features) {
+    auto shader = std::make_shared<Shader>(
+        ShaderVariants::preprocess(Shader::basicVertexSource(), features),
+        ShaderVariants::preprocess(Shader::basicFragmentSource(), features));
+    return shader->isValid() ? shader : nullptr;
+}
+
+} // namespace
+
+Ref<Shader> Shader::createBasic() {
+    return createBuiltin(0);
+}
+
+Ref<Shader> Shader::createTextured() {
+    return createBuiltin(Material::Textured);
+}
+
+Ref<Shader> Shader::createBlur() {
+    // The middle tier: 9 taps
+    return createBuiltin(Material::Textured | (2u << Material::kBlurShift));
+}
+
+bool Shader::parallelCompileSupported() {
+    std::lock_guard<std::mutex> lock(s_compilerMutex);
+    return compilerState().parallel;
+}
+
+GLuint Shader::compileShader(GLenum type, const std::string& source) {
     GLuint id = glCreateShader(type);
     const char* src = source.c_str();
     glShaderSource(id, 1, &src, nullptr);
     glCompileShader(id);
+    return id;
+}
 
-    int result;
-    glGetShaderiv(id, GL_COMPILE_STATUS, &result);
+void Shader::logCompileErrors(GLuint shader) {
+    GLint result;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &result);
     if (result == GL_FALSE) {
-        int length;
-        glGetShaderiv(id, GL_INFO_LOG_LENGTH, &length);
-        char* message = new char[length];
-        glGetShaderInfoLog(id, length, &length, message);
-        std::cerr << "[OpenGLShader] Failed to compile shader: " << message << std::endl;
-        delete[] message;
-        glDeleteShader(id);
-        return 0;
+        GLint length = 0;
+        glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &length);
+        std::string message(length > 0 ? length : 1, '\0');
+        glGetShaderInfoLog(shader, (GLsizei)message.size(), nullptr, &message[0]);
+        std::cerr << "[Shader] Failed to compile shader: " << message.c_str() << std::endl;
     }
-
-    return id;
 }
 
-GLuint OpenGLShader::createProgram(const std::string& vertexSrc, const std::string& fragmentSrc) {
-    GLuint program = glCreateProgram();
-    GLuint vs = compileShader(GL_VERTEX_SHADER, vertexSrc);
-    GLuint fs = compileShader(GL_FRAGMENT_SHADER, fragmentSrc);
+void Shader::reflect() {
+    m_uniforms.clear();
+    m_uniformCache.clear();
+    m_blocks.clear();
+    m_blockMask = 0;
+
+    GLint count = 0, maxLength = 0;
+    glGetProgramiv(m_program, GL_ACTIVE_UNIFORMS, &count);
+    glGetProgramiv(m_program, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+    std::string buffer(maxLength > 0 ? maxLength : 1, '\0');
+
+    u32 offset = 0;
+    for (GLint i = 0; i < count; ++i) {
+        GLsizei length = 0;
+        GLint size = 0;
+        GLenum type = 0;
+        glGetActiveUniform(m_program, (GLuint)i, (GLsizei)buffer.size(), &length, &size, &type, &buffer[0]);
 
-    glAttachShader(program, vs);
-    glAttachShader(program, fs);
-    glLinkProgram(program);
-    glValidateProgram(program);
+        std::string name(buffer.data(), length);
+        if (name.size() > 3 && name.compare(name.size() - 3, 3, "[0]") == 0) {
+            name.resize(name.size() - 3);
+        }
 
-    glDeleteShader(vs);
-    glDeleteShader(fs);
+        // Block members have no location; they are set through buffers
+        GLint location = glGetUniformLocation(m_program, name.c_str());
+        if (location < 0) {
+            continue;
+        }
 
-    return program;
+        u32 words = componentWords(type) * (u32)(size > 0 ? size : 1);
+        Name key(name);
+        m_uniformCache[key] = (u32)m_uniforms.size();
+        m_uniforms.push_back({key, location, type, offset, words, false});
+        offset += words;
+    }
+    m_shadow.assign(offset, 0);
+
+    GLint blockCount = 0;
+    glGetProgramiv(m_program, GL_ACTIVE_UNIFORM_BLOCKS, &blockCount);
+    for (GLint i = 0; i < blockCount; ++i) {
+        GLchar name[128];
+        GLsizei length = 0;
+        glGetActiveUniformBlockName(m_program, (GLuint)i, sizeof(name), &length, name);
+        std::string blockName(name, length);
+        m_blocks[Name(blockName)] = (GLuint)i;
+
+        for (u32 b = 0; b < (u32)UniformBlock::Count; ++b) {
+            if (blockName == s_standardBlocks[b]) {
+                glUniformBlockBinding(m_program, (GLuint)i, b);
+                m_blockMask |= 1u << b;
+            }
+        }
+    }
 }
+
+} // namespace Aurora
@@ -0,0 +1,184 @@
+// ============================================
+// src/graphics/opengl/GLShaderCache.cpp
+// ============================================
+#include "aurora/graphics/ShaderCache.hpp"
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+namespace Aurora {
+
+namespace {
+
+constexpr u32 kMagic = 0x42505541;  // "AUPB"
+constexpr u32 kVersion = 1;
+
+struct FileHeader {
+    u32 magic;
+    u32 version;
+    u64 key;
+    u32 format;
+    u32 length;
+};
+
+// FNV-1a, 64-bit
+u64 hashBytes(u64 hash, const void* data, size_t size) {
+    const u8* bytes = static_cast<const u8*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ bytes[i]) * 1099511628211ull;
+    }
+    return hash;
+}
+
+void appendString(std::string& out, GLenum name) {
+    const GLubyte* value = glGetString(name);
+    if (value) {
+        out += reinterpret_cast<const char*>(value);
+    }
+    out += '\n';
+}
+
+} // namespace
+
+ShaderCache& ShaderCache::shared() {
+    static ShaderCache cache;
+    return cache;
+}
+
+void ShaderCache::setDirectory(const std::string& directory) {
+    m_directory = directory;
+    if (!m_directory.empty()) {
+        std::error_code error;
+        std::filesystem::create_directories(m_directory, error);
+    }
+}
+
+bool ShaderCache::enabled() const {
+    return !m_directory.empty() && m_formats != 0;
+}
+
+const std::string& ShaderCache::driver() {
+    if (m_driver.empty()) {
+        appendString(m_driver, GL_VENDOR);
+        appendString(m_driver, GL_RENDERER);
+        appendString(m_driver, GL_VERSION);
+        appendString(m_driver, GL_SHADING_LANGUAGE_VERSION);
+    }
+    return m_driver;
+}
+
+u64 ShaderCache::key(const std::string& vertexSource, const std::string& fragmentSource) {
+    if (m_formats < 0) {
+        GLint formats = 0;
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+        m_formats = formats;
+    }
+
+    const std::string& id = driver();
+    u64 hash = 14695981039346656037ull;
+    hash = hashBytes(hash, &kVersion, sizeof(kVersion));
+    hash = hashBytes(hash, id.data(), id.size());
+    hash = hashBytes(hash, vertexSource.data(), vertexSource.size() + 1);
+    hash = hashBytes(hash, fragmentSource.data(), fragmentSource.size() + 1);
+    return hash;
+}
+
+std::string ShaderCache::pathFor(u64 key) const {
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx.bin", (unsigned long long)key);
+    return m_directory + "/" + name;
+}
+
+GLuint ShaderCache::load(u64 key) {
+    if (!enabled()) {
+        return 0;
+    }
+
+    const std::string path = pathFor(key);
+    std::ifstream file(path, std::ios::binary);
+    FileHeader header{};
+    if (!file || !file.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+        ++m_stats.misses;
+        return 0;
+    }
+
+    std::vector<char> binary;
+    bool valid = header.magic == kMagic && header.version == kVersion && header.key == key;
+    if (valid) {
+        binary.resize(header.length);
+        valid = (bool)file.read(binary.data(), binary.size());
+    }
+
+    GLuint program = 0;
+    GLint linked = GL_FALSE;
+    if (valid) {
+        program = glCreateProgram();
+        glProgramBinary(program, header.format, binary.data(), (GLsizei)binary.size());
+        glGetProgramiv(program, GL_LINK_STATUS, &linked);
+    }
+
+    if (linked != GL_TRUE) {
+        // Driver update or corrupt file: drop it and compile from source
+        if (program) {
+            glDeleteProgram(program);
+        }
+        file.close();
+        std::remove(path.c_str());
+        ++m_stats.rejected;
+        return 0;
+    }
+
+    ++m_stats.hits;
+    return program;
+}
+
+bool ShaderCache::store(u64 key, GLuint program) {
+    if (!enabled()) {
+        return false;
+    }
+
+    GLint length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) {
+        return false;
+    }
+
+    std::vector<char> binary(length);
+    GLenum format = 0;
+    glGetProgramBinary(program, length, &length, &format, binary.data());
+
+    FileHeader header{kMagic, kVersion, key, format, (u32)length};
+
+    // Write then rename, so a concurrent reader never sees half a file
+    const std::string path = pathFor(key);
+    const std::string temp = path + ".tmp";
+    {
+        std::ofstream file(temp, std::ios::binary | std::ios::trunc);
+        if (!file.write(reinterpret_cast<const char*>(&header), sizeof(header)) ||
+            !file.write(binary.data(), length)) {
+            return false;
+        }
+    }
+    if (std::rename(temp.c_str(), path.c_str()) != 0) {
+        std::remove(temp.c_str());
+        return false;
+    }
+
+    ++m_stats.stores;
+    return true;
+}
+
+void ShaderCache::clear() {
+    if (m_directory.empty()) {
+        return;
+    }
+    std::error_code error;
+    for (const auto& entry : std::filesystem::directory_iterator(m_directory, error)) {
+        if (entry.path().extension() == ".bin") {
+            std::filesystem::remove(entry.path(), error);
+        }
+    }
+}
+
+} // namespace Aurora
@@ -0,0 +1,176 @@
+// ============================================
+// src/graphics/opengl/GLTexture.cpp
+// ============================================
+#include "aurora/graphics/Texture.hpp"
+#include <cctype>
+#include <fstream>
+#include <iostream>
+
+namespace Aurora {
+
+namespace {
+
+struct FormatInfo {
+    GLint internalFormat;
+    GLenum format;
+    u32 bytesPerPixel;
+};
+
+FormatInfo formatInfo(Texture::Format format, bool srgb) {
+    switch (format) {
+        case Texture::Format::RGB: return {srgb ? GL_SRGB8 : GL_RGB8, GL_RGB, 3};
+        case Texture::Format::RGBA: return {srgb ? GL_SRGB8_ALPHA8 : GL_RGBA8, GL_RGBA, 4};
+        case Texture::Format::BGR: return {srgb ? GL_SRGB8 : GL_RGB8, GL_BGR, 3};
+        case Texture::Format::BGRA: return {srgb ? GL_SRGB8_ALPHA8 : GL_RGBA8, GL_BGRA, 4};
+        case Texture::Format::Red: return {GL_R8, GL_RED, 1};
+        case Texture::Format::RG: return {GL_RG8, GL_RG, 2};
+    }
+    return {GL_RGBA8, GL_RGBA, 4};
+}
+
+GLint toGL(Texture::Filter filter, bool mipmaps) {
+    switch (filter) {
+        case Texture::Filter::Nearest: return GL_NEAREST;
+        case Texture::Filter::Linear: return GL_LINEAR;
+        case Texture::Filter::Trilinear: return mipmaps ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR;
+    }
+    return GL_LINEAR;
+}
+
+GLint toGL(Texture::Wrap wrap) {
+    switch (wrap) {
+        case Texture::Wrap::Repeat: return GL_REPEAT;
+        case Texture::Wrap::Clamp: return GL_CLAMP_TO_EDGE;
+        case Texture::Wrap::Mirror: return GL_MIRRORED_REPEAT;
+    }
+    return GL_CLAMP_TO_EDGE;
+}
+
+// Next whitespace-separated header token, skipping '#' comments
+bool readToken(std::istream& in, std::string& token) {
+    token.clear();
+    char c;
+    while (in.get(c)) {
+        if (c == '#') {
+            std::string comment;
+            std::getline(in, comment);
+        } else if (!std::isspace((unsigned char)c)) {
+            token += c;
+            break;
+        }
+    }
+    while (in.get(c) && !std::isspace((unsigned char)c)) {
+        token += c;
+    }
+    return !token.empty();
+}
+
+} // namespace
+
+Texture::Texture(u32 width, u32 height)
+    : Texture(width, height, Config()) {}
+
+Texture::Texture(u32 width, u32 height, const Config& config)
+    : m_width(width), m_height(height), m_config(config) {
+    createTexture(nullptr);
+}
+
+Texture::Texture(const std::string& path)
+    : Texture(path, Config()) {}
+
+Texture::Texture(const std::string& path, const Config& config)
+    : m_config(config) {
+    std::vector<u8> pixels;
+    if (loadPPM(path, pixels)) {
+        m_config.format = Format::RGB;
+    } else {
+        std::cerr << "[Texture] Failed to load " << path << std::endl;
+        m_width = m_height = 1;
+        m_config.format = Format::RGBA;
+        m_config.generateMipmaps = false;
+        pixels = {255, 0, 255, 255};
+    }
+    createTexture(pixels.data());
+}
+
+Texture::~Texture() {
+    if (m_texture) {
+        glDeleteTextures(1, &m_texture);
+    }
+}
+
+void Texture::createTexture(const void* data) {
+    const FormatInfo info = formatInfo(m_config.format, m_config.srgb);
+
+    glGenTextures(1, &m_texture);
+    glBindTexture(GL_TEXTURE_2D, m_texture);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage2D(GL_TEXTURE_2D, 0, info.internalFormat, (GLsizei)m_width, (GLsizei)m_height,
+                 0, info.format, GL_UNSIGNED_BYTE, data);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
+                    toGL(m_config.minFilter, m_config.generateMipmaps));
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER,
+                    m_config.magFilter == Filter::Nearest ? GL_NEAREST : GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, toGL(m_config.wrapS));
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, toGL(m_config.wrapT));
+    if (m_config.generateMipmaps && data) {
+        glGenerateMipmap(GL_TEXTURE_2D);
+    }
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+bool Texture::loadPPM(const std::string& path, std::vector<u8>& pixels) {
+    std::ifstream file(path, std::ios::binary);
+    std::string magic, width, height, maxValue;
+    if (!file || !readToken(file, magic) || magic != "P6" ||
+        !readToken(file, width) || !readToken(file, height) ||
+        !readToken(file, maxValue) || maxValue != "255") {
+        return false;
+    }
+
+    m_width = (u32)std::stoul(width);
+    m_height = (u32)std::stoul(height);
+    pixels.resize((size_t)m_width * m_height * 3);
+    file.read((char*)pixels.data(), (std::streamsize)pixels.size());
+    return file.gcount() == (std::streamsize)pixels.size() && m_width && m_height;
+}
+
+void Texture::bind(u32 slot) const {
+    glActiveTexture(GL_TEXTURE0 + slot);
+    glBindTexture(GL_TEXTURE_2D, m_texture);
+}
+
+void Texture::unbind() const {
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+void Texture::setData(const void* data, u32 size) {
+    const FormatInfo info = formatInfo(m_config.format, m_config.srgb);
+    if (size != m_width * m_height * info.bytesPerPixel) {
+        std::cerr << "[Texture] setData expects " << m_width * m_height * info.bytesPerPixel
+                  << " bytes, got " << size << std::endl;
+        return;
+    }
+    setSubData(0, 0, m_width, m_height, data);
+}
+
+void Texture::setSubData(u32 x, u32 y, u32 width, u32 height, const void* data) {
+    const FormatInfo info = formatInfo(m_config.format, m_config.srgb);
+    glBindTexture(GL_TEXTURE_2D, m_texture);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, (GLint)x, (GLint)y, (GLsizei)width, (GLsizei)height,
+                    info.format, GL_UNSIGNED_BYTE, data);
+    if (m_config.generateMipmaps) {
+        glGenerateMipmap(GL_TEXTURE_2D);
+    }
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+Ref<Texture> Texture::createRenderTarget(u32 width, u32 height, bool depth) {
+    // Color only; depth attachments belong to RenderTarget (Config::depth)
+    Config config;
+    config.generateMipmaps = false;
+    return std::make_shared<Texture>(width, height, config);
+}
+
+} // namespace Aurora
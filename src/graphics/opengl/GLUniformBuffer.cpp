@@ -0,0 +1,53 @@
+// ============================================
+// src/graphics/opengl/GLUniformBuffer.cpp
+// ============================================
+#include "aurora/graphics/UniformBuffer.hpp"
+#include <cstring>
+
+namespace Aurora {
+
+UniformBuffer::UniformBuffer(u32 size) : m_size(size), m_shadow(size, 0) {
+    glGenBuffers(1, &m_buffer);
+    glBindBuffer(GL_UNIFORM_BUFFER, m_buffer);
+    glBufferData(GL_UNIFORM_BUFFER, size, m_shadow.data(), GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+}
+
+UniformBuffer::~UniformBuffer() {
+    if (m_buffer) {
+        glDeleteBuffers(1, &m_buffer);
+    }
+}
+
+u32 UniformBuffer::update(const void* data, u32 size, u32 offset) {
+    if (offset + size > m_size) {
+        return 0;
+    }
+
+    // Narrow to the first and last differing bytes
+    const u8* bytes = static_cast<const u8*>(data);
+    const u8* shadow = &m_shadow[offset];
+    u32 begin = 0;
+    while (begin < size && bytes[begin] == shadow[begin]) {
+        ++begin;
+    }
+    if (begin == size) {
+        return 0;
+    }
+    u32 end = size;
+    while (bytes[end - 1] == shadow[end - 1]) {
+        --end;
+    }
+    std::memcpy(&m_shadow[offset + begin], bytes + begin, end - begin);
+
+    glBindBuffer(GL_UNIFORM_BUFFER, m_buffer);
+    glBufferSubData(GL_UNIFORM_BUFFER, offset + begin, end - begin, bytes + begin);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    return end - begin;
+}
+
+void UniformBuffer::bind(u32 binding) const {
+    glBindBufferBase(GL_UNIFORM_BUFFER, binding, m_buffer);
+}
+
+} // namespace Aurora
@@ -0,0 +1,582 @@
+// ============================================
+// src/graphics/software/SWRenderer.cpp
+// ============================================
+#include "aurora/graphics/SoftwareRenderer.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace Aurora {
+
+namespace {
+
+enum class Kind : u8 {
+    Clear,      // Replace with a solid color
+    Flat,       // Axis-aligned solid rectangle
+    Shaded      // Anything needing per-pixel work at least at its edges
+};
+
+// Exact for 0..255*255 (x / 255 rounded to nearest)
+inline u32 div255(u32 x) {
+    x += 128;
+    return (x + (x >> 8)) >> 8;
+}
+
+inline u32 toByte(f32 v) {
+    return (u32)(std::clamp(v, 0.0f, 1.0f) * 255.0f + 0.5f);
+}
+
+inline f32 clamp01(f32 v) {
+    return std::clamp(v, 0.0f, 1.0f);
+}
+
+// Straight float color to premultiplied 0xAARRGGBB
+inline u32 premultiply(const f32* c) {
+    const f32 a = clamp01(c[3]);
+    return (toByte(a) << 24) | (toByte(c[0] * a) << 16) | (toByte(c[1] * a) << 8) | toByte(c[2] * a);
+}
+
+inline u32 srcOver(u32 dst, u32 src) {
+    const u32 inv = 255 - (src >> 24);
+    u32 out = 0;
+    for (u32 shift = 0; shift < 32; shift += 8) {
+        const u32 c = ((src >> shift) & 0xFF) + div255(((dst >> shift) & 0xFF) * inv);
+        out |= std::min(c, 255u) << shift;
+    }
+    return out;
+}
+
+inline u32 addSaturate(u32 dst, u32 src) {
+    u32 out = 0;
+    for (u32 shift = 0; shift < 32; shift += 8) {
+        const u32 c = ((src >> shift) & 0xFF) + ((dst >> shift) & 0xFF);
+        out |= std::min(c, 255u) << shift;
+    }
+    return out;
+}
+
+// GL_DST_COLOR, GL_ONE_MINUS_SRC_ALPHA with a straight-alpha source
+inline u32 multiply(u32 dst, const f32* straight, u32 src) {
+    const u32 inv = 255 - (src >> 24);
+    u32 out = (std::min((src >> 24) + div255((dst >> 24) * inv), 255u)) << 24;
+    for (u32 i = 0, shift = 16; i < 3; ++i, shift -= 8) {
+        const u32 d = (dst >> shift) & 0xFF;
+        const u32 c = div255(toByte(straight[i]) * d) + div255(d * inv);
+        out |= std::min(c, 255u) << shift;
+    }
+    return out;
+}
+
+// ----------------------------------------------------------------------
+// Span kernels: n pixels starting at dst, one constant color
+
+void fillSpan(u32* dst, u32 n, u32 color) {
+    u32 i = 0;
+#if defined(__SSE2__)
+    const __m128i c = _mm_set1_epi32((int)color);
+    for (; i + 4 <= n; i += 4) {
+        _mm_storeu_si128((__m128i*)(dst + i), c);
+    }
+#endif
+    for (; i < n; ++i) {
+        dst[i] = color;
+    }
+}
+
+void srcOverSpan(u32* dst, u32 n, u32 color) {
+    u32 i = 0;
+#if defined(__SSE2__)
+    // Same arithmetic as srcOver(), 4 pixels at a time in 16-bit lanes
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i src = _mm_set1_epi32((int)color);
+    const __m128i inv = _mm_set1_epi16((short)(255 - (color >> 24)));
+    const __m128i bias = _mm_set1_epi16(128);
+    for (; i + 4 <= n; i += 4) {
+        __m128i d = _mm_loadu_si128((const __m128i*)(dst + i));
+        __m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), inv), bias);
+        __m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), inv), bias);
+        lo = _mm_srli_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), 8);
+        hi = _mm_srli_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), 8);
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_adds_epu8(_mm_packus_epi16(lo, hi), src));
+    }
+#endif
+    for (; i < n; ++i) {
+        dst[i] = srcOver(dst[i], color);
+    }
+}
+
+void addSpan(u32* dst, u32 n, u32 color) {
+    u32 i = 0;
+#if defined(__SSE2__)
+    const __m128i src = _mm_set1_epi32((int)color);
+    for (; i + 4 <= n; i += 4) {
+        __m128i d = _mm_loadu_si128((const __m128i*)(dst + i));
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_adds_epu8(d, src));
+    }
+#endif
+    for (; i < n; ++i) {
+        dst[i] = addSaturate(dst[i], color);
+    }
+}
+
+inline f32 roundedBoxDistance(f32 px, f32 py, f32 hw, f32 hh, f32 radius) {
+    const f32 qx = std::fabs(px) - hw + radius;
+    const f32 qy = std::fabs(py) - hh + radius;
+    const f32 ox = std::max(qx, 0.0f), oy = std::max(qy, 0.0f);
+    return std::min(std::max(qx, qy), 0.0f) + std::sqrt(ox * ox + oy * oy) - radius;
+}
+
+} // namespace
+
+struct SoftwareRenderer::Command {
+    i32 x0, y0, x1, y1;         // Pixels covered, clipped
+    f32 x, y, w, h;             // Quad rectangle
+    f32 sizeW, sizeH;           // Material::size, the space the SDF works in
+    f32 radius;
+    f32 borderWidth;
+    f32 color[4];               // Straight alpha
+    f32 borderColor[4];
+    f32 gradientEnd[4];
+    f32 gradientDir[2];
+    const Image* image;
+    u32 solid;                  // Premultiplied color for Clear, Flat and interiors
+    Kind kind;
+    BlendMode blend;
+    bool shaped;                // Rounded or bordered: coverage from the SDF
+    bool gradient;
+    bool uniform;               // Interior is a single color
+};
+
+SoftwareRenderer::Image::Image(u32 width, u32 height, const u8* rgba)
+    : m_width(width), m_height(height), m_pixels((size_t)width * height) {
+    std::memcpy(m_pixels.data(), rgba, m_pixels.size() * 4);
+}
+
+SoftwareRenderer::SoftwareRenderer() : SoftwareRenderer(Config()) {}
+
+SoftwareRenderer::SoftwareRenderer(const Config& config) : m_config(config) {
+    u32 size = std::max(config.tileSize, 8u);
+    m_tileShift = 0;
+    while ((1u << (m_tileShift + 1)) <= size) {
+        ++m_tileShift;
+    }
+}
+
+SoftwareRenderer::~SoftwareRenderer() {
+    shutdown();
+}
+
+bool SoftwareRenderer::initialize() {
+    if (!m_workers.empty()) {
+        return true;
+    }
+    u32 threads = m_config.threads ? m_config.threads : std::thread::hardware_concurrency();
+    threads = std::max(threads, 1u);
+
+    m_stopping = false;
+    for (u32 i = 1; i < threads; ++i) {
+        m_workers.emplace_back([this] { workerLoop(); });
+    }
+    return true;
+}
+
+void SoftwareRenderer::shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_start.notify_all();
+    for (std::thread& worker : m_workers) {
+        worker.join();
+    }
+    m_workers.clear();
+    m_commands.clear();
+}
+
+void SoftwareRenderer::beginFrame() {
+    m_commands.clear();
+    m_rasterStats = RasterStats();
+    m_stats.gpuTime = 0;
+}
+
+void SoftwareRenderer::endFrame() {
+    const auto start = std::chrono::steady_clock::now();
+    bin();
+    rasterizeTiles();
+    m_commands.clear();
+    m_rasterStats.rasterTime =
+        std::chrono::duration<f64>(std::chrono::steady_clock::now() - start).count();
+}
+
+void SoftwareRenderer::setViewport(i32 x, i32 y, u32 width, u32 height) {
+    if (width == m_width && height == m_height) {
+        return;
+    }
+    // Commands recorded for the old size would be clipped wrongly
+    if (!m_commands.empty()) {
+        endFrame();
+    }
+    m_width = width;
+    m_height = height;
+    m_pixels.assign((size_t)width * height, 0);
+
+    const u32 tile = 1u << m_tileShift;
+    m_tilesX = (width + tile - 1) >> m_tileShift;
+    m_tilesY = (height + tile - 1) >> m_tileShift;
+    m_bins.assign((size_t)m_tilesX * m_tilesY, {});
+    m_activeTiles.clear();
+}
+
+void SoftwareRenderer::setScissor(i32 x, i32 y, u32 width, u32 height) {
+    const i32 scissor[4] = {x, y, x + (i32)width, y + (i32)height};
+    if (!m_state.scissorEnabled || std::memcmp(scissor, m_state.scissor, sizeof(scissor)) != 0) {
+        ++m_stats.stateChanges;
+    }
+    m_state.scissorEnabled = true;
+    std::memcpy(m_state.scissor, scissor, sizeof(scissor));
+}
+
+void SoftwareRenderer::disableScissor() {
+    if (m_state.scissorEnabled) {
+        ++m_stats.stateChanges;
+    }
+    m_state.scissorEnabled = false;
+}
+
+void SoftwareRenderer::clear(const Color& color) {
+    Command cmd{};
+    cmd.kind = Kind::Clear;
+    cmd.x0 = 0;
+    cmd.y0 = 0;
+    cmd.x1 = (i32)m_width;
+    cmd.y1 = (i32)m_height;
+    if (m_state.scissorEnabled) {
+        cmd.x0 = std::max(cmd.x0, m_state.scissor[0]);
+        cmd.y0 = std::max(cmd.y0, m_state.scissor[1]);
+        cmd.x1 = std::min(cmd.x1, m_state.scissor[2]);
+        cmd.y1 = std::min(cmd.y1, m_state.scissor[3]);
+    }
+    if (cmd.x0 >= cmd.x1 || cmd.y0 >= cmd.y1) {
+        return;
+    }
+    const f32 c[4] = {color.r, color.g, color.b, color.a};
+    cmd.solid = premultiply(c);
+    m_commands.push_back(cmd);
+}
+
+void SoftwareRenderer::pushState() {
+    m_stateStack.push_back(m_state);
+}
+
+void SoftwareRenderer::popState() {
+    if (m_stateStack.empty()) {
+        return;
+    }
+    const State& saved = m_stateStack.back();
+    if (saved.blendMode != m_state.blendMode) {
+        ++m_stats.stateChanges;
+    }
+    if (saved.scissorEnabled != m_state.scissorEnabled ||
+        std::memcmp(saved.scissor, m_state.scissor, sizeof(saved.scissor)) != 0) {
+        ++m_stats.stateChanges;
+    }
+    m_state = saved;
+    m_stateStack.pop_back();
+}
+
+void SoftwareRenderer::drawQuad(const Rect& rect, const Material& material) {
+    record(rect, material, nullptr);
+}
+
+void SoftwareRenderer::drawImage(const Rect& rect, const Image& image, const Color& tint) {
+    Material material;
+    material.color = tint;
+    material.size = {rect.width, rect.height};
+    record(rect, material, &image);
+}
+
+void SoftwareRenderer::setBlendMode(BlendMode mode) {
+    if (mode != m_state.blendMode) {
+        ++m_stats.stateChanges;
+        m_state.blendMode = mode;
+    }
+}
+
+void SoftwareRenderer::record(const Rect& rect, const Material& material, const Image* image) {
+    // Counted like GL draws, which are issued even when clipped away
+    ++m_stats.drawCalls;
+    m_stats.triangles += 2;
+    m_stats.vertices += 4;
+    if (!(rect.width > 0.0f) || !(rect.height > 0.0f)) {
+        return;
+    }
+
+    // Pixels whose centers fall inside the rectangle, as GL rasterizes it:
+    // edges snapped to 1/256 pixel with ties to even, and a center on an edge
+    // belongs to the left and bottom edges (GL's lower-left rule under the
+    // y-down projection)
+    Command cmd{};
+    const auto snap = [](f32 v) { return std::nearbyint(v * 256.0f) / 256.0f; };
+    cmd.x0 = std::max((i32)std::ceil(snap(rect.x) - 0.5f), 0);
+    cmd.y0 = std::max((i32)std::floor(snap(rect.y) + 0.5f), 0);
+    cmd.x1 = std::min((i32)std::ceil(snap(rect.x + rect.width) - 0.5f), (i32)m_width);
+    cmd.y1 = std::min((i32)std::floor(snap(rect.y + rect.height) + 0.5f), (i32)m_height);
+    if (m_state.scissorEnabled) {
+        cmd.x0 = std::max(cmd.x0, m_state.scissor[0]);
+        cmd.y0 = std::max(cmd.y0, m_state.scissor[1]);
+        cmd.x1 = std::min(cmd.x1, m_state.scissor[2]);
+        cmd.y1 = std::min(cmd.y1, m_state.scissor[3]);
+    }
+    if (cmd.x0 >= cmd.x1 || cmd.y0 >= cmd.y1) {
+        return;
+    }
+
+    // Same feature selection as the GL shader variants
+    const u32 features = material.features();
+    cmd.x = rect.x;
+    cmd.y = rect.y;
+    cmd.w = rect.width;
+    cmd.h = rect.height;
+    cmd.sizeW = material.size.x > 0.0f ? material.size.x : rect.width;
+    cmd.sizeH = material.size.y > 0.0f ? material.size.y : rect.height;
+    cmd.radius = (features & Material::Rounded) ? material.cornerRadius : 0.0f;
+    cmd.borderWidth = (features & Material::Border) ? material.borderWidth : 0.0f;
+    cmd.shaped = (features & (Material::Rounded | Material::Border)) != 0;
+    cmd.gradient = (features & Material::Gradient) != 0;
+    cmd.image = image;
+    cmd.blend = m_state.blendMode;
+    cmd.uniform = !cmd.gradient && !image;
+
+    const Color* colors[3] = {&material.color, &material.borderColor, &material.gradientEnd};
+    f32* targets[3] = {cmd.color, cmd.borderColor, cmd.gradientEnd};
+    for (u32 i = 0; i < 3; ++i) {
+        targets[i][0] = colors[i]->r;
+        targets[i][1] = colors[i]->g;
+        targets[i][2] = colors[i]->b;
+        targets[i][3] = colors[i]->a;
+    }
+    cmd.gradientDir[0] = material.gradientDirection.x;
+    cmd.gradientDir[1] = material.gradientDirection.y;
+    cmd.solid = premultiply(cmd.color);
+    cmd.kind = cmd.shaped || !cmd.uniform ? Kind::Shaded : Kind::Flat;
+
+    if (cmd.blend != BlendMode::None && (cmd.solid >> 24) == 0 && cmd.uniform && !cmd.borderWidth) {
+        return;     // Fully transparent
+    }
+    m_commands.push_back(cmd);
+}
+
+void SoftwareRenderer::bin() {
+    for (u32 tile : m_activeTiles) {
+        m_bins[tile].clear();
+    }
+    m_activeTiles.clear();
+
+    for (u32 i = 0; i < (u32)m_commands.size(); ++i) {
+        const Command& cmd = m_commands[i];
+        const u32 tx0 = (u32)cmd.x0 >> m_tileShift, tx1 = (u32)(cmd.x1 - 1) >> m_tileShift;
+        const u32 ty0 = (u32)cmd.y0 >> m_tileShift, ty1 = (u32)(cmd.y1 - 1) >> m_tileShift;
+        for (u32 ty = ty0; ty <= ty1; ++ty) {
+            for (u32 tx = tx0; tx <= tx1; ++tx) {
+                std::vector<u32>& bin = m_bins[ty * m_tilesX + tx];
+                if (bin.empty()) {
+                    m_activeTiles.push_back(ty * m_tilesX + tx);
+                }
+                bin.push_back(i);
+            }
+        }
+    }
+    m_rasterStats.tiles = (u32)m_activeTiles.size();
+}
+
+void SoftwareRenderer::rasterizeTiles() {
+    if (m_activeTiles.empty()) {
+        return;
+    }
+
+    u64 filled = 0;
+    if (m_workers.empty() || m_activeTiles.size() == 1) {
+        for (u32 tile : m_activeTiles) {
+            rasterizeTile(tile, filled);
+        }
+        m_rasterStats.pixelsFilled = filled;
+        return;
+    }
+
+    m_nextTile.store(0, std::memory_order_relaxed);
+    m_pixelsFilled.store(0, std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_generation;
+        m_busyWorkers = (u32)m_workers.size();
+    }
+    m_start.notify_all();
+
+    // The calling thread takes tiles too
+    for (u32 i; (i = m_nextTile.fetch_add(1, std::memory_order_relaxed)) < m_activeTiles.size();) {
+        rasterizeTile(m_activeTiles[i], filled);
+    }
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done.wait(lock, [this] { return m_busyWorkers == 0; });
+    m_rasterStats.pixelsFilled = filled + m_pixelsFilled.load(std::memory_order_relaxed);
+}
+
+void SoftwareRenderer::workerLoop() {
+    u64 seen = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_start.wait(lock, [&] { return m_stopping || m_generation != seen; });
+            if (m_stopping) {
+                return;
+            }
+            seen = m_generation;
+        }
+
+        u64 filled = 0;
+        for (u32 i; (i = m_nextTile.fetch_add(1, std::memory_order_relaxed)) < m_activeTiles.size();) {
+            rasterizeTile(m_activeTiles[i], filled);
+        }
+        m_pixelsFilled.fetch_add(filled, std::memory_order_relaxed);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (--m_busyWorkers == 0) {
+            m_done.notify_one();
+        }
+    }
+}
+
+void SoftwareRenderer::rasterizeTile(u32 tile, u64& pixelsFilled) {
+    const i32 tileX0 = (i32)((tile % m_tilesX) << m_tileShift);
+    const i32 tileY0 = (i32)((tile / m_tilesX) << m_tileShift);
+    const i32 tileX1 = std::min(tileX0 + (1 << m_tileShift), (i32)m_width);
+    const i32 tileY1 = std::min(tileY0 + (1 << m_tileShift), (i32)m_height);
+
+    for (u32 index : m_bins[tile]) {
+        const Command& cmd = m_commands[index];
+        const i32 x0 = std::max(cmd.x0, tileX0), x1 = std::min(cmd.x1, tileX1);
+        const i32 y0 = std::max(cmd.y0, tileY0), y1 = std::min(cmd.y1, tileY1);
+        if (x0 >= x1 || y0 >= y1) {
+            continue;
+        }
+        pixelsFilled += (u64)(x1 - x0) * (u64)(y1 - y0);
+
+        // Solid span in the command's blend mode
+        auto span = [&](u32* dst, u32 n) {
+            switch (cmd.kind == Kind::Clear ? BlendMode::None : cmd.blend) {
+                case BlendMode::None:
+                    fillSpan(dst, n, cmd.solid);
+                    break;
+                case BlendMode::Alpha:
+                    if ((cmd.solid >> 24) == 255) {
+                        fillSpan(dst, n, cmd.solid);
+                    } else {
+                        srcOverSpan(dst, n, cmd.solid);
+                    }
+                    break;
+                case BlendMode::Additive:
+                    addSpan(dst, n, cmd.solid);
+                    break;
+                case BlendMode::Multiply:
+                    for (u32 i = 0; i < n; ++i) {
+                        dst[i] = multiply(dst[i], cmd.color, cmd.solid);
+                    }
+                    break;
+            }
+        };
+
+        if (cmd.kind != Kind::Shaded) {
+            for (i32 y = y0; y < y1; ++y) {
+                span(&m_pixels[(size_t)y * m_width + x0], (u32)(x1 - x0));
+            }
+            continue;
+        }
+
+        // Per-pixel evaluation of shaders/basic.frag
+        const f32 hw = cmd.sizeW * 0.5f, hh = cmd.sizeH * 0.5f;
+        const f32 cx = cmd.x + cmd.w * 0.5f, cy = cmd.y + cmd.h * 0.5f;
+        const f32 toPixelsX = cmd.w / cmd.sizeW, toPixelsY = cmd.h / cmd.sizeH;
+        auto shade = [&](i32 x, i32 y, u32* dst) {
+            const f32 u = ((f32)x + 0.5f - cmd.x) / cmd.w;
+            const f32 v = ((f32)y + 0.5f - cmd.y) / cmd.h;
+            f32 c[4] = {cmd.color[0], cmd.color[1], cmd.color[2], cmd.color[3]};
+
+            if (cmd.gradient) {
+                const f32 t = clamp01((u - 0.5f) * cmd.gradientDir[0] + (v - 0.5f) * cmd.gradientDir[1] + 0.5f);
+                for (u32 i = 0; i < 4; ++i) c[i] += (cmd.gradientEnd[i] - c[i]) * t;
+            }
+
+            if (cmd.image) {
+                // Bilinear, clamped to the edges
+                const Image& image = *cmd.image;
+                const f32 sx = u * image.width() - 0.5f, sy = v * image.height() - 0.5f;
+                const i32 ix = (i32)std::floor(sx), iy = (i32)std::floor(sy);
+                const f32 fx = sx - ix, fy = sy - iy;
+                const i32 maxX = (i32)image.width() - 1, maxY = (i32)image.height() - 1;
+                const i32 xa = std::clamp(ix, 0, maxX), xb = std::clamp(ix + 1, 0, maxX);
+                const i32 ya = std::clamp(iy, 0, maxY), yb = std::clamp(iy + 1, 0, maxY);
+                const u32* p = image.pixels();
+                const u32 texels[4] = {p[ya * image.width() + xa], p[ya * image.width() + xb],
+                                       p[yb * image.width() + xa], p[yb * image.width() + xb]};
+                const f32 weights[4] = {(1 - fx) * (1 - fy), fx * (1 - fy), (1 - fx) * fy, fx * fy};
+                for (u32 i = 0; i < 4; ++i) {
+                    f32 sample = 0.0f;
+                    for (u32 t = 0; t < 4; ++t) {
+                        sample += ((texels[t] >> (i * 8)) & 0xFF) * weights[t];
+                    }
+                    c[i] *= sample / 255.0f;
+                }
+            }
+
+            if (cmd.shaped) {
+                const f32 d = roundedBoxDistance((u - 0.5f) * cmd.sizeW, (v - 0.5f) * cmd.sizeH, hw, hh, cmd.radius);
+                if (cmd.borderWidth > 0.0f) {
+                    const f32 inner = clamp01(0.5f - (d + cmd.borderWidth));
+                    for (u32 i = 0; i < 4; ++i) c[i] = cmd.borderColor[i] + (c[i] - cmd.borderColor[i]) * inner;
+                }
+                c[3] *= clamp01(0.5f - d);
+            }
+
+            const u32 src = premultiply(c);
+            switch (cmd.blend) {
+                case BlendMode::None: *dst = src; break;
+                case BlendMode::Alpha: *dst = srcOver(*dst, src); break;
+                case BlendMode::Additive: *dst = addSaturate(*dst, src); break;
+                case BlendMode::Multiply: *dst = multiply(*dst, c, src); break;
+            }
+        };
+
+        for (i32 y = y0; y < y1; ++y) {
+            u32* row = &m_pixels[(size_t)y * m_width];
+
+            // Interior run where coverage is 1 and the border is not
+            // reached; a single color there unless shaded per pixel
+            i32 inner0 = x1, inner1 = x1;
+            if (cmd.uniform) {
+                const f32 k = 0.5f + cmd.borderWidth;
+                const f32 m = cmd.radius - k;
+                const f32 qy = std::fabs((f32)y + 0.5f - cy) / toPixelsY - hh + cmd.radius;
+                if (qy <= m) {
+                    const f32 extent = (hw - cmd.radius + (qy <= 0.0f ? m : std::sqrt(m * m - qy * qy))) * toPixelsX;
+                    inner0 = std::max((i32)std::ceil(cx - extent - 0.5f), x0);
+                    inner1 = std::min((i32)std::floor(cx + extent - 0.5f) + 1, x1);
+                    if (inner0 >= inner1) {
+                        inner0 = inner1 = x1;
+                    }
+                }
+            }
+
+            for (i32 x = x0; x < inner0; ++x) shade(x, y, &row[x]);
+            if (inner1 > inner0) span(&row[inner0], (u32)(inner1 - inner0));
+            for (i32 x = inner1; x < x1; ++x) shade(x, y, &row[x]);
+        }
+    }
+}
+
+} // namespace Aurora
@@ -0,0 +1,79 @@
+// ============================================
+// src/platform/MotionHistory.cpp
+// ============================================
+#include "aurora/platform/MotionHistory.hpp"
+#include <algorithm>
+
+namespace Aurora {
+
+MotionHistory::MotionHistory(u32 capacity) : m_samples(std::max(capacity, 2u)) {}
+
+void MotionHistory::push(const MotionSample& sample) {
+    m_samples[m_head] = sample;
+    m_head = (m_head + 1) % capacity();
+    m_count = std::min(m_count + 1, capacity());
+    if (m_unread == capacity()) {
+        ++m_stats.dropped;
+    } else {
+        ++m_unread;
+    }
+    ++m_stats.received;
+}
+
+u32 MotionHistory::consume(std::vector<MotionSample>& out) {
+    const u32 count = m_unread;
+    for (u32 i = count; i > 0; --i) {
+        out.push_back(fromLatest(i - 1));
+    }
+    m_unread = 0;
+    m_stats.consumed += count;
+    return count;
+}
+
+Vec2 MotionHistory::velocity(f64 window) const {
+    if (m_count < 2) {
+        return {};
+    }
+
+    // Fit x(t) and y(t) with straight lines; times relative to the newest
+    // sample keep the sums well conditioned
+    const f64 newest = latest().timestamp;
+    f64 st = 0, stt = 0, sx = 0, sy = 0, stx = 0, sty = 0;
+    u32 n = 0;
+    for (u32 i = 0; i < m_count; ++i) {
+        const MotionSample& sample = fromLatest(i);
+        const f64 t = sample.timestamp - newest;
+        if (t < -window) {
+            break;
+        }
+        st += t;
+        stt += t * t;
+        sx += sample.x;
+        sy += sample.y;
+        stx += t * sample.x;
+        sty += t * sample.y;
+        ++n;
+    }
+
+    const f64 denominator = n * stt - st * st;
+    if (n < 2 || denominator <= 1e-12) {
+        return {};
+    }
+    return {(f32)((n * stx - st * sx) / denominator), (f32)((n * sty - st * sy) / denominator)};
+}
+
+const MotionSample& MotionHistory::latest() const {
+    return fromLatest(0);
+}
+
+void MotionHistory::clear() {
+    m_head = 0;
+    m_count = 0;
+    m_unread = 0;
+}
+
+const MotionSample& MotionHistory::fromLatest(u32 i) const {
+    return m_samples[(m_head + capacity() - 1 - i) % capacity()];
+}
+
+} // namespace Aurora
@@ -2,19 +2,64 @@
 // src/platform/PlatformFactory.cpp
 // ============================================
 #include "aurora/platform/IPlatform.hpp"
+#include <cstdlib>
+#include <cstring>
+
+#ifdef AURORA_PLATFORM_HEADLESS
+#include "aurora/platform/headless/HeadlessPlatform.hpp"
+#endif
+
+#if !defined(AURORA_PLATFORM_X11) && !defined(AURORA_PLATFORM_WAYLAND) && !defined(AURORA_PLATFORM_HEADLESS)
+#error "No platform implementation available"
+#endif
 
 namespace Aurora {
 
+#ifdef AURORA_PLATFORM_X11
+Unique<IPlatform> createX11Platform();
+#endif
+
+#ifdef AURORA_PLATFORM_WAYLAND
+Unique<IPlatform> createWaylandPlatform();
+#endif
+
 Unique<IPlatform> IPlatform::create() {
+    // AURORA_PLATFORM forces a backend: "x11", "wayland" or "headless"
+    const char* requested = std::getenv("AURORA_PLATFORM");
+    auto wants = [requested](const char* name) {
+        return requested && std::strcmp(requested, name) == 0;
+    };
+    const bool forced = requested && *requested;
+
+#ifdef AURORA_PLATFORM_HEADLESS
+    if (wants("headless")) {
+        return std::make_unique<HeadlessPlatform>();
+    }
+#endif
+
+#ifdef AURORA_PLATFORM_WAYLAND
+    // Preferred over XWayland when both are available
+    const char* waylandDisplay = std::getenv("WAYLAND_DISPLAY");
+    if (wants("wayland") || (!forced && waylandDisplay && *waylandDisplay)) {
+        return createWaylandPlatform();
+    }
+#endif
+
 #ifdef AURORA_PLATFORM_X11
-    return std::make_unique<X11Platform>();
-#elif defined(AURORA_PLATFORM_WAYLAND)
-    // return std::make_unique<WaylandPlatform>();
-#else
-    #error "No platform implementation available"
+    const char* display = std::getenv("DISPLAY");
+    if (wants("x11") || (!forced && display && *display)) {
+        return createX11Platform();
+    }
 #endif
+
+#ifdef AURORA_PLATFORM_HEADLESS
+    // No display server reachable: run offscreen
+    if (!forced) {
+        return std::make_unique<HeadlessPlatform>();
+    }
+#endif
+
     return nullptr;
 }
 
 } // namespace Aurora
-
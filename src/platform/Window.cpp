@@ -0,0 +1,12 @@
+// ============================================
+// src/platform/Window.cpp
+// ============================================
+#include "aurora/platform/Window.hpp"
+
+namespace Aurora {
+
+Window::Window(const Config& config) : m_config(config) {}
+
+Window::~Window() = default;
+
+} // namespace Aurora
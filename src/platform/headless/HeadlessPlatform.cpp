@@ -0,0 +1,497 @@
+// ============================================
+// src/platform/headless/HeadlessPlatform.cpp
+// ============================================
+#ifdef AURORA_PLATFORM_HEADLESS
+
+#include "aurora/platform/headless/HeadlessPlatform.hpp"
+#include "aurora/core/Timer.hpp"
+#include "aurora/graphics/GLContext.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <GL/gl.h>
+
+#ifdef AURORA_HEADLESS_EGL
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#endif
+
+namespace Aurora {
+
+namespace {
+
+class HeadlessWindow : public Window {
+public:
+    HeadlessWindow(const Config& config, HeadlessPlatform* platform)
+        : Window(config), m_platform(platform) {}
+
+    void show() override { m_visible = true; }
+    void hide() override { m_visible = false; }
+    void close() override { m_platform->injectClose(this); }
+    void setTitle(const std::string& title) override { m_config.title = title; }
+    void setPosition(i32 x, i32 y) override {
+        m_config.x = x;
+        m_config.y = y;
+    }
+    void setSize(u32 width, u32 height) override { m_platform->injectResize(this, width, height); }
+    void setOpacity(f32 opacity) override { m_config.opacity = opacity; }
+
+    void applySize(u32 width, u32 height) {
+        m_config.width = width;
+        m_config.height = height;
+    }
+
+    bool isVisible() const { return m_visible; }
+
+private:
+    HeadlessPlatform* m_platform;
+    bool m_visible = false;
+};
+
+} // namespace
+
+struct HeadlessPlatform::Surface {
+    HeadlessWindow* window = nullptr;
+    void* eglSurface = nullptr;
+    u32 width = 0;
+    u32 height = 0;
+
+    // Last presentPixels() frame; stale once GL swaps again
+    std::vector<u32> software;
+    u32 softwareWidth = 0;
+    u32 softwareHeight = 0;
+    bool softwareCurrent = false;
+};
+
+HeadlessPlatform::HeadlessPlatform() : HeadlessPlatform(Config()) {}
+
+HeadlessPlatform::HeadlessPlatform(const Config& config) : m_config(config) {}
+
+HeadlessPlatform::~HeadlessPlatform() {
+    shutdown();
+}
+
+bool HeadlessPlatform::initialize() {
+    if (m_config.gl) {
+        // Without GL the platform is still usable for CPU rendering
+        initializeGL();
+    }
+    return true;
+}
+
+bool HeadlessPlatform::initializeGL() {
+#ifdef AURORA_HEADLESS_EGL
+    EGLDisplay display = EGL_NO_DISPLAY;
+    auto getPlatformDisplay = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(
+        eglGetProcAddress("eglGetPlatformDisplayEXT"));
+    if (getPlatformDisplay) {
+        display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+    }
+    if (display == EGL_NO_DISPLAY) {
+        display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    }
+    if (display == EGL_NO_DISPLAY || !eglInitialize(display, nullptr, nullptr)) {
+        return false;
+    }
+
+    const EGLint attribs[] = {
+        EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+        EGL_RED_SIZE, 8,
+        EGL_GREEN_SIZE, 8,
+        EGL_BLUE_SIZE, 8,
+        EGL_ALPHA_SIZE, 8,
+        EGL_DEPTH_SIZE, 24,
+        EGL_STENCIL_SIZE, 8,
+        EGL_NONE
+    };
+    EGLConfig config = nullptr;
+    EGLint count = 0;
+    if (!eglBindAPI(EGL_OPENGL_API) || !eglChooseConfig(display, attribs, &config, 1, &count) || count == 0) {
+        eglTerminate(display);
+        return false;
+    }
+
+    m_eglDisplay = display;
+    m_eglConfig = config;
+    return true;
+#else
+    return false;
+#endif
+}
+
+void HeadlessPlatform::shutdown() {
+    std::vector<Window*> windows;
+    for (auto& entry : m_surfaces) {
+        windows.push_back(entry.first);
+    }
+    for (Window* window : windows) {
+        destroyWindow(window);
+    }
+
+#ifdef AURORA_HEADLESS_EGL
+    if (m_eglDisplay) {
+        eglMakeCurrent(m_eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        if (m_eglShareContext) {
+            eglDestroyContext(m_eglDisplay, m_eglShareContext);
+            m_eglShareContext = nullptr;
+        }
+        for (const auto& entry : m_contextSerials) {
+            GLContext::release(entry.second);
+        }
+        m_contextSerials.clear();
+        eglTerminate(m_eglDisplay);
+        m_eglDisplay = nullptr;
+        m_eglConfig = nullptr;
+    }
+#endif
+}
+
+Handle<Window> HeadlessPlatform::createWindow(const Window::Config& config) {
+    auto window = makeHandle<HeadlessWindow>(config, this);
+
+    auto surface = std::make_unique<Surface>();
+    surface->window = window.get();
+    resizeSurface(*surface, config.width, config.height);
+
+    window->setNativeHandle(surface.get());
+    m_surfaces[window.get()] = std::move(surface);
+    return window;
+}
+
+void HeadlessPlatform::destroyWindow(Window* window) {
+    auto it = m_surfaces.find(window);
+    if (it == m_surfaces.end()) {
+        return;
+    }
+#ifdef AURORA_HEADLESS_EGL
+    if (it->second->eglSurface) {
+        eglDestroySurface(m_eglDisplay, it->second->eglSurface);
+    }
+#endif
+    m_surfaces.erase(it);
+
+    // Drop events still addressed to it
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto event = m_eventQueue.begin(); event != m_eventQueue.end();) {
+        event = event->window == window ? m_eventQueue.erase(event) : event + 1;
+    }
+    for (auto event = m_script.begin(); event != m_script.end();) {
+        event = event->second.window == window ? m_script.erase(event) : std::next(event);
+    }
+}
+
+HeadlessPlatform::Surface* HeadlessPlatform::surfaceOf(Window* window) const {
+    auto it = m_surfaces.find(window);
+    return it != m_surfaces.end() ? it->second.get() : nullptr;
+}
+
+void HeadlessPlatform::resizeSurface(Surface& surface, u32 width, u32 height) {
+    surface.width = width;
+    surface.height = height;
+    surface.window->applySize(width, height);
+
+#ifdef AURORA_HEADLESS_EGL
+    if (!m_eglDisplay) {
+        return;
+    }
+
+    // Pbuffers cannot change size; swap in a new one
+    const bool current = surface.eglSurface && eglGetCurrentSurface(EGL_DRAW) == surface.eglSurface;
+    EGLContext context = eglGetCurrentContext();
+    const EGLint attribs[] = {
+        EGL_WIDTH, (EGLint)width,
+        EGL_HEIGHT, (EGLint)height,
+        EGL_NONE
+    };
+    EGLSurface replacement = eglCreatePbufferSurface(m_eglDisplay, m_eglConfig, attribs);
+    if (current) {
+        eglMakeCurrent(m_eglDisplay, replacement, replacement, context);
+    }
+    if (surface.eglSurface) {
+        eglDestroySurface(m_eglDisplay, surface.eglSurface);
+    }
+    surface.eglSurface = replacement;
+#endif
+}
+
+void HeadlessPlatform::push(const Event& event) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_eventQueue.push_back(event);
+        if (m_eventQueue.back().timestamp == 0.0) {
+            m_eventQueue.back().timestamp = TimerWheel::clock() * 1e-9;
+        }
+        m_woken = true;
+    }
+    m_wake.notify_one();
+}
+
+void HeadlessPlatform::pumpEvents() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto last = m_script.upper_bound(m_pumpCount);
+    const f64 now = TimerWheel::clock() * 1e-9;
+    for (auto it = m_script.begin(); it != last; ++it) {
+        m_eventQueue.push_back(it->second);
+        if (m_eventQueue.back().timestamp == 0.0) {
+            m_eventQueue.back().timestamp = now;
+        }
+    }
+    m_script.erase(m_script.begin(), last);
+    ++m_pumpCount;
+}
+
+bool HeadlessPlatform::hasEvents() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return !m_eventQueue.empty();
+}
+
+Event HeadlessPlatform::nextEvent() {
+    Event event;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_eventQueue.empty()) {
+            return Event();
+        }
+        event = m_eventQueue.front();
+        m_eventQueue.pop_front();
+    }
+
+    // A resize takes effect when it is delivered, like a configure event
+    if (event.type == EventType::WindowResize) {
+        if (Surface* surface = surfaceOf(event.window)) {
+            resizeSurface(*surface, event.size.width, event.size.height);
+        }
+    } else if (event.type == EventType::MouseMove && event.window) {
+        event.window->motionHistory().push({event.timestamp, event.mouse.x, event.mouse.y});
+    }
+    return event;
+}
+
+void HeadlessPlatform::waitEvents(f64 timeout) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    auto ready = [this] {
+        return m_woken || !m_eventQueue.empty() ||
+               (!m_script.empty() && m_script.begin()->first <= m_pumpCount);
+    };
+    if (timeout < 0) {
+        m_wake.wait(lock, ready);
+    } else {
+        m_wake.wait_for(lock, std::chrono::duration<f64>(timeout), ready);
+    }
+    m_woken = false;
+}
+
+void HeadlessPlatform::wakeUp() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_woken = true;
+    }
+    m_wake.notify_one();
+}
+
+Rect HeadlessPlatform::displayBounds(u32 index) const {
+    return {0, 0, (f32)m_config.displayWidth, (f32)m_config.displayHeight};
+}
+
+void* HeadlessPlatform::createGLContext(Window* window) {
+#ifdef AURORA_HEADLESS_EGL
+    Surface* surface = surfaceOf(window);
+    if (!m_eglDisplay || !surface) {
+        return nullptr;
+    }
+    EGLContext share = m_config.shareContexts ? shareGLContext() : nullptr;
+    EGLContext context = eglCreateContext(m_eglDisplay, m_eglConfig, share ? share : EGL_NO_CONTEXT, nullptr);
+    if (context == EGL_NO_CONTEXT) {
+        return nullptr;
+    }
+    m_contextSerials[context] = GLContext::allocate();
+    makeCurrent(window, context);
+    return context;
+#else
+    return nullptr;
+#endif
+}
+
+void HeadlessPlatform::destroyGLContext(void* context) {
+#ifdef AURORA_HEADLESS_EGL
+    if (m_eglDisplay && context) {
+        if (eglGetCurrentContext() == context) {
+            eglMakeCurrent(m_eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+            GLContext::setCurrent(0);
+        }
+        auto serial = m_contextSerials.find(context);
+        if (serial != m_contextSerials.end()) {
+            GLContext::release(serial->second);
+            m_contextSerials.erase(serial);
+        }
+        eglDestroyContext(m_eglDisplay, context);
+    }
+#endif
+}
+
+void HeadlessPlatform::makeCurrent(Window* window, void* context) {
+#ifdef AURORA_HEADLESS_EGL
+    if (!m_eglDisplay) {
+        return;
+    }
+    Surface* surface = surfaceOf(window);
+    if (window && !surface) {
+        return;
+    }
+    // Without a window the context is current surfaceless
+    EGLSurface eglSurface = surface ? surface->eglSurface : EGL_NO_SURFACE;
+    eglMakeCurrent(m_eglDisplay, eglSurface, eglSurface, context);
+    auto serial = m_contextSerials.find(context);
+    GLContext::setCurrent(serial != m_contextSerials.end() ? serial->second : 0);
+#endif
+}
+
+void* HeadlessPlatform::shareGLContext() {
+#ifdef AURORA_HEADLESS_EGL
+    if (!m_eglShareContext && m_eglDisplay) {
+        EGLContext context = eglCreateContext(m_eglDisplay, m_eglConfig, EGL_NO_CONTEXT, nullptr);
+        if (context == EGL_NO_CONTEXT) {
+            return nullptr;
+        }
+        m_eglShareContext = context;
+        m_contextSerials[context] = GLContext::allocate();
+    }
+    return m_eglShareContext;
+#else
+    return nullptr;
+#endif
+}
+
+void HeadlessPlatform::swapBuffers(Window* window) {
+    Surface* surface = surfaceOf(window);
+    if (surface) {
+        surface->softwareCurrent = false;
+    }
+#ifdef AURORA_HEADLESS_EGL
+    if (m_eglDisplay && surface) {
+        // A no-op for pbuffers, but it marks the end of the frame for the driver
+        eglSwapBuffers(m_eglDisplay, surface->eglSurface);
+    }
+#endif
+    ++m_presented;
+}
+
+bool HeadlessPlatform::presentPixels(Window* window, const u32* pixels, u32 width, u32 height, u32 stride) {
+    Surface* surface = surfaceOf(window);
+    if (!surface || !pixels) {
+        return false;
+    }
+
+    surface->software.resize((size_t)width * height);
+    for (u32 y = 0; y < height; ++y) {
+        std::memcpy(&surface->software[(size_t)y * width], pixels + (size_t)y * stride, width * sizeof(u32));
+    }
+    surface->softwareWidth = width;
+    surface->softwareHeight = height;
+    surface->softwareCurrent = true;
+    ++m_presented;
+    return true;
+}
+
+bool HeadlessPlatform::readPixels(Window* window, std::vector<u8>& rgba) {
+    Surface* surface = surfaceOf(window);
+    if (surface && surface->softwareCurrent) {
+        // Premultiplied 0xAARRGGBB to straight RGBA, as GL would store it
+        rgba.resize(surface->software.size() * 4);
+        for (size_t i = 0; i < surface->software.size(); ++i) {
+            const u32 pixel = surface->software[i];
+            const u32 a = pixel >> 24;
+            u8* out = &rgba[i * 4];
+            for (u32 c = 0; c < 3; ++c) {
+                const u32 value = (pixel >> (16 - c * 8)) & 0xFF;
+                out[c] = (u8)(a ? std::min(255u, (value * 255 + a / 2) / a) : 0);
+            }
+            out[3] = (u8)a;
+        }
+        return true;
+    }
+    if (!surface || !hasGL()) {
+        return false;
+    }
+
+    const size_t stride = (size_t)surface->width * 4;
+    rgba.resize(stride * surface->height);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(0, 0, (GLsizei)surface->width, (GLsizei)surface->height,
+                 GL_RGBA, GL_UNSIGNED_BYTE, rgba.data());
+
+    // GL rows start at the bottom
+    std::vector<u8> row(stride);
+    for (u32 y = 0; y < surface->height / 2; ++y) {
+        u8* top = &rgba[y * stride];
+        u8* bottom = &rgba[(surface->height - 1 - y) * stride];
+        std::memcpy(row.data(), top, stride);
+        std::memcpy(top, bottom, stride);
+        std::memcpy(bottom, row.data(), stride);
+    }
+    return true;
+}
+
+void HeadlessPlatform::inject(const Event& event) {
+    push(event);
+}
+
+void HeadlessPlatform::injectMouseMove(Window* window, f32 x, f32 y) {
+    Event event(EventType::MouseMove);
+    event.window = window;
+    event.mouse.x = x;
+    event.mouse.y = y;
+    push(event);
+}
+
+void HeadlessPlatform::injectMouseButton(Window* window, MouseButton button, bool pressed) {
+    Event event(pressed ? EventType::MouseDown : EventType::MouseUp);
+    event.window = window;
+    event.mouseButton.button = button;
+    push(event);
+}
+
+void HeadlessPlatform::injectScroll(Window* window, f32 dx, f32 dy) {
+    Event event(EventType::MouseScroll);
+    event.window = window;
+    event.scroll.dx = dx;
+    event.scroll.dy = dy;
+    event.scroll.precise = false;
+    push(event);
+}
+
+void HeadlessPlatform::injectKey(Window* window, KeyCode code, bool pressed, u32 modifiers) {
+    Event event(pressed ? EventType::KeyDown : EventType::KeyUp);
+    event.window = window;
+    event.key.code = code;
+    event.key.modifiers = modifiers;
+    event.key.repeat = false;
+    push(event);
+}
+
+void HeadlessPlatform::injectResize(Window* window, u32 width, u32 height) {
+    Event event(EventType::WindowResize);
+    event.window = window;
+    event.size.width = width;
+    event.size.height = height;
+    push(event);
+}
+
+void HeadlessPlatform::injectClose(Window* window) {
+    Event event(EventType::WindowClose);
+    event.window = window;
+    push(event);
+}
+
+void HeadlessPlatform::scheduleEvent(u64 frame, const Event& event) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_script.emplace(frame, event);
+    }
+    m_wake.notify_one();
+}
+
+} // namespace Aurora
+
+#endif // AURORA_PLATFORM_HEADLESS
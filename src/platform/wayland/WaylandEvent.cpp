@@ -0,0 +1,100 @@
+// ============================================
+// src/platform/wayland/WaylandEvent.cpp
+// ============================================
+#ifdef AURORA_PLATFORM_WAYLAND
+
+#include "aurora/platform/wayland/WaylandEvent.hpp"
+#include "aurora/core/Timer.hpp"
+#include <cstring>
+#include <linux/input-event-codes.h>
+
+namespace Aurora {
+
+KeyCode evdevToKeyCode(u32 key) {
+    // evdev codes run along the physical rows
+    static const struct { u32 first; const char* names; } kRows[] = {
+        {KEY_Q, "QWERTYUIOP"},
+        {KEY_A, "ASDFGHJKL"},
+        {KEY_Z, "ZXCVBNM"},
+    };
+    for (const auto& row : kRows) {
+        if (key >= row.first && key - row.first < std::strlen(row.names)) {
+            return static_cast<KeyCode>(row.names[key - row.first]);
+        }
+    }
+    if (key >= KEY_1 && key <= KEY_9) {
+        return static_cast<KeyCode>('1' + (key - KEY_1));
+    }
+    if (key >= KEY_F1 && key <= KEY_F10) {
+        return static_cast<KeyCode>((u32)KeyCode::F1 + (key - KEY_F1));
+    }
+
+    switch (key) {
+        case KEY_0: return KeyCode::Num0;
+        case KEY_F11: return KeyCode::F11;
+        case KEY_F12: return KeyCode::F12;
+        case KEY_ESC: return KeyCode::Escape;
+        case KEY_TAB: return KeyCode::Tab;
+        case KEY_SPACE: return KeyCode::Space;
+        case KEY_ENTER:
+        case KEY_KPENTER: return KeyCode::Enter;
+        case KEY_BACKSPACE: return KeyCode::Backspace;
+        case KEY_DELETE: return KeyCode::Delete;
+        case KEY_UP: return KeyCode::Up;
+        case KEY_DOWN: return KeyCode::Down;
+        case KEY_LEFT: return KeyCode::Left;
+        case KEY_RIGHT: return KeyCode::Right;
+        case KEY_HOME: return KeyCode::Home;
+        case KEY_END: return KeyCode::End;
+        case KEY_PAGEUP: return KeyCode::PageUp;
+        case KEY_PAGEDOWN: return KeyCode::PageDown;
+        case KEY_INSERT: return KeyCode::Insert;
+        case KEY_SYSRQ: return KeyCode::PrintScreen;
+        case KEY_PAUSE: return KeyCode::Pause;
+        case KEY_LEFTSHIFT: return KeyCode::LeftShift;
+        case KEY_RIGHTSHIFT: return KeyCode::RightShift;
+        case KEY_LEFTCTRL: return KeyCode::LeftCtrl;
+        case KEY_RIGHTCTRL: return KeyCode::RightCtrl;
+        case KEY_LEFTALT: return KeyCode::LeftAlt;
+        case KEY_RIGHTALT: return KeyCode::RightAlt;
+        case KEY_LEFTMETA: return KeyCode::LeftSuper;
+        case KEY_RIGHTMETA: return KeyCode::RightSuper;
+        default: return KeyCode::Unknown;
+    }
+}
+
+MouseButton evdevToMouseButton(u32 button) {
+    switch (button) {
+        case BTN_LEFT: return MouseButton::Left;
+        case BTN_MIDDLE: return MouseButton::Middle;
+        case BTN_RIGHT: return MouseButton::Right;
+        case BTN_SIDE: return MouseButton::X1;
+        case BTN_EXTRA: return MouseButton::X2;
+        default: return MouseButton::None;
+    }
+}
+
+u32 waylandModifiers(u32 mods) {
+    u32 result = 0;
+    if (mods & (1u << 0)) result |= (u32)KeyModifiers::Shift;
+    if (mods & (1u << 2)) result |= (u32)KeyModifiers::Ctrl;
+    if (mods & (1u << 3)) result |= (u32)KeyModifiers::Alt;      // Mod1
+    if (mods & (1u << 6)) result |= (u32)KeyModifiers::Super;    // Mod4
+    return result;
+}
+
+f64 waylandTimestamp(u32 milliseconds) {
+    const u64 now = TimerWheel::clock() / 1000000;
+    const u64 wrap = 1ull << 32;
+    u64 stamp = (now & ~(wrap - 1)) | milliseconds;
+    if (stamp > now + wrap / 2 && stamp >= wrap) {
+        stamp -= wrap;
+    } else if (stamp + wrap / 2 < now) {
+        stamp += wrap;
+    }
+    return stamp * 1e-3;
+}
+
+} // namespace Aurora
+
+#endif // AURORA_PLATFORM_WAYLAND
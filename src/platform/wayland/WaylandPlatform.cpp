@@ -0,0 +1,1305 @@
+// ============================================
+// src/platform/wayland/WaylandPlatform.cpp
+// ============================================
+#ifdef AURORA_PLATFORM_WAYLAND
+
+#include "aurora/platform/IPlatform.hpp"
+#include "aurora/platform/wayland/WaylandEvent.hpp"
+#include "aurora/core/Timer.hpp"
+#include "aurora/graphics/GLContext.hpp"
+#include <wayland-client.h>
+#include <wayland-egl.h>
+#include "xdg-shell-client-protocol.h"
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <sys/mman.h>
+#include <algorithm>
+#include <bitset>
+#include <cmath>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <poll.h>
+#include <time.h>
+#include <unistd.h>
+#include <unordered_map>
+
+namespace Aurora {
+
+namespace {
+
+bool hasExtension(const char* extensions, const char* name) {
+    const size_t length = std::strlen(name);
+    for (const char* p = extensions; p && (p = std::strstr(p, name)); p += length) {
+        if ((p == extensions || p[-1] == ' ') && (p[length] == ' ' || p[length] == '\0')) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// wl_pointer.axis units per wheel notch (what libinput-based compositors send)
+constexpr f32 kAxisPerNotch = 10.0f;
+
+} // namespace
+
+class WaylandPlatform;
+
+// One shm buffer of a window's software pool. The compositor owns it from
+// attach until wl_buffer.release; only then is it written again.
+struct WaylandBuffer {
+    wl_buffer* buffer = nullptr;
+    void* pixels = nullptr;
+    size_t size = 0;
+    u32 width = 0;
+    u32 height = 0;
+    u32 format = 0;
+    bool busy = false;
+};
+
+struct WaylandOutput {
+    u32 name = 0;               // Registry name, for global_remove
+    wl_output* output = nullptr;
+    Rect bounds = {0, 0, 0, 0};
+    f64 refreshRate = 60.0;
+};
+
+// EGL config for one combination of the Window::Config GL settings
+struct WaylandEGLFormat {
+    u32 samples = 0;
+    u32 depthBits = 0;
+    u32 stencilBits = 0;
+    bool alpha = false;
+    EGLConfig config = nullptr;
+};
+
+struct WaylandSurface {
+    WaylandPlatform* platform = nullptr;
+    Window* window = nullptr;
+    wl_surface* surface = nullptr;
+    xdg_surface* xdgSurface = nullptr;
+    xdg_toplevel* toplevel = nullptr;
+
+    // Pending until the compositor wants the next frame
+    wl_callback* frameCallback = nullptr;
+
+    wl_egl_window* eglWindow = nullptr;
+    EGLSurface eglSurface = EGL_NO_SURFACE;
+    const WaylandEGLFormat* format = nullptr;
+
+    std::vector<Unique<WaylandBuffer>> buffers;
+    std::vector<wl_output*> outputs;    // Entered, most recent last
+    std::vector<Rect> damage;           // Of the next frame; empty is all
+
+    i32 pendingWidth = 0;               // From xdg_toplevel.configure
+    i32 pendingHeight = 0;
+    bool configured = false;            // Acked an xdg_surface.configure
+    bool visible = true;
+};
+
+// Wayland clients neither place their windows nor set their opacity; the
+// compositor does. Size is ours to choose except where configure says.
+class WaylandWindow : public Window {
+public:
+    WaylandWindow(WaylandPlatform* platform, const Config& config) : Window(config), m_platform(platform) {}
+
+    void show() override;
+    void hide() override;
+    void close() override;
+    void setTitle(const std::string& title) override;
+    void setPosition(i32 x, i32 y) override;
+    void setSize(u32 width, u32 height) override;
+    void setOpacity(f32 opacity) override;
+
+    void detach() { m_platform = nullptr; }
+    void resized(u32 width, u32 height) { m_config.width = width; m_config.height = height; }
+
+private:
+    WaylandPlatform* m_platform;
+};
+
+class WaylandPlatform : public IPlatform {
+public:
+    WaylandPlatform() = default;
+    ~WaylandPlatform() { shutdown(); }
+
+    bool initialize() override {
+        m_display = wl_display_connect(nullptr);
+        if (!m_display) {
+            return false;
+        }
+
+        static const wl_registry_listener registryListener = {
+            [](void* data, wl_registry* registry, u32 name, const char* interface, u32 version) {
+                static_cast<WaylandPlatform*>(data)->bindGlobal(name, interface, version);
+            },
+            [](void* data, wl_registry* registry, u32 name) {
+                static_cast<WaylandPlatform*>(data)->removeGlobal(name);
+            }
+        };
+        m_registry = wl_display_get_registry(m_display);
+        wl_registry_add_listener(m_registry, &registryListener, this);
+        // Globals, then the events of the objects bound from them (seat
+        // capabilities, output modes)
+        wl_display_roundtrip(m_display);
+        wl_display_roundtrip(m_display);
+
+        if (!m_compositor || !m_shm || !m_wmBase) {
+            std::cerr << "[Wayland] Compositor lacks wl_compositor, wl_shm or xdg_wm_base" << std::endl;
+            shutdown();
+            return false;
+        }
+
+        // GL is optional; software frames need only wl_shm
+        initializeEGL();
+
+        // Self-pipe so other threads can interrupt waitEvents()
+        if (pipe2(m_wakePipe, O_NONBLOCK | O_CLOEXEC) != 0) {
+            m_wakePipe[0] = m_wakePipe[1] = -1;
+        }
+        return true;
+    }
+
+    void shutdown() override {
+        for (int& fd : m_wakePipe) {
+            if (fd >= 0) {
+                close(fd);
+                fd = -1;
+            }
+        }
+        while (!m_surfaces.empty()) {
+            Window* window = m_surfaces.begin()->first;
+            destroyWindow(window);
+        }
+        if (m_eglDisplay != EGL_NO_DISPLAY) {
+            eglMakeCurrent(m_eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+            GLContext::setCurrent(0);
+            if (m_shareContext != EGL_NO_CONTEXT) {
+                eglDestroyContext(m_eglDisplay, m_shareContext);
+                m_shareContext = EGL_NO_CONTEXT;
+            }
+            eglTerminate(m_eglDisplay);
+            m_eglDisplay = EGL_NO_DISPLAY;
+        }
+        for (const auto& entry : m_contextSerials) {
+            GLContext::release(entry.second);
+        }
+        m_contextSerials.clear();
+        m_eglFormats.clear();
+        m_defaultFormat = nullptr;
+
+        releaseInput();
+        if (m_seat) {
+            wl_seat_destroy(m_seat);
+            m_seat = nullptr;
+        }
+        for (auto& output : m_outputs) {
+            wl_output_destroy(output->output);
+        }
+        m_outputs.clear();
+        if (m_wmBase) {
+            xdg_wm_base_destroy(m_wmBase);
+            m_wmBase = nullptr;
+        }
+        if (m_shm) {
+            wl_shm_destroy(m_shm);
+            m_shm = nullptr;
+        }
+        if (m_compositor) {
+            wl_compositor_destroy(m_compositor);
+            m_compositor = nullptr;
+        }
+        if (m_registry) {
+            wl_registry_destroy(m_registry);
+            m_registry = nullptr;
+        }
+        if (m_display) {
+            wl_display_disconnect(m_display);
+            m_display = nullptr;
+        }
+    }
+
+    // Returns once the compositor has sent the first configure, so the
+    // window has its final size before anything draws into it
+    Handle<Window> createWindow(const Window::Config& config) override {
+        auto window = makeHandle<WaylandWindow>(this, config);
+        auto surface = std::make_unique<WaylandSurface>();
+        surface->platform = this;
+        surface->window = window.get();
+
+        static const wl_surface_listener surfaceListener = [] {
+            wl_surface_listener listener = {};
+            listener.enter = [](void* data, wl_surface*, wl_output* output) {
+                static_cast<WaylandSurface*>(data)->outputs.push_back(output);
+            };
+            listener.leave = [](void* data, wl_surface*, wl_output* output) {
+                auto& outputs = static_cast<WaylandSurface*>(data)->outputs;
+                outputs.erase(std::remove(outputs.begin(), outputs.end(), output), outputs.end());
+            };
+            return listener;
+        }();
+        static const xdg_surface_listener xdgSurfaceListener = {
+            [](void* data, xdg_surface* xdgSurface, u32 serial) {
+                WaylandSurface* surface = static_cast<WaylandSurface*>(data);
+                xdg_surface_ack_configure(xdgSurface, serial);
+                surface->platform->configured(*surface);
+            }
+        };
+        static const xdg_toplevel_listener toplevelListener = [] {
+            xdg_toplevel_listener listener = {};
+            listener.configure = [](void* data, xdg_toplevel*, i32 width, i32 height, wl_array*) {
+                // Applied with the xdg_surface.configure that follows
+                WaylandSurface* surface = static_cast<WaylandSurface*>(data);
+                surface->pendingWidth = width;
+                surface->pendingHeight = height;
+            };
+            listener.close = [](void* data, xdg_toplevel*) {
+                WaylandSurface* surface = static_cast<WaylandSurface*>(data);
+                surface->platform->postClose(surface->window);
+            };
+            return listener;
+        }();
+
+        surface->surface = wl_compositor_create_surface(m_compositor);
+        wl_surface_add_listener(surface->surface, &surfaceListener, surface.get());
+        surface->xdgSurface = xdg_wm_base_get_xdg_surface(m_wmBase, surface->surface);
+        xdg_surface_add_listener(surface->xdgSurface, &xdgSurfaceListener, surface.get());
+        surface->toplevel = xdg_surface_get_toplevel(surface->xdgSurface);
+        xdg_toplevel_add_listener(surface->toplevel, &toplevelListener, surface.get());
+
+        xdg_toplevel_set_title(surface->toplevel, config.title.c_str());
+        if (!config.resizable) {
+            xdg_toplevel_set_min_size(surface->toplevel, (i32)config.width, (i32)config.height);
+            xdg_toplevel_set_max_size(surface->toplevel, (i32)config.width, (i32)config.height);
+        }
+        if (config.type == Window::Type::Desktop) {
+            xdg_toplevel_set_fullscreen(surface->toplevel, nullptr);
+        }
+
+        window->setNativeHandle(surface->surface);
+        WaylandSurface* created = surface.get();
+        m_surfaces[window.get()] = std::move(surface);
+
+        // The initial commit carries no buffer; it asks for a configure
+        wl_surface_commit(created->surface);
+        while (!created->configured && wl_display_dispatch(m_display) >= 0) {}
+        return window;
+    }
+
+    void destroyWindow(Window* window) override {
+        auto it = m_surfaces.find(window);
+        if (it == m_surfaces.end()) {
+            return;
+        }
+        WaylandSurface& surface = *it->second;
+        static_cast<WaylandWindow*>(window)->detach();
+        if (m_pointerWindow == window) {
+            m_pointerWindow = nullptr;
+        }
+        if (m_keyboardWindow == window) {
+            m_keyboardWindow = nullptr;
+            m_repeatKey = 0;
+        }
+
+        if (surface.frameCallback) {
+            wl_callback_destroy(surface.frameCallback);
+        }
+        for (auto& buffer : surface.buffers) {
+            destroyBuffer(*buffer);
+        }
+        if (surface.eglSurface != EGL_NO_SURFACE) {
+            if (eglGetCurrentSurface(EGL_DRAW) == surface.eglSurface) {
+                eglMakeCurrent(m_eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+                GLContext::setCurrent(0);
+            }
+            eglDestroySurface(m_eglDisplay, surface.eglSurface);
+        }
+        if (surface.eglWindow) {
+            wl_egl_window_destroy(surface.eglWindow);
+        }
+        xdg_toplevel_destroy(surface.toplevel);
+        xdg_surface_destroy(surface.xdgSurface);
+        wl_surface_destroy(surface.surface);
+        m_surfaces.erase(it);
+
+        // Queued events must not outlive the window they point to
+        m_eventQueue.erase(std::remove_if(m_eventQueue.begin(), m_eventQueue.end(),
+                                          [window](const Event& event) { return event.window == window; }),
+                           m_eventQueue.end());
+        if (m_display) {
+            wl_display_flush(m_display);
+        }
+    }
+
+    void pumpEvents() override {
+        dispatch(0.0);
+        repeatKeys();
+    }
+
+    // Frame callbacks, input and configures all arrive on the display
+    // socket, so waiting on it is the whole event loop; nothing polls
+    void waitEvents(f64 timeout) override {
+        if (!m_eventQueue.empty()) {
+            return;
+        }
+        if (m_repeatKey && m_repeatRate > 0) {
+            // Key repeat is generated here, not by the compositor
+            const u64 now = TimerWheel::clock();
+            const f64 untilRepeat = m_nextRepeat > now ? (m_nextRepeat - now) * 1e-9 : 0.0;
+            timeout = timeout < 0 ? untilRepeat : std::min(timeout, untilRepeat);
+        }
+        dispatch(timeout);
+    }
+
+    void wakeUp() override {
+        if (m_wakePipe[1] >= 0) {
+            char byte = 1;
+            (void)!write(m_wakePipe[1], &byte, 1);
+        }
+    }
+
+    bool hasEvents() const override {
+        return !m_eventQueue.empty();
+    }
+
+    Event nextEvent() override {
+        if (m_eventQueue.empty()) {
+            return Event();
+        }
+        Event event = m_eventQueue.front();
+        m_eventQueue.erase(m_eventQueue.begin());
+        return event;
+    }
+
+    u32 displayCount() const override { return std::max<u32>((u32)m_outputs.size(), 1); }
+
+    Rect displayBounds(u32 index) const override {
+        return index < m_outputs.size() ? m_outputs[index]->bounds : Rect{0, 0, 0, 0};
+    }
+
+    f64 displayRefreshRate(u32 index) const override {
+        return index < m_outputs.size() ? m_outputs[index]->refreshRate : 60.0;
+    }
+
+    // The output the surface entered last; the compositor knows where the
+    // window is, we do not
+    u32 displayOf(Window* window) const override {
+        const WaylandSurface* surface = surfaceOf(window);
+        if (!surface || surface->outputs.empty()) {
+            return 0;
+        }
+        for (u32 i = 0; i < m_outputs.size(); ++i) {
+            if (m_outputs[i]->output == surface->outputs.back()) {
+                return i;
+            }
+        }
+        return 0;
+    }
+
+    std::string name() const override { return "Wayland"; }
+
+    // Mesa's Wayland EGL hands the compositor linux-dmabuf buffers, so GL
+    // frames reach it without a copy
+    void* createGLContext(Window* window) override {
+        WaylandSurface* surface = surfaceOf(window);
+        if (m_eglDisplay == EGL_NO_DISPLAY || !surface || !createEGLSurface(*surface)) {
+            return nullptr;
+        }
+        EGLContext share = static_cast<EGLContext>(shareGLContext());
+        EGLContext context = eglCreateContext(m_eglDisplay, surface->format->config,
+                                              share ? share : EGL_NO_CONTEXT, nullptr);
+        if (context == EGL_NO_CONTEXT) {
+            std::cerr << "[Wayland] Failed to create a GL context" << std::endl;
+            return nullptr;
+        }
+        m_contextSerials[context] = GLContext::allocate();
+        makeCurrent(window, context);
+        return context;
+    }
+
+    void destroyGLContext(void* context) override {
+        if (m_eglDisplay == EGL_NO_DISPLAY || !context) {
+            return;
+        }
+        if (eglGetCurrentContext() == context) {
+            eglMakeCurrent(m_eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+            GLContext::setCurrent(0);
+        }
+        auto serial = m_contextSerials.find(context);
+        if (serial != m_contextSerials.end()) {
+            GLContext::release(serial->second);
+            m_contextSerials.erase(serial);
+        }
+        eglDestroyContext(m_eglDisplay, context);
+    }
+
+    void makeCurrent(Window* window, void* context) override {
+        if (m_eglDisplay == EGL_NO_DISPLAY) {
+            return;
+        }
+        WaylandSurface* surface = surfaceOf(window);
+        if (window && !surface) {
+            return;
+        }
+        // Without a window the context is current surfaceless
+        EGLSurface eglSurface = surface ? surface->eglSurface : EGL_NO_SURFACE;
+        eglMakeCurrent(m_eglDisplay, eglSurface, eglSurface, context);
+        auto serial = m_contextSerials.find(context);
+        GLContext::setCurrent(serial != m_contextSerials.end() ? serial->second : 0);
+    }
+
+    void* shareGLContext() override {
+        if (m_shareContext == EGL_NO_CONTEXT && m_eglDisplay != EGL_NO_DISPLAY && m_defaultFormat) {
+            EGLContext context = eglCreateContext(m_eglDisplay, m_defaultFormat->config, EGL_NO_CONTEXT, nullptr);
+            if (context == EGL_NO_CONTEXT) {
+                return nullptr;
+            }
+            m_shareContext = context;
+            m_contextSerials[context] = GLContext::allocate();
+        }
+        return m_shareContext != EGL_NO_CONTEXT ? m_shareContext : nullptr;
+    }
+
+    void swapBuffers(Window* window) override {
+        WaylandSurface* surface = surfaceOf(window);
+        if (!surface || surface->eglSurface == EGL_NO_SURFACE) {
+            return;
+        }
+        // Requested before the swap so it rides on the swap's commit
+        requestFrameCallback(*surface);
+        if (m_swapWithDamage && !surface->damage.empty()) {
+            // EGL damage has a bottom-left origin
+            std::vector<EGLint> rects;
+            rects.reserve(surface->damage.size() * 4);
+            const f32 height = (f32)window->config().height;
+            for (const Rect& rect : surface->damage) {
+                const f32 top = std::floor(rect.y);
+                const f32 bottom = std::ceil(rect.y + rect.height);
+                rects.push_back((EGLint)std::floor(rect.x));
+                rects.push_back((EGLint)(height - bottom));
+                rects.push_back((EGLint)(std::ceil(rect.x + rect.width) - std::floor(rect.x)));
+                rects.push_back((EGLint)(bottom - top));
+            }
+            m_swapWithDamage(m_eglDisplay, surface->eglSurface, rects.data(), (EGLint)surface->damage.size());
+        } else {
+            eglSwapBuffers(m_eglDisplay, surface->eglSurface);
+        }
+        surface->damage.clear();
+        wl_display_flush(m_display);
+    }
+
+    // Pacing comes from frame callbacks; a blocking swap would wait for
+    // EGL's own callback on top of ours
+    bool setSwapInterval(Window* window, i32 interval) override {
+        WaylandSurface* surface = surfaceOf(window);
+        if (m_eglDisplay == EGL_NO_DISPLAY || !surface || surface->eglSurface == EGL_NO_SURFACE) {
+            return false;
+        }
+        return eglSwapInterval(m_eglDisplay, interval) == EGL_TRUE;
+    }
+
+    // Hidden and unconfigured surfaces get no frame callbacks either
+    bool canPresent(Window* window) const override {
+        const WaylandSurface* surface = surfaceOf(window);
+        return surface && surface->configured && surface->visible && !surface->frameCallback;
+    }
+
+    void setFrameDamage(Window* window, const std::vector<Rect>& regions) override {
+        if (WaylandSurface* surface = surfaceOf(window)) {
+            surface->damage = regions;
+        }
+    }
+
+    // Software frames go through a small pool of wl_shm buffers per
+    // window. The compositor reads them in place; a buffer is written
+    // again only after its release, and only the damaged regions are
+    // recomposited.
+    bool presentPixels(Window* window, const u32* pixels, u32 width, u32 height, u32 stride) override {
+        WaylandSurface* surface = surfaceOf(window);
+        if (!surface || !pixels || !surface->configured || !width || !height) {
+            return false;
+        }
+        // 0xAARRGGBB premultiplied is ARGB8888 on little-endian machines
+        const u32 format = window->config().transparent ? WL_SHM_FORMAT_ARGB8888 : WL_SHM_FORMAT_XRGB8888;
+        WaylandBuffer* buffer = acquireBuffer(*surface, width, height, format);
+        if (!buffer) {
+            return false;
+        }
+
+        u32* target = static_cast<u32*>(buffer->pixels);
+        for (u32 y = 0; y < height; ++y) {
+            std::memcpy(target + (size_t)y * width, pixels + (size_t)y * stride, width * sizeof(u32));
+        }
+
+        wl_surface_attach(surface->surface, buffer->buffer, 0, 0);
+        buffer->busy = true;
+        const bool bufferDamage = wl_surface_get_version(surface->surface) >= WL_SURFACE_DAMAGE_BUFFER_SINCE_VERSION;
+        auto damage = bufferDamage ? wl_surface_damage_buffer : wl_surface_damage;
+        if (surface->damage.empty()) {
+            damage(surface->surface, 0, 0, (i32)width, (i32)height);
+        }
+        for (const Rect& rect : surface->damage) {
+            const i32 x = (i32)std::floor(rect.x);
+            const i32 y = (i32)std::floor(rect.y);
+            damage(surface->surface, x, y, (i32)std::ceil(rect.x + rect.width) - x,
+                   (i32)std::ceil(rect.y + rect.height) - y);
+        }
+        surface->damage.clear();
+        requestFrameCallback(*surface);
+        wl_surface_commit(surface->surface);
+        wl_display_flush(m_display);
+        return true;
+    }
+
+private:
+    friend class WaylandWindow;
+
+    static constexpr size_t kMaxBuffers = 3;
+
+    WaylandSurface* surfaceOf(Window* window) const {
+        auto it = m_surfaces.find(window);
+        return it != m_surfaces.end() ? it->second.get() : nullptr;
+    }
+
+    WaylandSurface* surfaceOf(wl_surface* wlSurface) const {
+        for (const auto& entry : m_surfaces) {
+            if (entry.second->surface == wlSurface) {
+                return entry.second.get();
+            }
+        }
+        return nullptr;
+    }
+
+    Window* windowOf(wl_surface* wlSurface) const {
+        WaylandSurface* surface = surfaceOf(wlSurface);
+        return surface ? surface->window : nullptr;
+    }
+
+    void bindGlobal(u32 name, const char* interface, u32 version) {
+        if (std::strcmp(interface, wl_compositor_interface.name) == 0) {
+            // Version 4 adds damage_buffer
+            m_compositor = static_cast<wl_compositor*>(
+                wl_registry_bind(m_registry, name, &wl_compositor_interface, std::min(version, 4u)));
+        } else if (std::strcmp(interface, wl_shm_interface.name) == 0) {
+            m_shm = static_cast<wl_shm*>(wl_registry_bind(m_registry, name, &wl_shm_interface, 1));
+        } else if (std::strcmp(interface, xdg_wm_base_interface.name) == 0) {
+            static const xdg_wm_base_listener wmBaseListener = {
+                [](void*, xdg_wm_base* wmBase, u32 serial) { xdg_wm_base_pong(wmBase, serial); }
+            };
+            m_wmBase = static_cast<xdg_wm_base*>(
+                wl_registry_bind(m_registry, name, &xdg_wm_base_interface, std::min(version, 2u)));
+            xdg_wm_base_add_listener(m_wmBase, &wmBaseListener, this);
+        } else if (std::strcmp(interface, wl_seat_interface.name) == 0 && !m_seat) {
+            static const wl_seat_listener seatListener = {
+                [](void* data, wl_seat*, u32 capabilities) {
+                    static_cast<WaylandPlatform*>(data)->seatCapabilities(capabilities);
+                },
+                [](void*, wl_seat*, const char*) {}
+            };
+            // Version 5 adds pointer frames and discrete axis steps
+            m_seat = static_cast<wl_seat*>(
+                wl_registry_bind(m_registry, name, &wl_seat_interface, std::min(version, 5u)));
+            wl_seat_add_listener(m_seat, &seatListener, this);
+        } else if (std::strcmp(interface, wl_output_interface.name) == 0) {
+            bindOutput(name, std::min(version, 2u));
+        }
+    }
+
+    void removeGlobal(u32 name) {
+        for (auto it = m_outputs.begin(); it != m_outputs.end(); ++it) {
+            if ((*it)->name != name) {
+                continue;
+            }
+            wl_output* output = (*it)->output;
+            for (auto& entry : m_surfaces) {
+                auto& outputs = entry.second->outputs;
+                outputs.erase(std::remove(outputs.begin(), outputs.end(), output), outputs.end());
+            }
+            wl_output_destroy(output);
+            m_outputs.erase(it);
+            return;
+        }
+    }
+
+    // Bounds from the output's position in the compositor space and its
+    // current mode
+    void bindOutput(u32 name, u32 version) {
+        static const wl_output_listener outputListener = [] {
+            wl_output_listener listener = {};
+            listener.geometry = [](void* data, wl_output*, i32 x, i32 y, i32, i32, i32, const char*, const char*, i32) {
+                WaylandOutput* output = static_cast<WaylandOutput*>(data);
+                output->bounds.x = (f32)x;
+                output->bounds.y = (f32)y;
+            };
+            listener.mode = [](void* data, wl_output*, u32 flags, i32 width, i32 height, i32 refresh) {
+                if (!(flags & WL_OUTPUT_MODE_CURRENT)) {
+                    return;
+                }
+                WaylandOutput* output = static_cast<WaylandOutput*>(data);
+                output->bounds.width = (f32)width;
+                output->bounds.height = (f32)height;
+                // Millihertz; 0 when the output has no fixed rate
+                output->refreshRate = refresh > 0 ? refresh * 1e-3 : 60.0;
+            };
+            listener.done = [](void*, wl_output*) {};
+            listener.scale = [](void*, wl_output*, i32) {};
+            return listener;
+        }();
+        auto output = std::make_unique<WaylandOutput>();
+        output->name = name;
+        output->output = static_cast<wl_output*>(wl_registry_bind(m_registry, name, &wl_output_interface, version));
+        wl_output_add_listener(output->output, &outputListener, output.get());
+        m_outputs.push_back(std::move(output));
+    }
+
+    // The platform display is optional: without it windows present with
+    // presentPixels() only
+    void initializeEGL() {
+        EGLDisplay display = EGL_NO_DISPLAY;
+        auto getPlatformDisplay = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(
+            eglGetProcAddress("eglGetPlatformDisplayEXT"));
+        if (getPlatformDisplay) {
+            display = getPlatformDisplay(EGL_PLATFORM_WAYLAND_KHR, m_display, nullptr);
+        }
+        if (display == EGL_NO_DISPLAY) {
+            display = eglGetDisplay(reinterpret_cast<EGLNativeDisplayType>(m_display));
+        }
+        if (display == EGL_NO_DISPLAY || !eglInitialize(display, nullptr, nullptr)) {
+            std::cerr << "[Wayland] No EGL display; GL is unavailable" << std::endl;
+            return;
+        }
+        if (!eglBindAPI(EGL_OPENGL_API)) {
+            eglTerminate(display);
+            return;
+        }
+        m_eglDisplay = display;
+
+        m_defaultFormat = eglFormat(0, 24, 8, false);
+        if (!m_defaultFormat) {
+            eglTerminate(m_eglDisplay);
+            m_eglDisplay = EGL_NO_DISPLAY;
+            std::cerr << "[Wayland] No usable EGL config; GL is unavailable" << std::endl;
+            return;
+        }
+
+        const char* extensions = eglQueryString(m_eglDisplay, EGL_EXTENSIONS);
+        if (hasExtension(extensions, "EGL_KHR_swap_buffers_with_damage")) {
+            m_swapWithDamage = reinterpret_cast<PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC>(
+                eglGetProcAddress("eglSwapBuffersWithDamageKHR"));
+        } else if (hasExtension(extensions, "EGL_EXT_swap_buffers_with_damage")) {
+            m_swapWithDamage = reinterpret_cast<PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC>(
+                eglGetProcAddress("eglSwapBuffersWithDamageEXT"));
+        }
+    }
+
+    // Cached per combination; the first 8-bit config, with alpha only
+    // when asked, since compositors blend by the buffer format
+    const WaylandEGLFormat* eglFormat(u32 samples, u32 depthBits, u32 stencilBits, bool alpha) {
+        for (auto& format : m_eglFormats) {
+            if (format->samples == samples && format->depthBits == depthBits &&
+                format->stencilBits == stencilBits && format->alpha == alpha) {
+                return format.get();
+            }
+        }
+
+        const EGLint attribs[] = {
+            EGL_SURFACE_TYPE, EGL_WINDOW_BIT,
+            EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+            EGL_RED_SIZE, 8,
+            EGL_GREEN_SIZE, 8,
+            EGL_BLUE_SIZE, 8,
+            EGL_ALPHA_SIZE, alpha ? 8 : 0,
+            EGL_DEPTH_SIZE, (EGLint)depthBits,
+            EGL_STENCIL_SIZE, (EGLint)stencilBits,
+            EGL_SAMPLE_BUFFERS, samples > 0 ? 1 : 0,
+            EGL_SAMPLES, (EGLint)samples,
+            EGL_NONE
+        };
+        EGLint count = 0;
+        if (!eglChooseConfig(m_eglDisplay, attribs, nullptr, 0, &count) || count <= 0) {
+            return nullptr;
+        }
+        std::vector<EGLConfig> configs((size_t)count);
+        eglChooseConfig(m_eglDisplay, attribs, configs.data(), count, &count);
+
+        auto format = std::make_unique<WaylandEGLFormat>();
+        for (EGLint i = 0; i < count && !format->config; ++i) {
+            EGLint redSize = 0, alphaSize = 0;
+            eglGetConfigAttrib(m_eglDisplay, configs[i], EGL_RED_SIZE, &redSize);
+            eglGetConfigAttrib(m_eglDisplay, configs[i], EGL_ALPHA_SIZE, &alphaSize);
+            if (redSize == 8 && (alphaSize > 0) == alpha) {
+                format->config = configs[i];
+            }
+        }
+        if (!format->config) {
+            return nullptr;
+        }
+
+        format->samples = samples;
+        format->depthBits = depthBits;
+        format->stencilBits = stencilBits;
+        format->alpha = alpha;
+        m_eglFormats.push_back(std::move(format));
+        return m_eglFormats.back().get();
+    }
+
+    // Created with the first GL context, so software-only windows never
+    // allocate GL buffers
+    bool createEGLSurface(WaylandSurface& surface) {
+        if (surface.eglSurface != EGL_NO_SURFACE) {
+            return true;
+        }
+        const Window::Config& config = surface.window->config();
+        const WaylandEGLFormat* format =
+            eglFormat(config.samples, config.depthBits, config.stencilBits, config.transparent);
+        if (!format) {
+            std::cerr << "[Wayland] No EGL config with " << config.samples << " samples, depth "
+                      << config.depthBits << ", stencil " << config.stencilBits
+                      << (config.transparent ? " and alpha" : "") << "; using the default" << std::endl;
+            format = m_defaultFormat;
+        }
+        surface.eglWindow = wl_egl_window_create(surface.surface, (int)config.width, (int)config.height);
+        if (!surface.eglWindow) {
+            return false;
+        }
+        surface.eglSurface = eglCreateWindowSurface(m_eglDisplay, format->config,
+                                                    reinterpret_cast<EGLNativeWindowType>(surface.eglWindow),
+                                                    nullptr);
+        if (surface.eglSurface == EGL_NO_SURFACE) {
+            std::cerr << "[Wayland] Failed to create an EGL window surface" << std::endl;
+            wl_egl_window_destroy(surface.eglWindow);
+            surface.eglWindow = nullptr;
+            return false;
+        }
+        surface.format = format;
+        return true;
+    }
+
+    // One callback per frame; its done event makes canPresent() true again
+    void requestFrameCallback(WaylandSurface& surface) {
+        static const wl_callback_listener frameListener = {
+            [](void* data, wl_callback* callback, u32 time) {
+                WaylandSurface* surface = static_cast<WaylandSurface*>(data);
+                wl_callback_destroy(callback);
+                surface->frameCallback = nullptr;
+            }
+        };
+        if (surface.frameCallback) {
+            return;
+        }
+        surface.frameCallback = wl_surface_frame(surface.surface);
+        wl_callback_add_listener(surface.frameCallback, &frameListener, &surface);
+    }
+
+    void configured(WaylandSurface& surface) {
+        const Window::Config& config = surface.window->config();
+        // 0 leaves the size to us
+        const u32 width = surface.pendingWidth > 0 ? (u32)surface.pendingWidth : config.width;
+        const u32 height = surface.pendingHeight > 0 ? (u32)surface.pendingHeight : config.height;
+        surface.configured = true;
+        if (width != config.width || height != config.height) {
+            resize(surface, width, height);
+        }
+    }
+
+    void resize(WaylandSurface& surface, u32 width, u32 height) {
+        static_cast<WaylandWindow*>(surface.window)->resized(width, height);
+        if (surface.eglWindow) {
+            // Takes effect with the next swap
+            wl_egl_window_resize(surface.eglWindow, (int)width, (int)height, 0, 0);
+        }
+        Event event(EventType::WindowResize);
+        event.window = surface.window;
+        event.size.width = width;
+        event.size.height = height;
+        m_eventQueue.push_back(event);
+    }
+
+    void setVisible(WaylandSurface& surface, bool visible) {
+        if (surface.visible == visible) {
+            return;
+        }
+        surface.visible = visible;
+        if (!visible) {
+            // A null buffer unmaps; mapping again starts with a new configure
+            if (surface.frameCallback) {
+                wl_callback_destroy(surface.frameCallback);
+                surface.frameCallback = nullptr;
+            }
+            wl_surface_attach(surface.surface, nullptr, 0, 0);
+            surface.configured = false;
+        }
+        wl_surface_commit(surface.surface);
+        wl_display_flush(m_display);
+    }
+
+    void postClose(Window* window) {
+        Event event(EventType::WindowClose);
+        event.window = window;
+        m_eventQueue.push_back(event);
+    }
+
+    // Reuses a released buffer of the right size, or creates one while the
+    // pool is small; with every buffer still on screen it waits for a
+    // release
+    WaylandBuffer* acquireBuffer(WaylandSurface& surface, u32 width, u32 height, u32 format) {
+        auto& buffers = surface.buffers;
+        for (;;) {
+            // Buffers of an old size are dropped once the compositor is done
+            for (auto it = buffers.begin(); it != buffers.end();) {
+                WaylandBuffer& buffer = **it;
+                if (!buffer.busy && (buffer.width != width || buffer.height != height || buffer.format != format)) {
+                    destroyBuffer(buffer);
+                    it = buffers.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+            for (auto& buffer : buffers) {
+                if (!buffer->busy) {
+                    return buffer.get();
+                }
+            }
+            if (buffers.size() < kMaxBuffers) {
+                auto buffer = createBuffer(width, height, format);
+                if (!buffer) {
+                    return nullptr;
+                }
+                buffers.push_back(std::move(buffer));
+                return buffers.back().get();
+            }
+            if (wl_display_dispatch(m_display) < 0) {
+                return nullptr;
+            }
+        }
+    }
+
+    Unique<WaylandBuffer> createBuffer(u32 width, u32 height, u32 format) {
+        const u32 stride = width * sizeof(u32);
+        const size_t size = (size_t)stride * height;
+        int fd = memfd_create("aurora-shm", MFD_CLOEXEC);
+        if (fd < 0 || ftruncate(fd, (off_t)size) != 0) {
+            std::cerr << "[Wayland] Failed to allocate " << size << " bytes of shared memory" << std::endl;
+            if (fd >= 0) {
+                close(fd);
+            }
+            return nullptr;
+        }
+        void* pixels = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (pixels == MAP_FAILED) {
+            close(fd);
+            return nullptr;
+        }
+
+        static const wl_buffer_listener bufferListener = {
+            [](void* data, wl_buffer*) { static_cast<WaylandBuffer*>(data)->busy = false; }
+        };
+        auto buffer = std::make_unique<WaylandBuffer>();
+        // The pool only hands the fd over; the buffer keeps the mapping alive
+        wl_shm_pool* pool = wl_shm_create_pool(m_shm, fd, (i32)size);
+        buffer->buffer = wl_shm_pool_create_buffer(pool, 0, (i32)width, (i32)height, (i32)stride, format);
+        wl_shm_pool_destroy(pool);
+        close(fd);
+        wl_buffer_add_listener(buffer->buffer, &bufferListener, buffer.get());
+        buffer->pixels = pixels;
+        buffer->size = size;
+        buffer->width = width;
+        buffer->height = height;
+        buffer->format = format;
+        return buffer;
+    }
+
+    void destroyBuffer(WaylandBuffer& buffer) {
+        // Safe while busy: the compositor keeps what it already has
+        if (buffer.buffer) {
+            wl_buffer_destroy(buffer.buffer);
+        }
+        if (buffer.pixels) {
+            munmap(buffer.pixels, buffer.size);
+        }
+        buffer = WaylandBuffer();
+    }
+
+    // Reads whatever the socket has, waiting up to `timeout` seconds
+    // (negative: forever) when nothing is queued, and dispatches it
+    void dispatch(f64 timeout) {
+        if (!m_display || m_connectionLost) {
+            return;
+        }
+        while (wl_display_prepare_read(m_display) != 0) {
+            if (wl_display_dispatch_pending(m_display) < 0) {
+                connectionLost();
+                return;
+            }
+        }
+        if (!m_eventQueue.empty()) {
+            // Already have something to handle; just take what is there
+            timeout = 0.0;
+        }
+        // Our requests must reach the compositor before we sleep
+        wl_display_flush(m_display);
+
+        pollfd fds[2] = {
+            {wl_display_get_fd(m_display), POLLIN, 0},
+            {m_wakePipe[0], POLLIN, 0}
+        };
+        timespec ts;
+        timespec* wait = nullptr;
+        if (timeout >= 0) {
+            ts.tv_sec = (time_t)timeout;
+            ts.tv_nsec = (long)((timeout - (f64)ts.tv_sec) * 1e9);
+            wait = &ts;
+        }
+        ppoll(fds, m_wakePipe[0] >= 0 ? 2 : 1, wait, nullptr);
+
+        if (fds[0].revents & POLLIN) {
+            if (wl_display_read_events(m_display) < 0) {
+                connectionLost();
+                return;
+            }
+        } else {
+            wl_display_cancel_read(m_display);
+        }
+        if (fds[1].revents & POLLIN) {
+            char buffer[64];
+            while (read(m_wakePipe[0], buffer, sizeof(buffer)) > 0) {}
+        }
+        if (wl_display_dispatch_pending(m_display) < 0) {
+            connectionLost();
+        }
+    }
+
+    void connectionLost() {
+        m_connectionLost = true;
+        std::cerr << "[Wayland] Lost the compositor connection" << std::endl;
+        m_eventQueue.push_back(Event(EventType::Quit));
+    }
+
+    void seatCapabilities(u32 capabilities) {
+        const bool pointer = capabilities & WL_SEAT_CAPABILITY_POINTER;
+        const bool keyboard = capabilities & WL_SEAT_CAPABILITY_KEYBOARD;
+        if (pointer && !m_pointer) {
+            m_pointer = wl_seat_get_pointer(m_seat);
+            wl_pointer_add_listener(m_pointer, &pointerListener(), this);
+        } else if (!pointer && m_pointer) {
+            releasePointer();
+        }
+        if (keyboard && !m_keyboard) {
+            m_keyboard = wl_seat_get_keyboard(m_seat);
+            wl_keyboard_add_listener(m_keyboard, &keyboardListener(), this);
+        } else if (!keyboard && m_keyboard) {
+            releaseKeyboard();
+        }
+    }
+
+    void releasePointer() {
+        if (wl_pointer_get_version(m_pointer) >= WL_POINTER_RELEASE_SINCE_VERSION) {
+            wl_pointer_release(m_pointer);
+        } else {
+            wl_pointer_destroy(m_pointer);
+        }
+        m_pointer = nullptr;
+        m_pointerWindow = nullptr;
+    }
+
+    void releaseKeyboard() {
+        if (wl_keyboard_get_version(m_keyboard) >= WL_KEYBOARD_RELEASE_SINCE_VERSION) {
+            wl_keyboard_release(m_keyboard);
+        } else {
+            wl_keyboard_destroy(m_keyboard);
+        }
+        m_keyboard = nullptr;
+        m_keyboardWindow = nullptr;
+        m_repeatKey = 0;
+    }
+
+    void releaseInput() {
+        if (m_pointer) {
+            releasePointer();
+        }
+        if (m_keyboard) {
+            releaseKeyboard();
+        }
+    }
+
+    static const wl_pointer_listener& pointerListener() {
+        static const wl_pointer_listener listener = [] {
+            wl_pointer_listener l = {};
+            l.enter = [](void* data, wl_pointer*, u32 serial, wl_surface* surface, wl_fixed_t x, wl_fixed_t y) {
+                WaylandPlatform* self = static_cast<WaylandPlatform*>(data);
+                self->m_pointerWindow = self->windowOf(surface);
+                Event event(EventType::MouseEnter);
+                event.window = self->m_pointerWindow;
+                event.mouse.x = (f32)wl_fixed_to_double(x);
+                event.mouse.y = (f32)wl_fixed_to_double(y);
+                self->m_eventQueue.push_back(event);
+            };
+            l.leave = [](void* data, wl_pointer*, u32 serial, wl_surface*) {
+                WaylandPlatform* self = static_cast<WaylandPlatform*>(data);
+                Event event(EventType::MouseLeave);
+                event.window = self->m_pointerWindow;
+                event.mouse.x = -1.0f;
+                event.mouse.y = -1.0f;
+                self->m_eventQueue.push_back(event);
+                self->m_pointerWindow = nullptr;
+            };
+            l.motion = [](void* data, wl_pointer*, u32 time, wl_fixed_t x, wl_fixed_t y) {
+                WaylandPlatform* self = static_cast<WaylandPlatform*>(data);
+                Event event(EventType::MouseMove);
+                event.window = self->m_pointerWindow;
+                event.timestamp = waylandTimestamp(time);
+                event.mouse.x = (f32)wl_fixed_to_double(x);
+                event.mouse.y = (f32)wl_fixed_to_double(y);
+                if (event.window) {
+                    event.window->motionHistory().push({event.timestamp, event.mouse.x, event.mouse.y});
+                }
+                self->m_eventQueue.push_back(event);
+            };
+            l.button = [](void* data, wl_pointer*, u32 serial, u32 time, u32 button, u32 state) {
+                WaylandPlatform* self = static_cast<WaylandPlatform*>(data);
+                const MouseButton mouseButton = evdevToMouseButton(button);
+                if (mouseButton == MouseButton::None) {
+                    return;
+                }
+                Event event(state == WL_POINTER_BUTTON_STATE_PRESSED ? EventType::MouseDown : EventType::MouseUp);
+                event.window = self->m_pointerWindow;
+                event.timestamp = waylandTimestamp(time);
+                event.mouseButton.button = mouseButton;
+                self->m_eventQueue.push_back(event);
+            };
+            l.axis = [](void* data, wl_pointer* pointer, u32 time, u32 axis, wl_fixed_t value) {
+                WaylandPlatform* self = static_cast<WaylandPlatform*>(data);
+                Scroll& scroll = self->m_scroll;
+                scroll.time = time;
+                scroll.pending = true;
+                // Positive axis values scroll down / right
+                if (axis == WL_POINTER_AXIS_VERTICAL_SCROLL) {
+                    scroll.dy -= (f32)wl_fixed_to_double(value) / kAxisPerNotch;
+                } else {
+                    scroll.dx += (f32)wl_fixed_to_double(value) / kAxisPerNotch;
+                }
+                if (wl_pointer_get_version(pointer) < WL_POINTER_FRAME_SINCE_VERSION) {
+                    // No frame event will follow
+                    self->flushScroll();
+                }
+            };
+            l.frame = [](void* data, wl_pointer*) {
+                static_cast<WaylandPlatform*>(data)->flushScroll();
+            };
+            l.axis_source = [](void* data, wl_pointer*, u32 source) {
+                static_cast<WaylandPlatform*>(data)->m_scroll.precise =
+                    source == WL_POINTER_AXIS_SOURCE_FINGER || source == WL_POINTER_AXIS_SOURCE_CONTINUOUS;
+            };
+            l.axis_stop = [](void*, wl_pointer*, u32, u32) {};
+            l.axis_discrete = [](void* data, wl_pointer*, u32 axis, i32 discrete) {
+                // Whole notches from a wheel; exact where the value is scaled
+                Scroll& scroll = static_cast<WaylandPlatform*>(data)->m_scroll;
+                if (axis == WL_POINTER_AXIS_VERTICAL_SCROLL) {
+                    scroll.discreteY -= discrete;
+                } else {
+                    scroll.discreteX += discrete;
+                }
+            };
+            return l;
+        }();
+        return listener;
+    }
+
+    // One MouseScroll per pointer frame, so a diagonal touchpad swipe is
+    // one event rather than two
+    void flushScroll() {
+        if (m_scroll.pending) {
+            Event event(EventType::MouseScroll);
+            event.window = m_pointerWindow;
+            event.timestamp = waylandTimestamp(m_scroll.time);
+            event.scroll.dx = m_scroll.discreteX ? (f32)m_scroll.discreteX : m_scroll.dx;
+            event.scroll.dy = m_scroll.discreteY ? (f32)m_scroll.discreteY : m_scroll.dy;
+            event.scroll.precise = m_scroll.precise;
+            m_eventQueue.push_back(event);
+        }
+        m_scroll = Scroll();
+    }
+
+    static const wl_keyboard_listener& keyboardListener() {
+        static const wl_keyboard_listener listener = [] {
+            wl_keyboard_listener l = {};
+            l.keymap = [](void*, wl_keyboard*, u32 format, i32 fd, u32 size) {
+                // Keys are named by evdev position; the keymap is unused (AUR-1)
+                close(fd);
+            };
+            l.enter = [](void* data, wl_keyboard*, u32 serial, wl_surface* surface, wl_array* keys) {
+                WaylandPlatform* self = static_cast<WaylandPlatform*>(data);
+                self->m_keyboardWindow = self->windowOf(surface);
+                self->m_keysDown.reset();
+                Event event(EventType::WindowFocus);
+                event.window = self->m_keyboardWindow;
+                self->m_eventQueue.push_back(event);
+            };
+            l.leave = [](void* data, wl_keyboard*, u32 serial, wl_surface*) {
+                WaylandPlatform* self = static_cast<WaylandPlatform*>(data);
+                Event event(EventType::WindowBlur);
+                event.window = self->m_keyboardWindow;
+                self->m_eventQueue.push_back(event);
+                self->m_keyboardWindow = nullptr;
+                self->m_keysDown.reset();
+                self->m_repeatKey = 0;
+            };
+            l.key = [](void* data, wl_keyboard*, u32 serial, u32 time, u32 key, u32 state) {
+                static_cast<WaylandPlatform*>(data)->handleKey(key, time, state == WL_KEYBOARD_KEY_STATE_PRESSED);
+            };
+            l.modifiers = [](void* data, wl_keyboard*, u32 serial, u32 depressed, u32 latched, u32 locked, u32 group) {
+                static_cast<WaylandPlatform*>(data)->m_modifiers = waylandModifiers(depressed | latched);
+            };
+            l.repeat_info = [](void* data, wl_keyboard*, i32 rate, i32 delay) {
+                WaylandPlatform* self = static_cast<WaylandPlatform*>(data);
+                self->m_repeatRate = rate;
+                self->m_repeatDelay = delay;
+            };
+            return l;
+        }();
+        return listener;
+    }
+
+    void handleKey(u32 key, u32 time, bool pressed) {
+        Event event(pressed ? EventType::KeyDown : EventType::KeyUp);
+        event.window = m_keyboardWindow;
+        event.timestamp = waylandTimestamp(time);
+        event.key.code = evdevToKeyCode(key);
+        event.key.modifiers = m_modifiers;
+        event.key.repeat = false;
+        if (key < m_keysDown.size()) {
+            m_keysDown[key] = pressed;
+        }
+        m_eventQueue.push_back(event);
+
+        // The compositor sends presses only; the client repeats them
+        if (pressed && m_repeatRate > 0 && !isModifier(event.key.code)) {
+            m_repeatKey = key;
+            m_nextRepeat = TimerWheel::clock() + (u64)m_repeatDelay * 1000000ull;
+        } else if (!pressed && key == m_repeatKey) {
+            m_repeatKey = 0;
+        }
+    }
+
+    static bool isModifier(KeyCode code) {
+        return code >= KeyCode::LeftShift && code <= KeyCode::RightSuper;
+    }
+
+    void repeatKeys() {
+        if (!m_repeatKey || m_repeatRate <= 0) {
+            return;
+        }
+        const u64 now = TimerWheel::clock();
+        const u64 interval = 1000000000ull / (u64)m_repeatRate;
+        while (m_nextRepeat <= now) {
+            Event event(EventType::KeyDown);
+            event.window = m_keyboardWindow;
+            event.timestamp = m_nextRepeat * 1e-9;
+            event.key.code = evdevToKeyCode(m_repeatKey);
+            event.key.modifiers = m_modifiers;
+            event.key.repeat = true;
+            m_eventQueue.push_back(event);
+            m_nextRepeat += interval;
+        }
+    }
+
+    struct Scroll {
+        f32 dx = 0.0f;
+        f32 dy = 0.0f;
+        i32 discreteX = 0;
+        i32 discreteY = 0;
+        bool precise = false;
+        bool pending = false;
+        u32 time = 0;
+    };
+
+    wl_display* m_display = nullptr;
+    wl_registry* m_registry = nullptr;
+    wl_compositor* m_compositor = nullptr;
+    wl_shm* m_shm = nullptr;
+    xdg_wm_base* m_wmBase = nullptr;
+    wl_seat* m_seat = nullptr;
+    wl_pointer* m_pointer = nullptr;
+    wl_keyboard* m_keyboard = nullptr;
+    std::vector<Unique<WaylandOutput>> m_outputs;
+    std::unordered_map<Window*, Unique<WaylandSurface>> m_surfaces;
+
+    EGLDisplay m_eglDisplay = EGL_NO_DISPLAY;
+    std::vector<Unique<WaylandEGLFormat>> m_eglFormats;
+    const WaylandEGLFormat* m_defaultFormat = nullptr;
+    EGLContext m_shareContext = EGL_NO_CONTEXT;
+    std::unordered_map<EGLContext, u64> m_contextSerials;
+    PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC m_swapWithDamage = nullptr;
+
+    Window* m_pointerWindow = nullptr;
+    Window* m_keyboardWindow = nullptr;
+    Scroll m_scroll;
+    u32 m_modifiers = 0;
+    std::bitset<256> m_keysDown;
+    i32 m_repeatRate = 25;          // Per second; 0 disables repeat
+    i32 m_repeatDelay = 600;        // Milliseconds
+    u32 m_repeatKey = 0;            // evdev code; 0 when none repeats
+    u64 m_nextRepeat = 0;
+
+    std::vector<Event> m_eventQueue;
+    int m_wakePipe[2] = {-1, -1};
+    bool m_connectionLost = false;
+};
+
+void WaylandWindow::show() {
+    if (m_platform) {
+        m_platform->setVisible(*m_platform->surfaceOf(this), true);
+    }
+}
+
+void WaylandWindow::hide() {
+    if (m_platform) {
+        m_platform->setVisible(*m_platform->surfaceOf(this), false);
+    }
+}
+
+void WaylandWindow::close() {
+    // Same path as the compositor's close request
+    if (m_platform) {
+        m_platform->postClose(this);
+    }
+}
+
+void WaylandWindow::setTitle(const std::string& title) {
+    m_config.title = title;
+    if (m_platform) {
+        xdg_toplevel_set_title(m_platform->surfaceOf(this)->toplevel, title.c_str());
+    }
+}
+
+void WaylandWindow::setPosition(i32 x, i32 y) {
+    // Only the compositor places windows
+    m_config.x = x;
+    m_config.y = y;
+}
+
+void WaylandWindow::setSize(u32 width, u32 height) {
+    if (!m_platform || (width == m_config.width && height == m_config.height)) {
+        return;
+    }
+    WaylandSurface& surface = *m_platform->surfaceOf(this);
+    if (!m_config.resizable) {
+        xdg_toplevel_set_min_size(surface.toplevel, (i32)width, (i32)height);
+        xdg_toplevel_set_max_size(surface.toplevel, (i32)width, (i32)height);
+    }
+    // The buffer size is the window size; the next frame applies it
+    m_platform->resize(surface, width, height);
+}
+
+void WaylandWindow::setOpacity(f32 opacity) {
+    // Core Wayland has no window opacity; transparent windows draw their own
+    m_config.opacity = opacity;
+}
+
+Unique<IPlatform> createWaylandPlatform() {
+    return std::make_unique<WaylandPlatform>();
+}
+
+} // namespace Aurora
+
+#endif // AURORA_PLATFORM_WAYLAND
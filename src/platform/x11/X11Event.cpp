@@ -0,0 +1,127 @@
+// ============================================
+// src/platform/x11/X11Event.cpp
+// ============================================
+#ifdef AURORA_PLATFORM_X11
+
+#include "aurora/platform/x11/X11Event.hpp"
+#include "aurora/core/Timer.hpp"
+#include <X11/XKBlib.h>
+#include <X11/keysym.h>
+#include <algorithm>
+#include <cstdlib>
+
+namespace Aurora {
+
+KeyCode keysymToKeyCode(KeySym keysym) {
+    if (keysym >= XK_a && keysym <= XK_z) {
+        return static_cast<KeyCode>('A' + (keysym - XK_a));
+    }
+    if (keysym >= XK_A && keysym <= XK_Z) {
+        return static_cast<KeyCode>('A' + (keysym - XK_A));
+    }
+    if (keysym >= XK_0 && keysym <= XK_9) {
+        return static_cast<KeyCode>('0' + (keysym - XK_0));
+    }
+    if (keysym >= XK_F1 && keysym <= XK_F12) {
+        return static_cast<KeyCode>((u32)KeyCode::F1 + (keysym - XK_F1));
+    }
+
+    switch (keysym) {
+        case XK_Escape: return KeyCode::Escape;
+        case XK_Tab:
+        case XK_ISO_Left_Tab: return KeyCode::Tab;
+        case XK_space: return KeyCode::Space;
+        case XK_Return:
+        case XK_KP_Enter: return KeyCode::Enter;
+        case XK_BackSpace: return KeyCode::Backspace;
+        case XK_Delete:
+        case XK_KP_Delete: return KeyCode::Delete;
+        case XK_Up:
+        case XK_KP_Up: return KeyCode::Up;
+        case XK_Down:
+        case XK_KP_Down: return KeyCode::Down;
+        case XK_Left:
+        case XK_KP_Left: return KeyCode::Left;
+        case XK_Right:
+        case XK_KP_Right: return KeyCode::Right;
+        case XK_Home:
+        case XK_KP_Home: return KeyCode::Home;
+        case XK_End:
+        case XK_KP_End: return KeyCode::End;
+        case XK_Prior:
+        case XK_KP_Prior: return KeyCode::PageUp;
+        case XK_Next:
+        case XK_KP_Next: return KeyCode::PageDown;
+        case XK_Insert:
+        case XK_KP_Insert: return KeyCode::Insert;
+        case XK_Print: return KeyCode::PrintScreen;
+        case XK_Pause: return KeyCode::Pause;
+        case XK_Shift_L: return KeyCode::LeftShift;
+        case XK_Shift_R: return KeyCode::RightShift;
+        case XK_Control_L: return KeyCode::LeftCtrl;
+        case XK_Control_R: return KeyCode::RightCtrl;
+        case XK_Alt_L:
+        case XK_Meta_L: return KeyCode::LeftAlt;
+        case XK_Alt_R:
+        case XK_Meta_R:
+        case XK_ISO_Level3_Shift: return KeyCode::RightAlt;
+        case XK_Super_L: return KeyCode::LeftSuper;
+        case XK_Super_R: return KeyCode::RightSuper;
+        default: return KeyCode::Unknown;
+    }
+}
+
+u32 x11Modifiers(unsigned int state) {
+    u32 mods = 0;
+    if (state & ShiftMask) mods |= (u32)KeyModifiers::Shift;
+    if (state & ControlMask) mods |= (u32)KeyModifiers::Ctrl;
+    if (state & Mod1Mask) mods |= (u32)KeyModifiers::Alt;
+    if (state & Mod4Mask) mods |= (u32)KeyModifiers::Super;
+    return mods;
+}
+
+X11KeyTable::X11KeyTable() {
+    m_codes.fill(KeyCode::Unknown);
+}
+
+void X11KeyTable::rebuild(Display* display) {
+    m_codes.fill(KeyCode::Unknown);
+    int minKeycode = 0, maxKeycode = 0;
+    XDisplayKeycodes(display, &minKeycode, &maxKeycode);
+    for (int keycode = minKeycode; keycode <= maxKeycode && keycode < (int)m_codes.size(); ++keycode) {
+        // Unshifted symbol of the first group: the key's name on this layout
+        const KeySym keysym = XkbKeycodeToKeysym(display, (::KeyCode)keycode, 0, 0);
+        m_codes[keycode] = keysymToKeyCode(keysym);
+    }
+}
+
+f64 X11Clock::toSeconds(Time serverTime) {
+    const u64 now = TimerWheel::clock() / 1000000;     // Milliseconds
+
+    if (m_sameClock) {
+        // Extend the 32-bit stamp to the full clock value nearest to now
+        const u64 wrap = 1ull << 32;
+        u64 stamp = (now & ~(wrap - 1)) | (u32)serverTime;
+        if (stamp > now + wrap / 2 && stamp >= wrap) {
+            stamp -= wrap;
+        } else if (stamp + wrap / 2 < now) {
+            stamp += wrap;
+        }
+        if (!m_checked) {
+            // A remote or differently clocked server is seconds off at once
+            m_checked = true;
+            m_sameClock = std::llabs((long long)(stamp - now)) < 5000;
+        }
+        if (m_sameClock) {
+            return stamp * 1e-3;
+        }
+        m_offset = (f64)now * 1e-3 - (f64)(u32)serverTime * 1e-3;
+    }
+
+    m_offset = std::min(m_offset, (f64)now * 1e-3 - (f64)(u32)serverTime * 1e-3);
+    return (f64)(u32)serverTime * 1e-3 + m_offset;
+}
+
+} // namespace Aurora
+
+#endif // AURORA_PLATFORM_X11
@@ -4,23 +4,150 @@
 #ifdef AURORA_PLATFORM_X11
 
 #include "aurora/platform/IPlatform.hpp"
+#include "aurora/platform/x11/X11Event.hpp"
+#include "aurora/core/Timer.hpp"
+#include "aurora/graphics/GLContext.hpp"
 #include <X11/Xlib.h>
+#include <X11/Xatom.h>
+#include <X11/Xutil.h>
+#include <X11/XKBlib.h>
+#include <X11/extensions/XShm.h>
+#ifdef AURORA_X11_XINPUT2
+#include <X11/extensions/XInput2.h>
+#endif
+#ifdef AURORA_X11_PRESENT
+#include <X11/extensions/Xpresent.h>
+#endif
+#ifdef AURORA_X11_XRANDR
+#include <X11/extensions/Xrandr.h>
+#endif
 #include <GL/glx.h>
+#include <sys/ipc.h>
+#include <sys/shm.h>
+#include <algorithm>
+#include <bitset>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <poll.h>
+#include <time.h>
+#include <unistd.h>
 #include <unordered_map>
 
 namespace Aurora {
 
+namespace {
+
+// XShmAttach fails asynchronously (e.g. on a remote display)
+bool s_shmFailed = false;
+
+int shmErrorHandler(Display* display, XErrorEvent* error) {
+    s_shmFailed = true;
+    return 0;
+}
+
+bool hasExtension(const char* extensions, const char* name) {
+    const size_t length = std::strlen(name);
+    for (const char* p = extensions; p && (p = std::strstr(p, name)); p += length) {
+        if ((p == extensions || p[-1] == ' ') && (p[length] == ' ' || p[length] == '\0')) {
+            return true;
+        }
+    }
+    return false;
+}
+
+#ifdef AURORA_X11_XRANDR
+f64 modeRefreshRate(const XRRScreenResources* resources, RRMode id) {
+    for (int i = 0; i < resources->nmode; ++i) {
+        const XRRModeInfo& mode = resources->modes[i];
+        if (mode.id != id || !mode.hTotal || !mode.vTotal) {
+            continue;
+        }
+        f64 lines = (f64)mode.vTotal;
+        if (mode.modeFlags & RR_DoubleScan) lines *= 2.0;
+        if (mode.modeFlags & RR_Interlace) lines *= 0.5;
+        return (f64)mode.dotClock / ((f64)mode.hTotal * lines);
+    }
+    return 0.0;
+}
+#endif
+
+} // namespace
+
+class X11Platform;
+
+// GLX framebuffer config, visual and colormap for one combination of the
+// Window::Config GL settings; windows asking for the same one share it
+struct X11SurfaceFormat {
+    u32 samples = 0;
+    u32 depthBits = 0;
+    u32 stencilBits = 0;
+    bool alpha = false;
+    GLXFBConfig fbConfig = nullptr;
+    XVisualInfo* visualInfo = nullptr;
+    Colormap colormap = 0;
+};
+
+// Property and geometry changes are recorded and sent together once per
+// frame (the next pumpEvents() or present), so repeated calls collapse
+// into one request each.
 class X11Window : public Window {
 public:
-    X11Window(const Config& config) : Window(config) {}
-    
-    void show() override { /* X11 implementation */ }
-    void hide() override { /* X11 implementation */ }
-    void close() override { /* X11 implementation */ }
-    void setTitle(const std::string& title) override { /* X11 implementation */ }
-    void setPosition(i32 x, i32 y) override { /* X11 implementation */ }
-    void setSize(u32 width, u32 height) override { /* X11 implementation */ }
-    void setOpacity(f32 opacity) override { /* X11 implementation */ }
+    struct Pending {
+        bool title = false;
+        bool opacity = false;
+        bool position = false;
+        bool size = false;
+        bool visibility = false;
+        
+        bool any() const { return title || opacity || position || size || visibility; }
+    };
+    
+    X11Window(X11Platform* platform, const Config& config) : Window(config), m_platform(platform) {}
+    
+    void show() override;
+    void hide() override;
+    void close() override;
+    void setTitle(const std::string& title) override;
+    void setPosition(i32 x, i32 y) override;
+    void setSize(u32 width, u32 height) override;
+    void setOpacity(f32 opacity) override;
+    
+    bool isVisible() const { return m_visible; }
+    Pending& pending() { return m_pending; }
+    void detach() { m_platform = nullptr; }
+    
+    const X11SurfaceFormat* format() const { return m_format; }
+    void setFormat(const X11SurfaceFormat* format) { m_format = format; }
+    
+    // Position on the root window, for finding the window's output.
+    // Returns false when the position did not change.
+    bool moved(i32 x, i32 y) {
+        if (m_config.x == x && m_config.y == y) {
+            return false;
+        }
+        m_config.x = x;
+        m_config.y = y;
+        return true;
+    }
+    
+    // Inside a window manager frame
+    bool isReparented() const { return m_reparented; }
+    void setReparented(bool reparented) { m_reparented = reparented; }
+    
+    i32 swapInterval() const { return m_swapInterval; }
+    void setSwapInterval(i32 interval) { m_swapInterval = interval; }
+    
+private:
+    void changed();
+    
+    X11Platform* m_platform;
+    const X11SurfaceFormat* m_format = nullptr;
+    bool m_reparented = false;
+    i32 m_swapInterval = 1;
+    Pending m_pending;
+    bool m_visible = true;
 };
 
 class X11Platform : public IPlatform {
@@ -34,95 +161,229 @@ public:
             return false;
         }
         
+        roundTrip();
+        
         m_screen = DefaultScreen(m_display);
         m_rootWindow = RootWindow(m_display, m_screen);
         
-        // Setup OpenGL attributes
-        GLint glxAttribs[] = {
-            GLX_RGBA,
-            GLX_DOUBLEBUFFER,
-            GLX_DEPTH_SIZE, 24,
-            GLX_STENCIL_SIZE, 8,
-            GLX_RED_SIZE, 8,
-            GLX_GREEN_SIZE, 8,
-            GLX_BLUE_SIZE, 8,
-            GLX_ALPHA_SIZE, 8,
-            GLX_SAMPLE_BUFFERS, 1,
-            GLX_SAMPLES, 4,
-            None
-        };
+        // Every atom the platform uses, in one request
+        XInternAtoms(m_display, const_cast<char**>(kAtomNames), AtomCount, False, m_atoms);
+        roundTrip();
         
-        m_visualInfo = glXChooseVisual(m_display, m_screen, glxAttribs);
-        if (!m_visualInfo) {
+        m_hasShm = XShmQueryExtension(m_display);
+        roundTrip();
+        if (m_hasShm) {
+            m_shmEventBase = XShmGetEventBase(m_display);
+        }
+#ifdef AURORA_X11_PRESENT
+        int presentEvent = 0, presentError = 0;
+        if (!XPresentQueryExtension(m_display, &m_presentOpcode, &presentEvent, &presentError)) {
+            m_presentOpcode = 0;
+        }
+        roundTrip();
+#endif
+#ifdef AURORA_X11_XRANDR
+        int randrError = 0;
+        if (XRRQueryExtension(m_display, &m_randrEventBase, &randrError)) {
+            XRRSelectInput(m_display, m_rootWindow, RRScreenChangeNotifyMask);
+        } else {
+            m_randrEventBase = -1;
+        }
+        roundTrip();
+#endif
+        queryOutputs();
+        
+        // First GLX use fetches the server's configs and visuals, several
+        // requests counted here as one; libGL caches them, so formats are
+        // chosen client-side from then on
+        int glxMajor = 0, glxMinor = 0;
+        glXQueryVersion(m_display, &glxMajor, &glxMinor);
+        roundTrip();
+        
+        // Windows without GL settings of their own use this format; the
+        // share context and its pbuffer are created from it
+        m_defaultFormat = surfaceFormat(0, 24, 8, false);
+        if (!m_defaultFormat) {
             XCloseDisplay(m_display);
+            m_display = nullptr;
             return false;
         }
+        loadGLXExtensions();
         
+        m_keyTable.rebuild(m_display);
+        roundTrip();
+        // Key repeat arrives as repeated presses without releases in between
+        XkbSetDetectableAutoRepeat(m_display, True, nullptr);
+        roundTrip();
+#ifdef AURORA_X11_XINPUT2
+        initializeXInput2();
+#endif
+        
+        // Self-pipe so other threads can interrupt waitEvents()
+        if (pipe2(m_wakePipe, O_NONBLOCK | O_CLOEXEC) != 0) {
+            m_wakePipe[0] = m_wakePipe[1] = -1;
+        }
         return true;
     }
     
     void shutdown() override {
-        if (m_visualInfo) {
-            XFree(m_visualInfo);
-            m_visualInfo = nullptr;
+        for (int& fd : m_wakePipe) {
+            if (fd >= 0) {
+                close(fd);
+                fd = -1;
+            }
+        }
+        for (auto& entry : m_presentChains) {
+            destroyPresentChain(entry.second);
         }
+        m_presentChains.clear();
+        for (auto& entry : m_windows) {
+            static_cast<X11Window*>(entry.second)->detach();
+        }
+        m_windows.clear();
+        m_dirtyWindows.clear();
+        if (m_shareContext) {
+            glXMakeContextCurrent(m_display, None, None, nullptr);
+            glXDestroyContext(m_display, m_shareContext);
+            glXDestroyPbuffer(m_display, m_sharePbuffer);
+            m_shareContext = nullptr;
+            m_sharePbuffer = 0;
+        }
+        for (const auto& entry : m_contextSerials) {
+            GLContext::release(entry.second);
+        }
+        m_contextSerials.clear();
+        for (auto& format : m_formats) {
+            XFreeColormap(m_display, format->colormap);
+            XFree(format->visualInfo);
+        }
+        m_formats.clear();
+        m_defaultFormat = nullptr;
         if (m_display) {
             XCloseDisplay(m_display);
             m_display = nullptr;
         }
     }
     
-    Ref<Window> createWindow(const Window::Config& config) override {
-        auto window = std::make_shared<X11Window>(config);
+    // No round trips: the atoms are cached and the requests go out with
+    // the next flush instead of one flush per window
+    Handle<Window> createWindow(const Window::Config& config) override {
+        auto window = makeHandle<X11Window>(this, config);
+        
+        const X11SurfaceFormat* format =
+            surfaceFormat(config.samples, config.depthBits, config.stencilBits, config.transparent);
+        if (!format) {
+            std::cerr << "[X11] No GL config with " << config.samples << " samples, depth "
+                      << config.depthBits << ", stencil " << config.stencilBits
+                      << (config.transparent ? " and alpha" : "") << "; using the default" << std::endl;
+            format = m_defaultFormat;
+        }
+        window->setFormat(format);
         
-        // Create X11 window
         XSetWindowAttributes attrs;
-        attrs.colormap = XCreateColormap(m_display, m_rootWindow, 
-                                        m_visualInfo->visual, AllocNone);
+        attrs.colormap = format->colormap;
         attrs.event_mask = ExposureMask | KeyPressMask | KeyReleaseMask |
                           ButtonPressMask | ButtonReleaseMask | PointerMotionMask |
+                          EnterWindowMask | LeaveWindowMask |
                           StructureNotifyMask | FocusChangeMask;
         attrs.background_pixel = 0;
         attrs.border_pixel = 0;
+        attrs.override_redirect = config.type == Window::Type::Popup ? True : False;
         
         ::Window xwindow = XCreateWindow(
             m_display, m_rootWindow,
             config.x >= 0 ? config.x : 0,
             config.y >= 0 ? config.y : 0,
             config.width, config.height,
-            0, m_visualInfo->depth, InputOutput, m_visualInfo->visual,
-            CWColormap | CWEventMask | CWBackPixel | CWBorderPixel,
+            0, format->visualInfo->depth, InputOutput, format->visualInfo->visual,
+            CWColormap | CWEventMask | CWBackPixel | CWBorderPixel | CWOverrideRedirect,
             &attrs
         );
         
         window->setNativeHandle(reinterpret_cast<void*>(xwindow));
         m_windows[xwindow] = window.get();
+#ifdef AURORA_X11_XINPUT2
+        if (m_xiOpcode) {
+            // Replaces the core pointer and key events for this window
+            selectXInput2(xwindow);
+        }
+#endif
         
-        // Set window properties based on type
-        if (config.type == Window::Type::Dock) {
-            // Set _NET_WM_WINDOW_TYPE_DOCK
-            Atom windowType = XInternAtom(m_display, "_NET_WM_WINDOW_TYPE", False);
-            Atom dockType = XInternAtom(m_display, "_NET_WM_WINDOW_TYPE_DOCK", False);
-            XChangeProperty(m_display, xwindow, windowType, XA_ATOM, 32,
-                          PropModeReplace, (unsigned char*)&dockType, 1);
+        // Window manager hints; read when the window is mapped
+        Atom type = m_atoms[NetWmWindowTypeNormal];
+        switch (config.type) {
+            case Window::Type::Normal: type = m_atoms[NetWmWindowTypeNormal]; break;
+            // EWMH has no panel type; panels reserve space like docks
+            case Window::Type::Dock:
+            case Window::Type::Panel: type = m_atoms[NetWmWindowTypeDock]; break;
+            case Window::Type::Popup: type = m_atoms[NetWmWindowTypePopupMenu]; break;
+            case Window::Type::Desktop: type = m_atoms[NetWmWindowTypeDesktop]; break;
+            case Window::Type::Splash: type = m_atoms[NetWmWindowTypeSplash]; break;
         }
+        XChangeProperty(m_display, xwindow, m_atoms[NetWmWindowType], XA_ATOM, 32,
+                        PropModeReplace, (unsigned char*)&type, 1);
         
-        XMapWindow(m_display, xwindow);
-        XFlush(m_display);
+        Atom protocols[] = {m_atoms[WmDeleteWindow]};
+        XChangeProperty(m_display, xwindow, m_atoms[WmProtocols], XA_ATOM, 32,
+                        PropModeReplace, (unsigned char*)protocols, 1);
+        
+        if (config.alwaysOnTop) {
+            Atom above = m_atoms[NetWmStateAbove];
+            XChangeProperty(m_display, xwindow, m_atoms[NetWmState], XA_ATOM, 32,
+                            PropModeReplace, (unsigned char*)&above, 1);
+        }
+        if (!config.decorated) {
+            // flags = decorations, decorations = none
+            long hints[5] = {2, 0, 0, 0, 0};
+            XChangeProperty(m_display, xwindow, m_atoms[MotifWmHints], m_atoms[MotifWmHints], 32,
+                            PropModeReplace, (unsigned char*)hints, 5);
+        }
+        if (!config.resizable) {
+            XSizeHints* hints = XAllocSizeHints();
+            hints->flags = PMinSize | PMaxSize;
+            hints->min_width = hints->max_width = (int)config.width;
+            hints->min_height = hints->max_height = (int)config.height;
+            XSetWMNormalHints(m_display, xwindow, hints);
+            XFree(hints);
+        }
+        setTitleProperty(xwindow, config.title);
+        setOpacityProperty(xwindow, config.opacity);
         
+        XMapWindow(m_display, xwindow);
         return window;
     }
     
     void destroyWindow(Window* window) override {
         ::Window xwindow = reinterpret_cast<::Window>(window->nativeHandle());
         m_windows.erase(xwindow);
+        static_cast<X11Window*>(window)->detach();
+        m_dirtyWindows.erase(std::remove(m_dirtyWindows.begin(), m_dirtyWindows.end(), window),
+                             m_dirtyWindows.end());
+        auto chain = m_presentChains.find(xwindow);
+        if (chain != m_presentChains.end()) {
+            destroyPresentChain(chain->second);
+            m_presentChains.erase(chain);
+        }
         XDestroyWindow(m_display, xwindow);
     }
     
     void pumpEvents() override {
+        // XPending() flushes, so this frame's window changes go out together
+        flushWindowChanges();
         while (XPending(m_display)) {
             XEvent xevent;
             XNextEvent(m_display, &xevent);
+            if (handlePresentEvent(xevent)) {
+                continue;
+            }
+#ifdef AURORA_X11_XRANDR
+            if (m_randrEventBase >= 0 && xevent.type == m_randrEventBase + RRScreenChangeNotify) {
+                // Monitors were added, removed or changed mode
+                XRRUpdateConfiguration(&xevent);
+                queryOutputs();
+                continue;
+            }
+#endif
             
             Event event;
             ::Window xwindow = xevent.xany.window;
@@ -131,8 +392,35 @@ public:
                 event.window = it->second;
             }
             
+#ifdef AURORA_X11_XINPUT2
+            if (xevent.type == GenericEvent && xevent.xcookie.extension == m_xiOpcode) {
+                if (XGetEventData(m_display, &xevent.xcookie)) {
+                    handleXInput2(xevent.xcookie);
+                    XFreeEventData(m_display, &xevent.xcookie);
+                }
+                continue;
+            }
+#endif
+            
             switch (xevent.type) {
+                case ReparentNotify:
+                    if (event.window) {
+                        static_cast<X11Window*>(event.window)->setReparented(xevent.xreparent.parent != m_rootWindow);
+                    }
+                    break;
+                    
                 case ConfigureNotify:
+                    // Root coordinates when sent by the window manager or
+                    // when unframed; otherwise relative to the frame
+                    if (event.window && (xevent.xconfigure.send_event ||
+                                         !static_cast<X11Window*>(event.window)->isReparented()) &&
+                        static_cast<X11Window*>(event.window)->moved(xevent.xconfigure.x, xevent.xconfigure.y)) {
+                        Event move = event;
+                        move.type = EventType::WindowMove;
+                        move.position.x = xevent.xconfigure.x;
+                        move.position.y = xevent.xconfigure.y;
+                        m_eventQueue.push_back(move);
+                    }
                     event.type = EventType::WindowResize;
                     event.size.width = xevent.xconfigure.width;
                     event.size.height = xevent.xconfigure.height;
@@ -140,98 +428,992 @@ public:
                     break;
                     
                 case MotionNotify:
-                    event.type = EventType::MouseMove;
-                    event.mouse.x = xevent.xmotion.x;
-                    event.mouse.y = xevent.xmotion.y;
-                    m_eventQueue.push_back(event);
+                    event.timestamp = m_clock.toSeconds(xevent.xmotion.time);
+                    pushMotion(event, (f32)xevent.xmotion.x, (f32)xevent.xmotion.y);
                     break;
                     
                 case ButtonPress:
-                    event.type = EventType::MouseDown;
-                    event.mouseButton.button = static_cast<MouseButton>(xevent.xbutton.button);
-                    m_eventQueue.push_back(event);
+                case ButtonRelease:
+                    event.timestamp = m_clock.toSeconds(xevent.xbutton.time);
+                    pushButton(event, xevent.xbutton.button, xevent.type == ButtonPress, false);
                     break;
                     
                 case KeyPress:
-                    event.type = EventType::KeyDown;
-                    // Convert X11 keycode to Aurora KeyCode
-                    event.key.code = convertKeyCode(xevent.xkey.keycode);
-                    event.key.modifiers = convertModifiers(xevent.xkey.state);
-                    event.key.repeat = false;
+                case KeyRelease:
+                    event.timestamp = m_clock.toSeconds(xevent.xkey.time);
+                    pushKey(event, xevent.xkey.keycode, xevent.xkey.state, xevent.type == KeyPress);
+                    break;
+                    
+                case EnterNotify:
+                case LeaveNotify:
+                    event.type = xevent.type == EnterNotify ? EventType::MouseEnter : EventType::MouseLeave;
+                    event.timestamp = m_clock.toSeconds(xevent.xcrossing.time);
+                    event.mouse.x = (f32)xevent.xcrossing.x;
+                    event.mouse.y = (f32)xevent.xcrossing.y;
                     m_eventQueue.push_back(event);
                     break;
+                    
+                case FocusIn:
+                case FocusOut:
+                    event.type = xevent.type == FocusIn ? EventType::WindowFocus : EventType::WindowBlur;
+                    m_keysDown.reset();
+                    m_eventQueue.push_back(event);
+                    break;
+                    
+                case ClientMessage:
+                    if ((Atom)xevent.xclient.message_type == m_atoms[WmProtocols] &&
+                        (Atom)xevent.xclient.data.l[0] == m_atoms[WmDeleteWindow]) {
+                        event.type = EventType::WindowClose;
+                        m_eventQueue.push_back(event);
+                    }
+                    break;
+                    
+                case MappingNotify:
+                    if (xevent.xmapping.request != MappingPointer) {
+                        XRefreshKeyboardMapping(&xevent.xmapping);
+                        m_keyTable.rebuild(m_display);
+                        roundTrip();
+                    }
+                    break;
             }
         }
     }
     
+    void waitEvents(f64 timeout) override {
+        XFlush(m_display);
+        if (XPending(m_display)) {
+            return;
+        }
+        
+        pollfd fds[2] = {
+            {ConnectionNumber(m_display), POLLIN, 0},
+            {m_wakePipe[0], POLLIN, 0}
+        };
+        timespec ts;
+        timespec* wait = nullptr;
+        if (timeout >= 0) {
+            ts.tv_sec = (time_t)timeout;
+            ts.tv_nsec = (long)((timeout - (f64)ts.tv_sec) * 1e9);
+            wait = &ts;
+        }
+        ppoll(fds, m_wakePipe[0] >= 0 ? 2 : 1, wait, nullptr);
+        
+        if (fds[1].revents & POLLIN) {
+            char buffer[64];
+            while (read(m_wakePipe[0], buffer, sizeof(buffer)) > 0) {}
+        }
+    }
+    
+    void wakeUp() override {
+        if (m_wakePipe[1] >= 0) {
+            char byte = 1;
+            (void)!write(m_wakePipe[1], &byte, 1);
+        }
+    }
+    
     bool hasEvents() const override {
         return !m_eventQueue.empty();
     }
     
     Event nextEvent() override {
         if (m_eventQueue.empty()) {
-            return Event(EventType::None);
+            return Event();
         }
         Event event = m_eventQueue.front();
         m_eventQueue.erase(m_eventQueue.begin());
         return event;
     }
     
-    u32 displayCount() const override { return 1; }
+    u32 displayCount() const override { return (u32)m_outputs.size(); }
     
     Rect displayBounds(u32 index) const override {
-        return {0, 0, 
-                (f32)DisplayWidth(m_display, m_screen),
-                (f32)DisplayHeight(m_display, m_screen)};
+        return index < m_outputs.size() ? m_outputs[index].bounds : Rect{0, 0, 0, 0};
+    }
+    
+    f64 displayRefreshRate(u32 index) const override {
+        return index < m_outputs.size() ? m_outputs[index].refreshRate : 60.0;
+    }
+    
+    u32 displayOf(Window* window) const override {
+        const Window::Config& config = window->config();
+        const Vec2 center((f32)std::max(config.x, 0) + config.width * 0.5f,
+                          (f32)std::max(config.y, 0) + config.height * 0.5f);
+        for (u32 i = 0; i < m_outputs.size(); ++i) {
+            if (m_outputs[i].bounds.contains(center)) {
+                return i;
+            }
+        }
+        return 0;
     }
     
     std::string name() const override { return "X11"; }
+    u64 roundTrips() const override { return m_roundTrips; }
     
+    // Per-window contexts are created against the window's own config and
+    // share every object with the hidden context, so a second window
+    // compiles no shaders and uploads no textures of its own
     void* createGLContext(Window* window) override {
-        ::Window xwindow = reinterpret_cast<::Window>(window->nativeHandle());
-        GLXContext context = glXCreateContext(m_display, m_visualInfo, nullptr, GL_TRUE);
-        glXMakeCurrent(m_display, xwindow, context);
+        const X11SurfaceFormat* format = static_cast<X11Window*>(window)->format();
+        GLXContext share = static_cast<GLXContext>(shareGLContext());
+        GLXContext context = glXCreateNewContext(m_display, format->fbConfig, GLX_RGBA_TYPE, share, True);
+        if (!context) {
+            std::cerr << "[X11] Failed to create a GL context" << std::endl;
+            return nullptr;
+        }
+        m_contextSerials[context] = GLContext::allocate();
+        makeCurrent(window, context);
         return context;
     }
     
     void destroyGLContext(void* context) override {
-        glXDestroyContext(m_display, static_cast<GLXContext>(context));
+        GLXContext glxContext = static_cast<GLXContext>(context);
+        if (glXGetCurrentContext() == glxContext) {
+            glXMakeContextCurrent(m_display, None, None, nullptr);
+            GLContext::setCurrent(0);
+        }
+        auto serial = m_contextSerials.find(glxContext);
+        if (serial != m_contextSerials.end()) {
+            GLContext::release(serial->second);
+            m_contextSerials.erase(serial);
+        }
+        glXDestroyContext(m_display, glxContext);
     }
     
     void makeCurrent(Window* window, void* context) override {
-        ::Window xwindow = reinterpret_cast<::Window>(window->nativeHandle());
-        glXMakeCurrent(m_display, xwindow, static_cast<GLXContext>(context));
+        GLXDrawable drawable = window ? reinterpret_cast<::Window>(window->nativeHandle()) : m_sharePbuffer;
+        glXMakeContextCurrent(m_display, drawable, drawable, static_cast<GLXContext>(context));
+        auto serial = m_contextSerials.find(static_cast<GLXContext>(context));
+        GLContext::setCurrent(serial != m_contextSerials.end() ? serial->second : 0);
+    }
+    
+    // Created on first use with a 1x1 pbuffer to be current on
+    void* shareGLContext() override {
+        if (!m_shareContext) {
+            m_shareContext = glXCreateNewContext(m_display, m_defaultFormat->fbConfig, GLX_RGBA_TYPE,
+                                                 nullptr, True);
+            if (!m_shareContext) {
+                return nullptr;
+            }
+            const int attribs[] = {GLX_PBUFFER_WIDTH, 1, GLX_PBUFFER_HEIGHT, 1, None};
+            m_sharePbuffer = glXCreatePbuffer(m_display, m_defaultFormat->fbConfig, attribs);
+            m_contextSerials[m_shareContext] = GLContext::allocate();
+        }
+        return m_shareContext;
     }
     
     void swapBuffers(Window* window) override {
         ::Window xwindow = reinterpret_cast<::Window>(window->nativeHandle());
-        glXSwapBuffers(m_display, xwindow);
+        flushWindowChanges();
+        if (m_swapBuffersMsc && static_cast<X11Window*>(window)->swapInterval() == 0) {
+            // At the next vblank, queued without waiting for it
+            m_swapBuffersMsc(m_display, xwindow, 0, 1, 0);
+        } else {
+            glXSwapBuffers(m_display, xwindow);
+        }
+    }
+    
+    // With OML sync control, interval 0 still swaps at a vblank but never
+    // blocks the caller (see swapBuffers()); without it, it may tear
+    bool setSwapInterval(Window* window, i32 interval) override {
+        ::Window xwindow = reinterpret_cast<::Window>(window->nativeHandle());
+        static_cast<X11Window*>(window)->setSwapInterval(interval);
+        if (m_swapIntervalEXT) {
+            m_swapIntervalEXT(m_display, xwindow, interval);
+        } else if (m_swapIntervalMESA) {
+            // Applies to the current context's drawable
+            m_swapIntervalMESA((unsigned int)interval);
+        } else {
+            return interval == 0 && m_swapBuffersMsc;
+        }
+        return true;
+    }
+    
+    bool vblankTiming(Window* window, u64& lastVblank, u64& interval) override {
+        if (!m_getSyncValues || !m_getMscRate) {
+            return false;
+        }
+        ::Window xwindow = reinterpret_cast<::Window>(window->nativeHandle());
+        int64_t ust = 0, msc = 0, sbc = 0;
+        int32_t numerator = 0, denominator = 0;
+        if (!m_getSyncValues(m_display, xwindow, &ust, &msc, &sbc) ||
+            !m_getMscRate(m_display, xwindow, &numerator, &denominator) ||
+            ust <= 0 || numerator <= 0 || denominator <= 0) {
+            return false;
+        }
+        // UST is CLOCK_MONOTONIC microseconds on Linux, the TimerWheel
+        // clock's source; a counter on any other clock is of no use
+        lastVblank = (u64)ust * 1000;
+        interval = (u64)(1e9 * denominator / numerator);
+        const u64 now = TimerWheel::clock();
+        return lastVblank <= now + interval && now - std::min(now, lastVblank) < 1000000000ull;
+    }
+    
+    // Software frames go through a pair of MIT-SHM buffers per window, so
+    // the server reads pixels straight from our memory instead of over the
+    // socket. A buffer stays busy until the server reports it is done with
+    // it (ShmCompletion, or PresentIdleNotify when flipping pixmaps with
+    // the Present extension); only then is it written again.
+    bool presentPixels(Window* window, const u32* pixels, u32 width, u32 height, u32 stride) override {
+        ::Window xwindow = reinterpret_cast<::Window>(window->nativeHandle());
+        flushWindowChanges();
+        PresentChain& chain = m_presentChains[xwindow];
+        if (!chain.gc || chain.width != width || chain.height != height) {
+            destroyPresentChain(chain);
+            const XVisualInfo* visual = static_cast<X11Window*>(window)->format()->visualInfo;
+            if (!createPresentChain(chain, xwindow, visual, width, height)) {
+                m_presentChains.erase(xwindow);
+                return false;
+            }
+        }
+        
+        PresentBuffer& buffer = chain.buffers[chain.next];
+        while (buffer.busy) {
+            // The previous frame in this buffer is still being read
+            XEvent xevent;
+            XIfEvent(m_display, &xevent, isPresentEvent, reinterpret_cast<XPointer>(this));
+            handlePresentEvent(xevent);
+        }
+        
+        // 0xAARRGGBB matches 32bpp ZPixmap on little-endian servers
+        XImage* image = buffer.image;
+        for (u32 y = 0; y < height; ++y) {
+            std::memcpy(image->data + (size_t)y * image->bytes_per_line,
+                        pixels + (size_t)y * stride, width * sizeof(u32));
+        }
+        
+#ifdef AURORA_X11_PRESENT
+        if (buffer.pixmap) {
+            // Queued for the next vblank instead of copied at once
+            XPresentPixmap(m_display, xwindow, buffer.pixmap, (u32)++chain.presented, None, None, 0, 0,
+                           None, None, None, PresentOptionNone, 0, 0, 0, nullptr, 0);
+            buffer.busy = true;
+        } else
+#endif
+        if (chain.shared) {
+            XShmPutImage(m_display, xwindow, chain.gc, image, 0, 0, 0, 0, width, height, True);
+            buffer.busy = true;
+            ++chain.presented;
+        } else {
+            // Copied into the request, so the buffer is free right away
+            XPutImage(m_display, xwindow, chain.gc, image, 0, 0, 0, 0, width, height);
+            ++chain.presented;
+        }
+        XFlush(m_display);
+        chain.next ^= 1;
+        return true;
     }
     
 private:
-    KeyCode convertKeyCode(unsigned int xkey) {
-        // Simplified conversion - full implementation would use XLookupKeysym
-        if (xkey >= 24 && xkey <= 33) return static_cast<KeyCode>('1' + (xkey - 24));
-        if (xkey >= 38 && xkey <= 63) return static_cast<KeyCode>('A' + (xkey - 38));
-        return KeyCode::Unknown;
+    // Cached per combination, so six panels with the same settings share
+    // one config lookup and one colormap
+    X11SurfaceFormat* surfaceFormat(u32 samples, u32 depthBits, u32 stencilBits, bool alpha) {
+        for (auto& format : m_formats) {
+            if (format->samples == samples && format->depthBits == depthBits &&
+                format->stencilBits == stencilBits && format->alpha == alpha) {
+                return format.get();
+            }
+        }
+        
+        const int attribs[] = {
+            GLX_X_RENDERABLE, True,
+            GLX_DRAWABLE_TYPE, GLX_WINDOW_BIT | GLX_PBUFFER_BIT,
+            GLX_RENDER_TYPE, GLX_RGBA_BIT,
+            GLX_X_VISUAL_TYPE, GLX_TRUE_COLOR,
+            GLX_DOUBLEBUFFER, True,
+            GLX_RED_SIZE, 8,
+            GLX_GREEN_SIZE, 8,
+            GLX_BLUE_SIZE, 8,
+            GLX_ALPHA_SIZE, alpha ? 8 : 0,
+            GLX_DEPTH_SIZE, (int)depthBits,
+            GLX_STENCIL_SIZE, (int)stencilBits,
+            GLX_SAMPLE_BUFFERS, samples > 0 ? 1 : 0,
+            GLX_SAMPLES, (int)samples,
+            None
+        };
+        int count = 0;
+        GLXFBConfig* configs = glXChooseFBConfig(m_display, m_screen, attribs, &count);
+        
+        // Configs come sorted deepest color first; take the first 8-bit
+        // one, and for alpha one whose visual carries it (depth 32), since
+        // compositors blend by the visual
+        auto format = std::make_unique<X11SurfaceFormat>();
+        for (int i = 0; i < count && !format->fbConfig; ++i) {
+            int redSize = 0;
+            glXGetFBConfigAttrib(m_display, configs[i], GLX_RED_SIZE, &redSize);
+            XVisualInfo* visualInfo = glXGetVisualFromFBConfig(m_display, configs[i]);
+            if (visualInfo && redSize == 8 && (!alpha || visualInfo->depth == 32)) {
+                format->fbConfig = configs[i];
+                format->visualInfo = visualInfo;
+            } else if (visualInfo) {
+                XFree(visualInfo);
+            }
+        }
+        if (configs) {
+            XFree(configs);
+        }
+        if (!format->fbConfig) {
+            return nullptr;
+        }
+        
+        format->samples = samples;
+        format->depthBits = depthBits;
+        format->stencilBits = stencilBits;
+        format->alpha = alpha;
+        format->colormap = XCreateColormap(m_display, m_rootWindow, format->visualInfo->visual, AllocNone);
+        m_formats.push_back(std::move(format));
+        return m_formats.back().get();
+    }
+    
+    // Monitors as RandR CRTCs; without RandR, the whole screen at 60 Hz
+    void queryOutputs() {
+        m_outputs.clear();
+#ifdef AURORA_X11_XRANDR
+        XRRScreenResources* resources = nullptr;
+        if (m_randrEventBase >= 0) {
+            resources = XRRGetScreenResourcesCurrent(m_display, m_rootWindow);
+            roundTrip();
+        }
+        if (resources) {
+            for (int i = 0; i < resources->ncrtc; ++i) {
+                XRRCrtcInfo* crtc = XRRGetCrtcInfo(m_display, resources, resources->crtcs[i]);
+                roundTrip();
+                if (!crtc) {
+                    continue;
+                }
+                if (crtc->mode != None && crtc->noutput > 0) {
+                    Output output;
+                    output.bounds = {(f32)crtc->x, (f32)crtc->y, (f32)crtc->width, (f32)crtc->height};
+                    const f64 rate = modeRefreshRate(resources, crtc->mode);
+                    output.refreshRate = rate > 0.0 ? rate : 60.0;
+                    m_outputs.push_back(output);
+                }
+                XRRFreeCrtcInfo(crtc);
+            }
+            XRRFreeScreenResources(resources);
+        }
+#endif
+        if (m_outputs.empty()) {
+            Output output;
+            output.bounds = {0, 0, (f32)DisplayWidth(m_display, m_screen), (f32)DisplayHeight(m_display, m_screen)};
+            m_outputs.push_back(output);
+        }
     }
     
-    u32 convertModifiers(unsigned int state) {
-        u32 mods = 0;
-        if (state & ShiftMask) mods |= (u32)KeyModifiers::Shift;
-        if (state & ControlMask) mods |= (u32)KeyModifiers::Ctrl;
-        if (state & Mod1Mask) mods |= (u32)KeyModifiers::Alt;
-        return mods;
+    void loadGLXExtensions() {
+        const char* extensions = glXQueryExtensionsString(m_display, m_screen);
+        auto load = [](const char* name) { return glXGetProcAddressARB((const GLubyte*)name); };
+        if (hasExtension(extensions, "GLX_OML_sync_control")) {
+            m_getSyncValues = (PFNGLXGETSYNCVALUESOMLPROC)load("glXGetSyncValuesOML");
+            m_getMscRate = (PFNGLXGETMSCRATEOMLPROC)load("glXGetMscRateOML");
+            m_swapBuffersMsc = (PFNGLXSWAPBUFFERSMSCOMLPROC)load("glXSwapBuffersMscOML");
+        }
+        if (hasExtension(extensions, "GLX_EXT_swap_control")) {
+            m_swapIntervalEXT = (PFNGLXSWAPINTERVALEXTPROC)load("glXSwapIntervalEXT");
+        } else if (hasExtension(extensions, "GLX_MESA_swap_control")) {
+            m_swapIntervalMESA = (PFNGLXSWAPINTERVALMESAPROC)load("glXSwapIntervalMESA");
+        }
     }
     
+    struct PresentBuffer {
+        XImage* image = nullptr;
+        XShmSegmentInfo shm = {};
+        Pixmap pixmap = 0;      // Present only: a pixmap over the same segment
+        bool busy = false;
+    };
+    
+    struct PresentChain {
+        PresentBuffer buffers[2];
+        GC gc = nullptr;
+        u32 width = 0;
+        u32 height = 0;
+        u32 next = 0;
+        bool shared = false;
+        u64 presented = 0;      // Frames presented, the Present serial
+    };
+    
+    bool createPresentChain(PresentChain& chain, ::Window xwindow, const XVisualInfo* visual,
+                            u32 width, u32 height) {
+        chain.shared = m_hasShm;
+        for (PresentBuffer& buffer : chain.buffers) {
+            if (chain.shared && !createSharedBuffer(buffer, visual, width, height)) {
+                // Fall back for the whole chain, e.g. on a remote display
+                for (PresentBuffer& created : chain.buffers) {
+                    destroyPresentBuffer(created);
+                }
+                chain.shared = false;
+                break;
+            }
+        }
+        
+        if (!chain.shared) {
+            for (PresentBuffer& buffer : chain.buffers) {
+                buffer.image = XCreateImage(m_display, visual->visual, visual->depth, ZPixmap, 0,
+                                            nullptr, width, height, 32, 0);
+                if (!buffer.image || buffer.image->bits_per_pixel != 32) {
+                    std::cerr << "[X11] No 32bpp image format for software presentation" << std::endl;
+                    destroyPresentChain(chain);
+                    return false;
+                }
+                buffer.image->data = (char*)std::malloc((size_t)buffer.image->bytes_per_line * height);
+            }
+        }
+        
+#ifdef AURORA_X11_PRESENT
+        if (chain.shared && m_presentOpcode && XShmPixmapFormat(m_display) == ZPixmap) {
+            for (PresentBuffer& buffer : chain.buffers) {
+                buffer.pixmap = XShmCreatePixmap(m_display, xwindow, buffer.shm.shmaddr, &buffer.shm,
+                                                 width, height, visual->depth);
+            }
+            XPresentSelectInput(m_display, xwindow, PresentIdleNotifyMask);
+        }
+#endif
+        
+        chain.gc = XCreateGC(m_display, xwindow, 0, nullptr);
+        chain.width = width;
+        chain.height = height;
+        return true;
+    }
+    
+    bool createSharedBuffer(PresentBuffer& buffer, const XVisualInfo* visual, u32 width, u32 height) {
+        buffer.shm.shmid = -1;
+        buffer.image = XShmCreateImage(m_display, visual->visual, visual->depth, ZPixmap,
+                                       nullptr, &buffer.shm, width, height);
+        if (!buffer.image || buffer.image->bits_per_pixel != 32) {
+            return false;
+        }
+        
+        buffer.shm.shmid = shmget(IPC_PRIVATE, (size_t)buffer.image->bytes_per_line * height, IPC_CREAT | 0600);
+        if (buffer.shm.shmid < 0) {
+            return false;
+        }
+        buffer.shm.shmaddr = (char*)shmat(buffer.shm.shmid, nullptr, 0);
+        bool attached = false;
+        if (buffer.shm.shmaddr != (char*)-1) {
+            buffer.image->data = buffer.shm.shmaddr;
+            buffer.shm.readOnly = False;
+            
+            s_shmFailed = false;
+            XErrorHandler previous = XSetErrorHandler(shmErrorHandler);
+            XShmAttach(m_display, &buffer.shm);
+            XSync(m_display, False);
+            roundTrip();
+            XSetErrorHandler(previous);
+            attached = !s_shmFailed;
+        }
+        
+        // Freed once both sides detach
+        shmctl(buffer.shm.shmid, IPC_RMID, nullptr);
+        if (!attached) {
+            // Not attached on the server, so only detach locally
+            if (buffer.shm.shmaddr != (char*)-1) {
+                shmdt(buffer.shm.shmaddr);
+            }
+            buffer.shm.shmaddr = nullptr;
+            buffer.image->data = nullptr;
+            return false;
+        }
+        return true;
+    }
+    
+    void destroyPresentBuffer(PresentBuffer& buffer) {
+        if (buffer.pixmap) {
+            XFreePixmap(m_display, buffer.pixmap);
+        }
+        if (buffer.shm.shmaddr && buffer.shm.shmaddr != (char*)-1) {
+            XShmDetach(m_display, &buffer.shm);
+            // The server must be done with the segment before it goes away
+            XSync(m_display, False);
+            roundTrip();
+            shmdt(buffer.shm.shmaddr);
+            if (buffer.image) {
+                // XDestroyImage must not free() the segment
+                buffer.image->data = nullptr;
+            }
+        }
+        if (buffer.image) {
+            XDestroyImage(buffer.image);
+        }
+        buffer = PresentBuffer();
+    }
+    
+    void destroyPresentChain(PresentChain& chain) {
+        for (PresentBuffer& buffer : chain.buffers) {
+            destroyPresentBuffer(buffer);
+        }
+        if (chain.gc) {
+            XFreeGC(m_display, chain.gc);
+        }
+        chain = PresentChain();
+    }
+    
+    static Bool isPresentEvent(Display* display, XEvent* xevent, XPointer arg) {
+        const X11Platform* self = reinterpret_cast<const X11Platform*>(arg);
+        if (self->m_hasShm && xevent->type == self->m_shmEventBase + ShmCompletion) {
+            return True;
+        }
+        return self->m_presentOpcode && xevent->type == GenericEvent &&
+               xevent->xcookie.extension == self->m_presentOpcode;
+    }
+    
+    // Frees the buffer a completion event refers to; false for other events
+    bool handlePresentEvent(XEvent& xevent) {
+        if (!isPresentEvent(m_display, &xevent, reinterpret_cast<XPointer>(this))) {
+            return false;
+        }
+        if (xevent.type != GenericEvent) {
+            const XShmCompletionEvent& done = reinterpret_cast<const XShmCompletionEvent&>(xevent);
+            auto it = m_presentChains.find(done.drawable);
+            if (it != m_presentChains.end()) {
+                for (PresentBuffer& buffer : it->second.buffers) {
+                    if (buffer.shm.shmseg == done.shmseg) {
+                        buffer.busy = false;
+                    }
+                }
+            }
+            return true;
+        }
+#ifdef AURORA_X11_PRESENT
+        if (XGetEventData(m_display, &xevent.xcookie)) {
+            if (xevent.xcookie.evtype == PresentIdleNotify) {
+                const XPresentIdleNotifyEvent* idle = static_cast<XPresentIdleNotifyEvent*>(xevent.xcookie.data);
+                auto it = m_presentChains.find(idle->window);
+                if (it != m_presentChains.end()) {
+                    for (PresentBuffer& buffer : it->second.buffers) {
+                        if (buffer.pixmap == idle->pixmap) {
+                            buffer.busy = false;
+                        }
+                    }
+                }
+            }
+            XFreeEventData(m_display, &xevent.xcookie);
+        }
+#endif
+        return true;
+    }
+    
+public:
+    void markDirty(X11Window* window) {
+        if (std::find(m_dirtyWindows.begin(), m_dirtyWindows.end(), window) == m_dirtyWindows.end()) {
+            m_dirtyWindows.push_back(window);
+        }
+    }
+    
+    void postClose(X11Window* window) {
+        Event event(EventType::WindowClose);
+        event.window = window;
+        m_eventQueue.push_back(event);
+    }
+    
+private:
+    enum AtomId {
+        NetWmWindowType,
+        NetWmWindowTypeNormal,
+        NetWmWindowTypeDock,
+        NetWmWindowTypePopupMenu,
+        NetWmWindowTypeDesktop,
+        NetWmWindowTypeSplash,
+        NetWmState,
+        NetWmStateAbove,
+        NetWmWindowOpacity,
+        NetWmName,
+        Utf8String,
+        WmProtocols,
+        WmDeleteWindow,
+        MotifWmHints,
+        AtomCount
+    };
+    
+    static constexpr const char* kAtomNames[AtomCount] = {
+        "_NET_WM_WINDOW_TYPE",
+        "_NET_WM_WINDOW_TYPE_NORMAL",
+        "_NET_WM_WINDOW_TYPE_DOCK",
+        "_NET_WM_WINDOW_TYPE_POPUP_MENU",
+        "_NET_WM_WINDOW_TYPE_DESKTOP",
+        "_NET_WM_WINDOW_TYPE_SPLASH",
+        "_NET_WM_STATE",
+        "_NET_WM_STATE_ABOVE",
+        "_NET_WM_WINDOW_OPACITY",
+        "_NET_WM_NAME",
+        "UTF8_STRING",
+        "WM_PROTOCOLS",
+        "WM_DELETE_WINDOW",
+        "_MOTIF_WM_HINTS",
+    };
+    
+    // Called next to every request that waits for a server reply
+    void roundTrip() { ++m_roundTrips; }
+    
+    void setTitleProperty(::Window xwindow, const std::string& title) {
+        XChangeProperty(m_display, xwindow, m_atoms[NetWmName], m_atoms[Utf8String], 8,
+                        PropModeReplace, (const unsigned char*)title.data(), (int)title.size());
+        XStoreName(m_display, xwindow, title.c_str());
+    }
+    
+    void setOpacityProperty(::Window xwindow, f32 opacity) {
+        if (opacity >= 1.0f) {
+            XDeleteProperty(m_display, xwindow, m_atoms[NetWmWindowOpacity]);
+            return;
+        }
+        unsigned long value = (unsigned long)(std::max(opacity, 0.0f) * 0xFFFFFFFFu);
+        XChangeProperty(m_display, xwindow, m_atoms[NetWmWindowOpacity], XA_CARDINAL, 32,
+                        PropModeReplace, (unsigned char*)&value, 1);
+    }
+    
+    void flushWindowChanges() {
+        for (X11Window* window : m_dirtyWindows) {
+            ::Window xwindow = reinterpret_cast<::Window>(window->nativeHandle());
+            X11Window::Pending& pending = window->pending();
+            const Window::Config& config = window->config();
+            
+            if (pending.title) {
+                setTitleProperty(xwindow, config.title);
+            }
+            if (pending.opacity) {
+                setOpacityProperty(xwindow, config.opacity);
+            }
+            if (pending.position && pending.size) {
+                XMoveResizeWindow(m_display, xwindow, config.x, config.y, config.width, config.height);
+            } else if (pending.position) {
+                XMoveWindow(m_display, xwindow, config.x, config.y);
+            } else if (pending.size) {
+                XResizeWindow(m_display, xwindow, config.width, config.height);
+            }
+            if (pending.visibility) {
+                if (window->isVisible()) {
+                    XMapWindow(m_display, xwindow);
+                } else {
+                    XUnmapWindow(m_display, xwindow);
+                }
+            }
+            pending = X11Window::Pending();
+        }
+        m_dirtyWindows.clear();
+    }
+    
+    // Shared by the core and XI2 paths; event has window and timestamp set
+    void pushMotion(Event& event, f32 x, f32 y) {
+        event.type = EventType::MouseMove;
+        event.mouse.x = x;
+        event.mouse.y = y;
+        if (event.window) {
+            event.window->motionHistory().push({event.timestamp, x, y});
+        }
+        m_eventQueue.push_back(event);
+    }
+    
+    void pushButton(Event& event, unsigned int button, bool pressed, bool emulated) {
+        if (button >= 4 && button <= 7) {
+            // Wheel clicks; XI2 also sends them emulated from smooth
+            // scrolling, which is reported through the valuators instead
+            if (!pressed || emulated) {
+                return;
+            }
+            event.type = EventType::MouseScroll;
+            event.scroll.dx = button == 6 ? -1.0f : button == 7 ? 1.0f : 0.0f;
+            event.scroll.dy = button == 4 ? 1.0f : button == 5 ? -1.0f : 0.0f;
+            event.scroll.precise = false;
+            m_eventQueue.push_back(event);
+            return;
+        }
+        
+        event.type = pressed ? EventType::MouseDown : EventType::MouseUp;
+        switch (button) {
+            case 1: event.mouseButton.button = MouseButton::Left; break;
+            case 2: event.mouseButton.button = MouseButton::Middle; break;
+            case 3: event.mouseButton.button = MouseButton::Right; break;
+            case 8: event.mouseButton.button = MouseButton::X1; break;
+            case 9: event.mouseButton.button = MouseButton::X2; break;
+            default: return;
+        }
+        m_eventQueue.push_back(event);
+    }
+    
+    void pushKey(Event& event, unsigned int keycode, unsigned int state, bool pressed) {
+        event.type = pressed ? EventType::KeyDown : EventType::KeyUp;
+        event.key.code = m_keyTable[keycode];
+        event.key.modifiers = x11Modifiers(state);
+        // With detectable auto-repeat a held key sends presses only
+        event.key.repeat = pressed && keycode < m_keysDown.size() && m_keysDown[keycode];
+        if (keycode < m_keysDown.size()) {
+            m_keysDown[keycode] = pressed;
+        }
+        m_eventQueue.push_back(event);
+    }
+    
+#ifdef AURORA_X11_XINPUT2
+    // A scroll axis of a pointer; deltas are in multiples of increment
+    struct ScrollValuator {
+        int deviceid;
+        int number;
+        bool vertical;
+        f64 increment;
+        f64 last = 0.0;
+        bool valid = false;     // last is meaningful
+    };
+    
+    void initializeXInput2() {
+        int event = 0, error = 0;
+        roundTrip();
+        if (!XQueryExtension(m_display, "XInputExtension", &m_xiOpcode, &event, &error)) {
+            m_xiOpcode = 0;
+            return;
+        }
+        // 2.1 adds smooth scrolling
+        int major = 2, minor = 2;
+        roundTrip();
+        if (XIQueryVersion(m_display, &major, &minor) != Success || (major == 2 && minor < 1)) {
+            m_xiOpcode = 0;
+            return;
+        }
+        queryScrollValuators(XIAllMasterDevices);
+    }
+    
+    void selectXInput2(::Window xwindow) {
+        unsigned char bits[XIMaskLen(XI_LASTEVENT)] = {};
+        XISetMask(bits, XI_Motion);
+        XISetMask(bits, XI_ButtonPress);
+        XISetMask(bits, XI_ButtonRelease);
+        XISetMask(bits, XI_KeyPress);
+        XISetMask(bits, XI_KeyRelease);
+        XISetMask(bits, XI_Enter);
+        XISetMask(bits, XI_Leave);
+        XISetMask(bits, XI_FocusIn);
+        XISetMask(bits, XI_FocusOut);
+        XISetMask(bits, XI_DeviceChanged);
+        XIEventMask mask = {XIAllMasterDevices, (int)sizeof(bits), bits};
+        XISelectEvents(m_display, xwindow, &mask, 1);
+    }
+    
+    void queryScrollValuators(int deviceid) {
+        m_scrollValuators.erase(
+            std::remove_if(m_scrollValuators.begin(), m_scrollValuators.end(),
+                           [deviceid](const ScrollValuator& v) {
+                               return deviceid == XIAllMasterDevices || v.deviceid == deviceid;
+                           }),
+            m_scrollValuators.end());
+        
+        int count = 0;
+        XIDeviceInfo* devices = XIQueryDevice(m_display, deviceid, &count);
+        roundTrip();
+        for (int i = 0; i < count; ++i) {
+            for (int c = 0; c < devices[i].num_classes; ++c) {
+                if (devices[i].classes[c]->type != XIScrollClass) {
+                    continue;
+                }
+                const XIScrollClassInfo* scroll = reinterpret_cast<XIScrollClassInfo*>(devices[i].classes[c]);
+                ScrollValuator valuator;
+                valuator.deviceid = devices[i].deviceid;
+                valuator.number = scroll->number;
+                valuator.vertical = scroll->scroll_type == XIScrollTypeVertical;
+                valuator.increment = scroll->increment != 0.0 ? scroll->increment : 1.0;
+                m_scrollValuators.push_back(valuator);
+            }
+        }
+        if (devices) {
+            XIFreeDeviceInfo(devices);
+        }
+    }
+    
+    ScrollValuator* findScrollValuator(int deviceid, int number) {
+        for (ScrollValuator& valuator : m_scrollValuators) {
+            if (valuator.deviceid == deviceid && valuator.number == number) {
+                return &valuator;
+            }
+        }
+        return nullptr;
+    }
+    
+    void handleXInput2(XGenericEventCookie& cookie) {
+        if (cookie.evtype == XI_DeviceChanged) {
+            const XIDeviceChangedEvent* changed = static_cast<XIDeviceChangedEvent*>(cookie.data);
+            queryScrollValuators(changed->deviceid);
+            return;
+        }
+        
+        // Enter, leave and focus events share the device event's layout up
+        // to the coordinates
+        const XIDeviceEvent* xi = static_cast<XIDeviceEvent*>(cookie.data);
+        Event event;
+        auto it = m_windows.find(xi->event);
+        if (it != m_windows.end()) {
+            event.window = it->second;
+        }
+        event.timestamp = m_clock.toSeconds(xi->time);
+        
+        switch (cookie.evtype) {
+            case XI_Motion: {
+                // Scroll axes report absolute positions; send the change
+                f64 dx = 0.0, dy = 0.0;
+                bool scrolled = false;
+                const f64* value = xi->valuators.values;
+                for (int bit = 0; bit < xi->valuators.mask_len * 8; ++bit) {
+                    if (!XIMaskIsSet(xi->valuators.mask, bit)) {
+                        continue;
+                    }
+                    const f64 current = *value++;
+                    ScrollValuator* valuator = findScrollValuator(xi->deviceid, bit);
+                    if (!valuator) {
+                        continue;
+                    }
+                    if (valuator->valid) {
+                        const f64 delta = (current - valuator->last) / valuator->increment;
+                        // Valuators grow downwards and rightwards
+                        (valuator->vertical ? dy : dx) += valuator->vertical ? -delta : delta;
+                        scrolled = true;
+                    }
+                    valuator->last = current;
+                    valuator->valid = true;
+                }
+                
+                if (scrolled && (dx != 0.0 || dy != 0.0)) {
+                    Event scroll = event;
+                    scroll.type = EventType::MouseScroll;
+                    scroll.scroll.dx = (f32)dx;
+                    scroll.scroll.dy = (f32)dy;
+                    scroll.scroll.precise = true;
+                    m_eventQueue.push_back(scroll);
+                }
+                if (xi->event_x != m_lastPointer.x || xi->event_y != m_lastPointer.y) {
+                    m_lastPointer = {(f32)xi->event_x, (f32)xi->event_y};
+                    pushMotion(event, (f32)xi->event_x, (f32)xi->event_y);
+                }
+                break;
+            }
+                
+            case XI_ButtonPress:
+            case XI_ButtonRelease:
+                pushButton(event, (unsigned int)xi->detail, cookie.evtype == XI_ButtonPress,
+                           (xi->flags & XIPointerEmulated) != 0);
+                break;
+                
+            case XI_KeyPress:
+            case XI_KeyRelease:
+                pushKey(event, (unsigned int)xi->detail, (unsigned int)xi->mods.effective,
+                        cookie.evtype == XI_KeyPress);
+                break;
+                
+            case XI_Enter:
+            case XI_Leave: {
+                // Axes may have moved while the pointer was elsewhere
+                for (ScrollValuator& valuator : m_scrollValuators) {
+                    valuator.valid = false;
+                }
+                const XIEnterEvent* crossing = static_cast<XIEnterEvent*>(cookie.data);
+                event.type = cookie.evtype == XI_Enter ? EventType::MouseEnter : EventType::MouseLeave;
+                event.mouse.x = (f32)crossing->event_x;
+                event.mouse.y = (f32)crossing->event_y;
+                m_lastPointer = {event.mouse.x, event.mouse.y};
+                m_eventQueue.push_back(event);
+                break;
+            }
+                
+            case XI_FocusIn:
+            case XI_FocusOut:
+                event.type = cookie.evtype == XI_FocusIn ? EventType::WindowFocus : EventType::WindowBlur;
+                m_keysDown.reset();
+                m_eventQueue.push_back(event);
+                break;
+        }
+    }
+#endif
+    
     Display* m_display;
     int m_screen;
     ::Window m_rootWindow;
-    XVisualInfo* m_visualInfo;
+    std::vector<Unique<X11SurfaceFormat>> m_formats;
+    const X11SurfaceFormat* m_defaultFormat = nullptr;
+    GLXContext m_shareContext = nullptr;
+    GLXPbuffer m_sharePbuffer = 0;
+    std::unordered_map<GLXContext, u64> m_contextSerials;
+    PFNGLXGETSYNCVALUESOMLPROC m_getSyncValues = nullptr;
+    PFNGLXGETMSCRATEOMLPROC m_getMscRate = nullptr;
+    PFNGLXSWAPBUFFERSMSCOMLPROC m_swapBuffersMsc = nullptr;
+    PFNGLXSWAPINTERVALEXTPROC m_swapIntervalEXT = nullptr;
+    PFNGLXSWAPINTERVALMESAPROC m_swapIntervalMESA = nullptr;
+    
+    struct Output {
+        Rect bounds = {0, 0, 0, 0};
+        f64 refreshRate = 60.0;
+    };
+    std::vector<Output> m_outputs;
+#ifdef AURORA_X11_XRANDR
+    int m_randrEventBase = -1;  // -1 without RandR
+#endif
+    Atom m_atoms[AtomCount] = {};
+    std::vector<X11Window*> m_dirtyWindows;
+    u64 m_roundTrips = 0;
     std::unordered_map<::Window, Window*> m_windows;
+    std::unordered_map<::Window, PresentChain> m_presentChains;
+    X11KeyTable m_keyTable;
+    X11Clock m_clock;
+    std::bitset<256> m_keysDown;
+#ifdef AURORA_X11_XINPUT2
+    int m_xiOpcode = 0;         // 0 without XInput 2.1
+    std::vector<ScrollValuator> m_scrollValuators;
+    Vec2 m_lastPointer = {-1.0f, -1.0f};
+#endif
+    bool m_hasShm = false;
+    int m_shmEventBase = 0;
+    int m_presentOpcode = 0;    // 0 without the Present extension
     std::vector<Event> m_eventQueue;
+    int m_wakePipe[2] = {-1, -1};
 };
 
+void X11Window::changed() {
+    if (m_platform && m_pending.any()) {
+        m_platform->markDirty(this);
+    }
+}
+
+void X11Window::show() {
+    m_visible = true;
+    m_pending.visibility = true;
+    changed();
+}
+
+void X11Window::hide() {
+    m_visible = false;
+    m_pending.visibility = true;
+    changed();
+}
+
+void X11Window::close() {
+    // Same path as the window manager's close button
+    if (m_platform) {
+        m_platform->postClose(this);
+    }
+}
+
+void X11Window::setTitle(const std::string& title) {
+    m_config.title = title;
+    m_pending.title = true;
+    changed();
+}
+
+void X11Window::setPosition(i32 x, i32 y) {
+    m_config.x = x;
+    m_config.y = y;
+    m_pending.position = true;
+    changed();
+}
+
+void X11Window::setSize(u32 width, u32 height) {
+    m_config.width = width;
+    m_config.height = height;
+    m_pending.size = true;
+    changed();
+}
+
+void X11Window::setOpacity(f32 opacity) {
+    m_config.opacity = opacity;
+    m_pending.opacity = true;
+    changed();
+}
+
+Unique<IPlatform> createX11Platform() {
+    return std::make_unique<X11Platform>();
+}
+
 } // namespace Aurora
 
 #endif // AURORA_PLATFORM_X11
\ No newline at end of file
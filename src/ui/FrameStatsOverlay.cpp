@@ -0,0 +1,35 @@
+// ============================================
+// src/ui/FrameStatsOverlay.cpp
+// ============================================
+#include "aurora/ui/FrameStatsOverlay.hpp"
+#include "aurora/graphics/Renderer.hpp"
+#include <algorithm>
+
+namespace Aurora {
+
+FrameStatsOverlay::FrameStatsOverlay(const FrameStats& stats) : m_stats(stats) {}
+
+void FrameStatsOverlay::onPaint(Renderer& renderer) {
+    const Rect& area = geometry();
+    Vec2 origin = mapToWindow({0, 0});
+    renderer.drawQuad({origin.x, origin.y, area.width, area.height}, {0.0f, 0.0f, 0.0f, 0.6f});
+
+    const f64 budget = m_stats.refreshRate() > 0.0 ? 1.0 / m_stats.refreshRate() : 1.0 / 60.0;
+    const f32 scale = area.height / (f32)(2.0 * budget);
+
+    const u32 bars = std::min(m_stats.size(), (u32)(area.width / m_barWidth));
+    for (u32 age = 0; age < bars; ++age) {
+        const f64 time = m_stats.frameTime(age);
+        const f32 height = std::min((f32)time * scale, area.height);
+        const Color color = time <= budget * 1.05 ? Color{0.2f, 0.9f, 0.3f, 0.9f}
+                          : time <= budget * 2.0  ? Color{1.0f, 0.8f, 0.1f, 0.9f}
+                                                  : Color{1.0f, 0.2f, 0.2f, 0.9f};
+        const f32 x = origin.x + area.width - (age + 1) * m_barWidth;
+        renderer.drawQuad({x, origin.y + area.height - height, m_barWidth - 0.5f, height}, color);
+    }
+
+    // Budget line
+    renderer.drawQuad({origin.x, origin.y + area.height * 0.5f, area.width, 1.0f}, {1.0f, 1.0f, 1.0f, 0.5f});
+}
+
+} // namespace Aurora
@@ -0,0 +1,273 @@
+// ============================================
+// src/ui/ScrollArea.cpp
+// ============================================
+#include "aurora/ui/ScrollArea.hpp"
+#include "aurora/graphics/Renderer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace Aurora {
+
+namespace {
+
+// Column-major 4x4 multiply (out = a * b)
+void multiplyMatrix(f32* out, const f32* a, const f32* b) {
+    f32 r[16];
+    for (int col = 0; col < 4; ++col) {
+        for (int row = 0; row < 4; ++row) {
+            f32 sum = 0;
+            for (int k = 0; k < 4; ++k) {
+                sum += a[k * 4 + row] * b[col * 4 + k];
+            }
+            r[col * 4 + row] = sum;
+        }
+    }
+    std::memcpy(out, r, sizeof(r));
+}
+
+bool intersects(const Rect& a, const Rect& b) {
+    return a.x < b.x + b.width && b.x < a.x + a.width &&
+           a.y < b.y + b.height && b.y < a.y + a.height;
+}
+
+} // namespace
+
+ScrollArea::ScrollArea() = default;
+
+ScrollArea::~ScrollArea() {
+    if (m_content) {
+        m_content->setParent(nullptr);
+    }
+}
+
+void ScrollArea::setContent(Handle<Widget> content) {
+    if (m_content) {
+        m_content->setParent(nullptr);
+    }
+    m_content = std::move(content);
+    if (m_content) {
+        m_content->setParent(this);
+    }
+    invalidateTiles();
+    setScrollOffset(m_scrollOffset);
+    update();
+}
+
+Vec2 ScrollArea::maxScrollOffset() const {
+    if (!m_content) {
+        return {};
+    }
+    Vec2 content = m_content->size();
+    return {std::max(0.0f, content.x - geometry().width),
+            std::max(0.0f, content.y - geometry().height)};
+}
+
+void ScrollArea::setScrollOffset(const Vec2& offset) {
+    Vec2 max = maxScrollOffset();
+    Vec2 clamped(std::clamp(offset.x, 0.0f, max.x),
+                 std::clamp(offset.y, 0.0f, max.y));
+    if (clamped.x == m_scrollOffset.x && clamped.y == m_scrollOffset.y) {
+        return;
+    }
+    m_scrollOffset = clamped;
+    update();
+}
+
+void ScrollArea::setTileSize(u32 size) {
+    size = std::max(16u, size);
+    if (size == m_tileSize) {
+        return;
+    }
+    m_tileSize = size;
+    m_tiles.clear();
+    m_freeTargets.clear();
+    update();
+}
+
+void ScrollArea::setTileCachingEnabled(bool enabled) {
+    if (enabled == m_cachingEnabled) {
+        return;
+    }
+    m_cachingEnabled = enabled;
+    if (!enabled) {
+        m_tiles.clear();
+        m_freeTargets.clear();
+    }
+    update();
+}
+
+void ScrollArea::invalidateTiles() {
+    for (auto& [key, tile] : m_tiles) {
+        tile.valid = false;
+    }
+}
+
+void ScrollArea::childUpdated(Widget& child, const Rect& rect) {
+    if (&child == m_content.get()) {
+        for (auto& [key, tile] : m_tiles) {
+            i32 tx = (i32)(key >> 32);
+            i32 ty = (i32)(u32)key;
+            Rect bounds{(f32)tx * m_tileSize, (f32)ty * m_tileSize,
+                        (f32)m_tileSize, (f32)m_tileSize};
+            if (intersects(bounds, rect)) {
+                tile.valid = false;
+            }
+        }
+    }
+    update();
+}
+
+ScrollArea::TileRange ScrollArea::visibleTiles(const Vec2& offset) const {
+    f32 ts = (f32)m_tileSize;
+    Vec2 content = m_content->size();
+    f32 right = std::min(offset.x + geometry().width, content.x);
+    f32 bottom = std::min(offset.y + geometry().height, content.y);
+
+    TileRange range;
+    range.x0 = (i32)std::floor(offset.x / ts);
+    range.y0 = (i32)std::floor(offset.y / ts);
+    range.x1 = right > offset.x ? (i32)std::ceil(right / ts) - 1 : range.x0 - 1;
+    range.y1 = bottom > offset.y ? (i32)std::ceil(bottom / ts) - 1 : range.y0 - 1;
+    return range;
+}
+
+void ScrollArea::onPaint(Renderer& renderer) {
+    m_stats = {};
+    if (!m_content) {
+        return;
+    }
+
+    // Snap to whole pixels so cached tiles are sampled 1:1
+    Vec2 offset(std::floor(m_scrollOffset.x + 0.5f),
+                std::floor(m_scrollOffset.y + 0.5f));
+
+    Vec2 origin = mapToWindow({0, 0});
+    renderer.pushState();
+    renderer.setScissor((i32)origin.x, (i32)origin.y,
+                        (u32)geometry().width, (u32)geometry().height);
+
+    if (!m_cachingEnabled) {
+        paintDirect(renderer, offset);
+        renderer.popState();
+        return;
+    }
+
+    TileRange range = visibleTiles(offset);
+
+    // Rasterize missing tiles first so the window transform is restored once
+    bool rasterized = false;
+    f32 projection[16], view[16];
+    std::memcpy(projection, renderer.projectionMatrix(), sizeof(projection));
+    std::memcpy(view, renderer.viewMatrix(), sizeof(view));
+    RenderTarget* previousTarget = renderer.renderTarget();
+
+    for (i32 ty = range.y0; ty <= range.y1; ++ty) {
+        for (i32 tx = range.x0; tx <= range.x1; ++tx) {
+            Tile& tile = m_tiles[tileKey(tx, ty)];
+            if (!tile.valid) {
+                if (!rasterized) {
+                    renderer.disableScissor();
+                    rasterized = true;
+                }
+                rasterizeTile(renderer, tx, ty, tile);
+                ++m_stats.rasterized;
+            } else {
+                ++m_stats.reused;
+            }
+        }
+    }
+
+    if (rasterized) {
+        renderer.setRenderTarget(previousTarget);
+        renderer.setProjectionMatrix(projection);
+        renderer.setViewMatrix(view);
+        renderer.setScissor((i32)origin.x, (i32)origin.y,
+                            (u32)geometry().width, (u32)geometry().height);
+    }
+
+    for (i32 ty = range.y0; ty <= range.y1; ++ty) {
+        for (i32 tx = range.x0; tx <= range.x1; ++tx) {
+            compositeTile(renderer, tx, ty, m_tiles[tileKey(tx, ty)], offset);
+        }
+    }
+
+    i32 margin = (i32)m_cacheMargin;
+    evictTiles({range.x0 - margin, range.y0 - margin,
+                range.x1 + margin, range.y1 + margin});
+    m_stats.resident = (u32)m_tiles.size();
+
+    renderer.popState();
+}
+
+void ScrollArea::rasterizeTile(Renderer& renderer, i32 tx, i32 ty, Tile& tile) {
+    if (!tile.target) {
+        tile.target = acquireTarget();
+    }
+    renderer.setRenderTarget(tile.target.get());
+
+    // Bottom/top swapped: framebuffer rows are stored bottom-up, so this
+    // leaves the tile texture upright when composited with regular UVs
+    f32 x0 = (f32)tx * m_tileSize;
+    f32 y0 = (f32)ty * m_tileSize;
+    f32 projection[16], identity[16];
+    Renderer::orthoMatrix(projection, x0, x0 + m_tileSize, y0, y0 + m_tileSize);
+    Renderer::translateMatrix(identity, 0, 0);
+    renderer.setProjectionMatrix(projection);
+    renderer.setViewMatrix(identity);
+
+    renderer.clear({0, 0, 0, 0});
+    m_content->paint(renderer);
+    tile.valid = true;
+}
+
+void ScrollArea::compositeTile(Renderer& renderer, i32 tx, i32 ty,
+                               const Tile& tile, const Vec2& offset) {
+    Rect dest{(f32)tx * m_tileSize - offset.x, (f32)ty * m_tileSize - offset.y,
+              (f32)m_tileSize, (f32)m_tileSize};
+    Material material;
+    material.size = {dest.width, dest.height};
+    material.texture = tile.target->texture();
+    renderer.drawQuad(dest, material);
+}
+
+void ScrollArea::evictTiles(const TileRange& keep) {
+    // Keep roughly one viewport worth of spare targets for incoming tiles
+    size_t spareLimit = (size_t)(keep.x1 - keep.x0 + 1) * (size_t)(keep.y1 - keep.y0 + 1);
+
+    for (auto it = m_tiles.begin(); it != m_tiles.end();) {
+        i32 tx = (i32)(it->first >> 32);
+        i32 ty = (i32)(u32)it->first;
+        if (keep.contains(tx, ty)) {
+            ++it;
+            continue;
+        }
+        if (it->second.target && m_freeTargets.size() < spareLimit) {
+            m_freeTargets.push_back(std::move(it->second.target));
+        }
+        it = m_tiles.erase(it);
+        ++m_stats.evicted;
+    }
+}
+
+Ref<RenderTarget> ScrollArea::acquireTarget() {
+    if (!m_freeTargets.empty()) {
+        Ref<RenderTarget> target = std::move(m_freeTargets.back());
+        m_freeTargets.pop_back();
+        return target;
+    }
+    return std::make_shared<RenderTarget>(m_tileSize, m_tileSize);
+}
+
+void ScrollArea::paintDirect(Renderer& renderer, const Vec2& offset) {
+    f32 view[16], translate[16], scrolled[16];
+    std::memcpy(view, renderer.viewMatrix(), sizeof(view));
+    Renderer::translateMatrix(translate, -offset.x, -offset.y);
+    multiplyMatrix(scrolled, view, translate);
+
+    renderer.setViewMatrix(scrolled);
+    m_content->paint(renderer);
+    renderer.setViewMatrix(view);
+}
+
+} // namespace Aurora
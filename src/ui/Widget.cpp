@@ -0,0 +1,90 @@
+// ============================================
+// src/ui/Widget.cpp
+// ============================================
+#include "aurora/ui/Widget.hpp"
+
+namespace Aurora {
+
+Widget::Widget() = default;
+
+Widget::~Widget() = default;
+
+void Widget::setGeometry(const Rect& rect) {
+    Rect old = m_geometry;
+    m_geometry = rect;
+    if (old.width != rect.width || old.height != rect.height) {
+        requestLayout();
+    }
+    onGeometryChanged(old);
+}
+
+Vec2 Widget::mapToWindow(const Vec2& local) const {
+    Vec2 pos = local;
+    for (const Widget* w = this; w; w = w->parentWidget()) {
+        pos = pos + Vec2(w->m_geometry.x, w->m_geometry.y);
+    }
+    return pos;
+}
+
+Widget* Widget::parentWidget() const {
+    return dynamic_cast<Widget*>(parent());
+}
+
+void Widget::setVisible(bool visible) {
+    if (m_visible == visible) {
+        return;
+    }
+    m_visible = visible;
+    if (Widget* p = parentWidget()) {
+        p->childUpdated(*this, {0, 0, m_geometry.width, m_geometry.height});
+    }
+}
+
+void Widget::update() {
+    update({0, 0, m_geometry.width, m_geometry.height});
+}
+
+void Widget::update(const Rect& rect) {
+    m_dirty = true;
+    if (Widget* p = parentWidget()) {
+        p->childUpdated(*this, rect);
+    }
+}
+
+void Widget::requestLayout() {
+    m_needsLayout = true;
+    update();
+}
+
+void Widget::invalidateOn(const PropertyBase& property, Invalidation kind) {
+    // One watcher per kind, however many properties the widget depends on
+    Unique<PropertyWatcher>& watcher =
+        kind == Invalidation::Layout ? m_layoutWatcher : m_repaintWatcher;
+    if (!watcher) {
+        if (kind == Invalidation::Layout) {
+            watcher = std::make_unique<PropertyWatcher>([this] { requestLayout(); });
+        } else {
+            watcher = std::make_unique<PropertyWatcher>([this] { update(); });
+        }
+    }
+    watcher->watch(property);
+}
+
+void Widget::paint(Renderer& renderer) {
+    if (!m_visible) {
+        return;
+    }
+    if (m_needsLayout) {
+        onLayout();
+        m_needsLayout = false;
+    }
+    onPaint(renderer);
+    m_dirty = false;
+}
+
+void Widget::childUpdated(Widget& child, const Rect& rect) {
+    const Rect& g = child.geometry();
+    update({g.x + rect.x, g.y + rect.y, rect.width, rect.height});
+}
+
+} // namespace Aurora
@@ -0,0 +1,17 @@
+// ============================================
+// src/utils/ResourceManager.cpp
+// ============================================
+#include "aurora/utils/ResourceManager.hpp"
+
+namespace Aurora {
+
+ResourceManager& ResourceManager::instance() {
+    static ResourceManager manager;
+    return manager;
+}
+
+void ResourceManager::clear() {
+    m_resources.clear();
+}
+
+} // namespace Aurora
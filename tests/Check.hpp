@@ -0,0 +1,57 @@
+// ============================================
+// tests/Check.hpp
+// ============================================
+// Minimal assertions for the unit tests: each test binary is a plain
+// main() that runs its cases through runTests() and exits non-zero on the
+// first failing case, so ctest needs no framework.
+#pragma once
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <vector>
+
+namespace Aurora {
+namespace Test {
+
+struct Case {
+    const char* name;
+    void (*run)();
+};
+
+inline int& failures() {
+    static int count = 0;
+    return count;
+}
+
+inline void fail(const char* file, int line, const char* expression) {
+    std::fprintf(stderr, "%s:%d: check failed: %s\n", file, line, expression);
+    ++failures();
+}
+
+// Runs every case, reporting each; returns the process exit code
+inline int runTests(const std::vector<Case>& cases) {
+    int failed = 0;
+    for (const Case& test : cases) {
+        const int before = failures();
+        test.run();
+        const bool ok = failures() == before;
+        std::fprintf(stderr, "[%s] %s\n", ok ? "  OK  " : " FAIL ", test.name);
+        failed += !ok;
+    }
+    std::fprintf(stderr, "%zu cases, %d failed\n", cases.size(), failed);
+    return failed ? 1 : 0;
+}
+
+} // namespace Test
+} // namespace Aurora
+
+#define CHECK(condition) \
+    do { if (!(condition)) ::Aurora::Test::fail(__FILE__, __LINE__, #condition); } while (0)
+
+#define CHECK_EQ(a, b) CHECK((a) == (b))
+
+#define CHECK_NEAR(a, b, tolerance) CHECK(std::fabs((double)(a) - (double)(b)) <= (double)(tolerance))
+
+// Stops the current case (use where continuing would crash)
+#define REQUIRE(condition) \
+    do { if (!(condition)) { ::Aurora::Test::fail(__FILE__, __LINE__, #condition); return; } } while (0)
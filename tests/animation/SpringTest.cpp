@@ -0,0 +1,106 @@
+// ============================================
+// tests/animation/SpringTest.cpp
+// ============================================
+#include "Check.hpp"
+#include <aurora/animation/Spring.hpp>
+#include <cmath>
+#include <vector>
+
+using namespace Aurora;
+
+namespace {
+
+constexpr f32 kHitch = 0.25f;
+
+Spring::Config stiffConfig() {
+    Spring::Config config;
+    config.stiffness = 5000.0f;     // Explicit Euler diverges at this k for dt = 250 ms
+    config.damping = 20.0f;
+    return config;
+}
+
+void hitchMatchesSmallSteps() {
+    for (f32 damping : {5.0f, 20.0f, 60.0f}) {    // Under-, critically and over-damped
+        Spring::Config config;
+        config.damping = damping;
+        Spring hitched(config), stepped(config);
+        hitched.reset(100.0f, 3.0f);
+        stepped.reset(100.0f, 3.0f);
+
+        hitched.update(kHitch);
+        for (int i = 0; i < 250; ++i) {
+            stepped.update(0.001f);
+        }
+        CHECK_NEAR(hitched.position(), stepped.position(), 1e-2f);
+        CHECK_NEAR(hitched.velocity(), stepped.velocity(), 1e-1f);
+    }
+}
+
+void stiffSpringLosesEnergyThroughHitches() {
+    // A damped spring can only lose energy, however long the step
+    const Spring::Config config = stiffConfig();
+    auto energy = [&](const Spring& spring) {
+        const f32 offset = spring.position() - spring.target();
+        return 0.5f * config.stiffness * offset * offset +
+               0.5f * config.mass * spring.velocity() * spring.velocity();
+    };
+
+    Spring spring(config);
+    spring.reset(100.0f);
+    f32 previous = energy(spring);
+    for (int i = 0; i < 40; ++i) {
+        spring.update(kHitch);
+        REQUIRE(std::isfinite(spring.position()));
+        const f32 current = energy(spring);
+        CHECK(current <= previous * 1.0001f + 1e-6f);
+        previous = current;
+    }
+    CHECK(spring.isAtRest());
+}
+
+void hitchesSettleAndRetire() {
+    SpringSystem system;
+    std::vector<f32> outputs(1000);
+    for (u32 i = 0; i < outputs.size(); ++i) {
+        Spring::Config config = i % 2 ? stiffConfig() : Spring::Config();
+        system.add(config, (f32)i, 0.0f, &outputs[i]);
+    }
+    CHECK_EQ(system.movingCount(), 999u);    // Spring 0 starts at its target
+
+    for (int i = 0; i < 40 && system.movingCount() > 0; ++i) {
+        system.update(kHitch);
+        for (f32 output : outputs) {
+            REQUIRE(std::isfinite(output));
+        }
+    }
+    CHECK_EQ(system.movingCount(), 0u);
+    for (f32 output : outputs) {
+        CHECK_NEAR(output, 0.0f, 1e-2f);
+    }
+}
+
+void clearInvalidatesIds() {
+    SpringSystem system;
+    const SpringId before = system.add(Spring::Config(), 0.0f, 10.0f);
+    system.clear();
+    CHECK(!system.contains(before));
+
+    // The freed slot is reused under a new generation
+    const SpringId after = system.add(Spring::Config(), 5.0f, 5.0f);
+    CHECK(before != after);
+    CHECK(!system.contains(before));
+    CHECK(system.contains(after));
+    system.setTarget(before, 100.0f);
+    CHECK_EQ(system.target(after), 5.0f);
+}
+
+} // namespace
+
+int main() {
+    return Test::runTests({
+        {"Spring.HitchMatchesSmallSteps", hitchMatchesSmallSteps},
+        {"Spring.StiffSpringLosesEnergyThroughHitches", stiffSpringLosesEnergyThroughHitches},
+        {"SpringSystem.HitchesSettleAndRetire", hitchesSettleAndRetire},
+        {"SpringSystem.ClearInvalidatesIds", clearInvalidatesIds},
+    });
+}
@@ -0,0 +1,120 @@
+// ============================================
+// tests/animation/TimelineTest.cpp
+// ============================================
+#include "Check.hpp"
+#include <aurora/animation/Keyframe.hpp>
+#include <aurora/animation/Timeline.hpp>
+
+using namespace Aurora;
+
+namespace {
+
+KeyframeTrack<f32> rampTrack() {
+    KeyframeTrack<f32> track;
+    for (u32 i = 0; i <= 100; ++i) {
+        track.add((f32)i * 0.01f, (f32)(i % 7), i % 2 ? EasingCurve(Easing::Type::CubicInOut)
+                                                       : EasingCurve());
+    }
+    track.compile();
+    return track;
+}
+
+// Timeline seeks its children every update; the sampled values must match
+// a plain binary search however the playhead moves
+void keyframesFollowThePlayhead() {
+    const KeyframeTrack<f32> reference = rampTrack();
+    f32 value = -1.0f;
+    Timeline timeline;
+    timeline.add(makeHandle<KeyframeAnimation<f32>>(&value, rampTrack()), 0.5f);
+    timeline.play();
+
+    for (int frame = 0; frame < 100; ++frame) {
+        timeline.update(1.0f / 60.0f);
+        if (timeline.currentTime() >= 0.5f) {
+            CHECK_NEAR(value, reference.sampleAt(timeline.currentTime() - 0.5f), 1e-4f);
+        }
+    }
+
+    for (f32 time : {0.9f, 0.55f, 1.45f, 0.6f, 1.5f}) {
+        timeline.seek(time);
+        CHECK_NEAR(value, reference.sampleAt(time - 0.5f), 1e-4f);
+    }
+}
+
+struct Calls {
+    int started = 0;
+    int completed = 0;
+};
+
+Handle<Animation> counted(f32* target, f32 duration, Calls& calls) {
+    auto animation = makeHandle<PropertyAnimation<f32>>(target, 0.0f, 1.0f, duration);
+    animation->onStart = [&calls] { ++calls.started; };
+    animation->onComplete = [&calls] { ++calls.completed; };
+    return animation;
+}
+
+void childCallbacksFollowThePlayhead() {
+    f32 a = 0.0f, b = 0.0f, c = 0.0f;
+    Calls first, second, skipped;
+    Timeline timeline;
+    timeline.add(counted(&a, 0.5f, first), 0.0f);
+    timeline.add(counted(&b, 0.5f, second), 0.5f);
+    timeline.add(counted(&c, 0.1f, skipped), 0.7f);
+    timeline.play();
+
+    timeline.update(0.1f);
+    CHECK_EQ(first.started, 1);
+    CHECK_EQ(first.completed, 0);
+    CHECK_EQ(second.started, 0);
+
+    timeline.update(0.5f);
+    CHECK_EQ(first.completed, 1);
+    CHECK_EQ(second.started, 1);
+
+    // Passed over in one step: both fire, in order
+    timeline.update(0.3f);
+    CHECK_EQ(skipped.started, 1);
+    CHECK_EQ(skipped.completed, 1);
+    CHECK_EQ(c, 1.0f);
+
+    // Finishing the timeline completes the rest once
+    timeline.update(1.0f);
+    timeline.update(1.0f);
+    CHECK_EQ(first.started, 1);
+    CHECK_EQ(first.completed, 1);
+    CHECK_EQ(second.completed, 1);
+    CHECK(!timeline.isPlaying());
+}
+
+void seekingBackRearmsCallbacks() {
+    f32 value = 0.0f;
+    Calls calls;
+    Timeline timeline;
+    timeline.add(counted(&value, 1.0f, calls), 0.5f);
+
+    timeline.seek(2.0f);
+    CHECK_EQ(calls.started, 1);
+    CHECK_EQ(calls.completed, 1);
+
+    // Back inside: only completion rearms
+    timeline.seek(1.0f);
+    timeline.seek(1.5f);
+    CHECK_EQ(calls.started, 1);
+    CHECK_EQ(calls.completed, 2);
+
+    timeline.stop();
+    CHECK_EQ(calls.started, 1);
+    timeline.seek(0.75f);
+    CHECK_EQ(calls.started, 2);
+    CHECK_EQ(calls.completed, 2);
+}
+
+} // namespace
+
+int main() {
+    return Test::runTests({
+        {"Timeline.KeyframesFollowThePlayhead", keyframesFollowThePlayhead},
+        {"Timeline.ChildCallbacksFollowThePlayhead", childCallbacksFollowThePlayhead},
+        {"Timeline.SeekingBackRearmsCallbacks", seekingBackRearmsCallbacks},
+    });
+}
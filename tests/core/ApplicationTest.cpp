@@ -0,0 +1,65 @@
+// ============================================
+// tests/core/ApplicationTest.cpp
+// ============================================
+#include "Check.hpp"
+#include <aurora/core/Application.hpp>
+#include <aurora/platform/IPlatform.hpp>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+
+using namespace Aurora;
+
+namespace {
+
+void unknownBackendThrows() {
+    setenv("AURORA_PLATFORM", "no-such-backend", 1);
+    std::string message;
+    try {
+        Application app(0, nullptr);
+    } catch (const std::runtime_error& error) {
+        message = error.what();
+    }
+    unsetenv("AURORA_PLATFORM");
+
+    CHECK(!message.empty());
+    CHECK(Application::instance() == nullptr);
+    CHECK(message.find("AURORA_PLATFORM=no-such-backend") != std::string::npos);
+}
+
+// The loop sleeps until each refresh of a continuous window; those
+// sleeps belong to its frames and must not reset the frame clock
+void continuousWindowRecordsFrames() {
+    setenv("AURORA_PLATFORM", "headless", 1);
+    Application app(0, nullptr);
+    unsetenv("AURORA_PLATFORM");
+
+    Window::Config config;
+    config.width = 64;
+    config.height = 64;
+    Handle<Window> window = app.platform()->createWindow(config);
+    REQUIRE(window);
+
+    u32 draws = 0;
+    app.scheduler().addWindow(window.get(), nullptr, [&](f64) {
+        if (++draws == 10) {
+            app.quit();
+        }
+    });
+    app.scheduler().setContinuous(window.get(), true);
+    app.run();
+
+    CHECK_EQ(draws, 10u);
+    CHECK(app.frameStats().frameCount() >= 9);
+    app.scheduler().removeWindow(window.get());
+    app.platform()->destroyWindow(window.get());
+}
+
+} // namespace
+
+int main() {
+    return Test::runTests({
+        {"Application.UnknownBackendThrows", unknownBackendThrows},
+        {"Application.ContinuousWindowRecordsFrames", continuousWindowRecordsFrames},
+    });
+}
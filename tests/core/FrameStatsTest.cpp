@@ -0,0 +1,153 @@
+// ============================================
+// tests/core/FrameStatsTest.cpp
+// ============================================
+// FrameStats on a synthetic nanosecond clock.
+#include "Check.hpp"
+#include <aurora/core/FrameStats.hpp>
+
+using namespace Aurora;
+
+namespace {
+
+constexpr u64 kMs = 1000000;
+
+void percentilesUseNearestRank() {
+    FrameStats stats(100);
+    // 1..100 ms, out of order
+    for (u32 i = 0; i < 100; ++i) {
+        stats.addFrame((f64)((i * 37) % 100 + 1) * 1e-3);
+    }
+    const FrameStats::Summary summary = stats.summary();
+    CHECK_EQ(summary.frames, 100ull);
+    CHECK_NEAR(summary.mean, 50.5e-3, 1e-6);
+    CHECK_NEAR(summary.p50, 50e-3, 1e-6);
+    CHECK_NEAR(summary.p95, 95e-3, 1e-6);
+    CHECK_NEAR(summary.p99, 99e-3, 1e-6);
+    CHECK_NEAR(summary.worst, 100e-3, 1e-6);
+
+    // Ten frames: rank ceil(0.95 * 10) is the slowest one
+    FrameStats few(10);
+    for (u32 i = 1; i <= 10; ++i) {
+        few.addFrame((f64)i * 1e-3);
+    }
+    CHECK_NEAR(few.summary().p95, 10e-3, 1e-6);
+    CHECK_NEAR(few.summary().p50, 5e-3, 1e-6);
+}
+
+void windowKeepsTheNewestFrames() {
+    FrameStats stats(4);
+    for (u32 i = 1; i <= 6; ++i) {
+        stats.addFrame((f64)i * 1e-3);
+    }
+    CHECK_EQ(stats.size(), 4u);
+    CHECK_EQ(stats.frameCount(), 6ull);
+    CHECK_NEAR(stats.frameTime(0), 6e-3, 1e-6);
+    CHECK_NEAR(stats.frameTime(3), 3e-3, 1e-6);
+    CHECK_EQ(stats.frameTime(4), 0.0);
+    CHECK_NEAR(stats.summary().worst, 6e-3, 1e-6);
+
+    // Zero and NaN are dropped
+    stats.addFrame(0.0);
+    stats.addFrame(std::nan(""));
+    CHECK_EQ(stats.frameCount(), 6ull);
+}
+
+void missedVsyncRoundsToIntervals() {
+    FrameStats stats;
+    stats.setRefreshRate(60.0);
+    const f64 interval = 1.0 / 60.0;
+    stats.addFrame(interval);
+    stats.addFrame(1.4 * interval);     // Still makes the next vblank
+    CHECK_EQ(stats.missedVsync(), 0ull);
+    stats.addFrame(1.6 * interval);
+    CHECK_EQ(stats.missedVsync(), 1ull);
+    stats.addFrame(3.2 * interval);
+    CHECK_EQ(stats.missedVsync(), 3ull);
+
+    stats.setRefreshRate(0.0);
+    stats.addFrame(10.0 * interval);
+    CHECK_EQ(stats.missedVsync(), 3ull);
+}
+
+void nestedPhasesAreExclusive() {
+    FrameStats stats;
+    stats.beginFrame(1 * kMs);
+    stats.beginPhase(FrameStats::Phase::Update, 1 * kMs);
+    stats.beginPhase(FrameStats::Phase::Render, 3 * kMs);  // Pauses Update
+    stats.endPhase(6 * kMs);
+    stats.endPhase(7 * kMs);
+    stats.beginPhase(FrameStats::Phase::Swap, 8 * kMs);
+    stats.beginFrame(11 * kMs);                             // Closes Swap's share
+
+    FrameStats::Summary summary = stats.summary();
+    CHECK_EQ(summary.frames, 1ull);
+    CHECK_NEAR(summary.mean, 10e-3, 1e-6);
+    CHECK_NEAR(summary.phases[(u32)FrameStats::Phase::Update], 3e-3, 1e-6);
+    CHECK_NEAR(summary.phases[(u32)FrameStats::Phase::Render], 3e-3, 1e-6);
+    CHECK_NEAR(summary.phases[(u32)FrameStats::Phase::Swap], 3e-3, 1e-6);
+
+    // Swap is still open and keeps counting in the next frame
+    stats.endPhase(12 * kMs);
+    stats.beginFrame(21 * kMs);
+    CHECK_NEAR(stats.summary().phases[(u32)FrameStats::Phase::Swap], (3e-3 + 1e-3) / 2, 1e-6);
+}
+
+// Phases nested past kMaxPhaseDepth (8) are not recorded, and unwinding
+// them must leave the outer phases and the depth intact
+void phaseOverflowIsContained() {
+    FrameStats stats;
+    stats.beginFrame(1 * kMs);
+    u64 now = 1 * kMs;
+    for (u32 depth = 0; depth < 12; ++depth) {
+        stats.beginPhase(depth < 7 ? FrameStats::Phase::Events : FrameStats::Phase::Update, now);
+        now += kMs;
+    }
+    for (u32 depth = 0; depth < 12; ++depth) {
+        stats.endPhase(now);
+        now += kMs;
+    }
+    stats.endPhase(now);    // Unbalanced: ignored
+    stats.beginFrame(now);
+
+    const FrameStats::Summary summary = stats.summary();
+    // 7 ms opening Events levels plus 7 ms closing them, and the 8th
+    // level (Update) for 1 ms each way; the 4 overflow levels are dropped
+    CHECK_NEAR(summary.phases[(u32)FrameStats::Phase::Events], 14e-3, 1e-6);
+    CHECK_NEAR(summary.phases[(u32)FrameStats::Phase::Update], 2e-3, 1e-6);
+
+    // Depth is back to zero: a fresh phase is timed normally
+    stats.beginPhase(FrameStats::Phase::Render, now);
+    stats.endPhase(now + 2 * kMs);
+    stats.beginFrame(now + 5 * kMs);
+    CHECK_NEAR(stats.frameTime(0), 5e-3, 1e-6);
+    CHECK_NEAR(stats.summary().phases[(u32)FrameStats::Phase::Render], 1e-3, 1e-6);
+}
+
+void resyncDropsTheOpenFrame() {
+    FrameStats stats;
+    stats.beginFrame(1 * kMs);
+    stats.beginFrame(17 * kMs);
+    CHECK_EQ(stats.frameCount(), 1ull);
+
+    // A second of idle sleep is not a frame
+    stats.resync();
+    stats.beginFrame(1017 * kMs);
+    CHECK_EQ(stats.frameCount(), 1ull);
+    stats.beginFrame(1033 * kMs);
+    CHECK_EQ(stats.frameCount(), 2ull);
+    CHECK_NEAR(stats.frameTime(0), 16e-3, 1e-6);
+    CHECK_NEAR(stats.summary().worst, 16e-3, 1e-6);
+}
+
+} // namespace
+
+int main() {
+    return Test::runTests({
+        {"FrameStats.PercentilesUseNearestRank", percentilesUseNearestRank},
+        {"FrameStats.WindowKeepsTheNewestFrames", windowKeepsTheNewestFrames},
+        {"FrameStats.MissedVsyncRoundsToIntervals", missedVsyncRoundsToIntervals},
+        {"FrameStats.NestedPhasesAreExclusive", nestedPhasesAreExclusive},
+        {"FrameStats.PhaseOverflowIsContained", phaseOverflowIsContained},
+        {"FrameStats.ResyncDropsTheOpenFrame", resyncDropsTheOpenFrame},
+    });
+}
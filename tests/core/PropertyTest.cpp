@@ -0,0 +1,107 @@
+// ============================================
+// tests/core/PropertyTest.cpp
+// ============================================
+#include "Check.hpp"
+#include <aurora/core/Property.hpp>
+
+using namespace Aurora;
+
+namespace {
+
+void bindingsEvaluateOnRead() {
+    Property<int> width{10};
+    Property<int> height{20};
+    Computed<int> area([&] { return width * height; });
+    CHECK_EQ(area.evaluationCount(), (u64)0);
+
+    CHECK_EQ(area.get(), 200);
+    CHECK_EQ(area.evaluationCount(), (u64)1);
+
+    // Many writes, one recompute when read
+    for (int i = 1; i <= 100; ++i) {
+        width = i;
+    }
+    CHECK_EQ(area.evaluationCount(), (u64)1);
+    CHECK_EQ(area.get(), 2000);
+    CHECK_EQ(area.get(), 2000);
+    CHECK_EQ(area.evaluationCount(), (u64)2);
+}
+
+void diamondEvaluatesEachNodeOnce() {
+    Property<int> source{1};
+    Computed<int> left([&] { return source + 1; });
+    Computed<int> right([&] { return source * 2; });
+    Computed<int> sum([&] { return left + right; });
+    CHECK_EQ(sum.get(), 4);
+
+    source = 5;
+    CHECK_EQ(sum.get(), 16);
+    CHECK_EQ(left.evaluationCount(), (u64)2);
+    CHECK_EQ(right.evaluationCount(), (u64)2);
+    CHECK_EQ(sum.evaluationCount(), (u64)2);
+}
+
+void unchangedInputsSkipDownstream() {
+    Property<int> value{3};
+    Computed<bool> odd([&] { return value % 2 == 1; });
+    Computed<int> label([&] { return odd ? 1 : 0; });
+    CHECK_EQ(label.get(), 1);
+
+    // odd recomputes but stays true, so label is not re-evaluated
+    value = 5;
+    CHECK_EQ(label.get(), 1);
+    CHECK_EQ(odd.evaluationCount(), (u64)2);
+    CHECK_EQ(label.evaluationCount(), (u64)1);
+}
+
+void batchedWritesNotifyOnce() {
+    Property<int> x{0};
+    Property<int> y{0};
+    int calls = 0;
+    PropertyWatcher watcher([&] { ++calls; });
+    watcher.watch(x);
+    watcher.watch(y);
+
+    {
+        PropertyBatch batch;
+        for (int i = 1; i <= 10; ++i) {
+            x = i;
+            y = -i;
+        }
+        CHECK_EQ(calls, 0);
+    }
+    CHECK_EQ(calls, 1);
+
+    // Writing the same value is not a change
+    x = 10;
+    CHECK_EQ(calls, 1);
+}
+
+void bindNotifiesWatchers() {
+    Property<int> source{2};
+    Property<int> target{0};
+    int calls = 0;
+    PropertyWatcher watcher([&] { ++calls; });
+    watcher.watch(target);
+
+    target.bind([&] { return source * 10; });
+    CHECK_EQ(calls, 1);
+    CHECK_EQ(target.evaluationCount(), (u64)1);
+
+    source = 3;
+    CHECK_EQ(calls, 2);
+    CHECK_EQ(target.get(), 30);
+    CHECK_EQ(target.evaluationCount(), (u64)2);
+}
+
+} // namespace
+
+int main() {
+    return Test::runTests({
+        {"Property.BindingsEvaluateOnRead", bindingsEvaluateOnRead},
+        {"Property.DiamondEvaluatesEachNodeOnce", diamondEvaluatesEachNodeOnce},
+        {"Property.UnchangedInputsSkipDownstream", unchangedInputsSkipDownstream},
+        {"PropertyWatcher.BatchedWritesNotifyOnce", batchedWritesNotifyOnce},
+        {"PropertyWatcher.BindNotifiesWatchers", bindNotifiesWatchers},
+    });
+}
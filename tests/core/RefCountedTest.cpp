@@ -0,0 +1,60 @@
+// ============================================
+// tests/core/RefCountedTest.cpp
+// ============================================
+#include "Check.hpp"
+#include <aurora/core/RefCounted.hpp>
+
+using namespace Aurora;
+
+namespace {
+
+int s_live = 0;
+
+struct Base : RefCounted<Base> {
+    Base() { ++s_live; }
+    virtual ~Base() { --s_live; }
+};
+
+struct Derived : Base {};
+
+void rawPointerIsAdopted() {
+    {
+        Handle<Base> handle(new Base);
+        CHECK_EQ(handle->retainCount(), 1u);
+        Handle<Base> copy = handle;
+        CHECK_EQ(handle->retainCount(), 2u);
+    }
+    CHECK_EQ(s_live, 0);
+}
+
+void sharingARawPointerNeedsRetain() {
+    {
+        Handle<Base> owner = makeHandle<Base>();
+        Base* raw = owner.get();
+        raw->retain();
+        Handle<Base> second(raw);
+        CHECK_EQ(raw->retainCount(), 2u);
+    }
+    CHECK_EQ(s_live, 0);
+}
+
+void staticCastRetains() {
+    {
+        Handle<Base> base = makeHandle<Derived>();
+        Handle<Derived> derived = staticHandleCast<Derived>(base);
+        CHECK_EQ(derived->retainCount(), 2u);
+        base.reset();
+        CHECK_EQ(s_live, 1);
+    }
+    CHECK_EQ(s_live, 0);
+}
+
+} // namespace
+
+int main() {
+    return Test::runTests({
+        {"Handle.RawPointerIsAdopted", rawPointerIsAdopted},
+        {"Handle.SharingARawPointerNeedsRetain", sharingARawPointerNeedsRetain},
+        {"Handle.StaticCastRetains", staticCastRetains},
+    });
+}
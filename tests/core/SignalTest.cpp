@@ -0,0 +1,85 @@
+// ============================================
+// tests/core/SignalTest.cpp
+// ============================================
+#include "Check.hpp"
+#include <aurora/core/Signal.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace Aurora;
+
+namespace {
+
+void slotsMayDisconnectThemselves() {
+    Signal<int> signal;
+    int first = 0, second = 0;
+    Connection self;
+    self = signal.connect([&](int value) {
+        first += value;
+        signal.disconnect(self);
+    });
+    signal.connect([&](int value) { second += value; });
+
+    signal.emit(1);
+    signal.emit(2);
+    CHECK_EQ(first, 1);
+    CHECK_EQ(second, 3);
+    CHECK_EQ(signal.slotCount(), (size_t)1);
+}
+
+void slotsConnectedDuringEmitRunNextTime() {
+    Signal<> signal;
+    int added = 0;
+    signal.connect([&] {
+        if (signal.slotCount() == 1) {
+            signal.connect([&] { ++added; });
+        }
+    });
+
+    signal.emit();
+    CHECK_EQ(added, 0);
+    signal.emit();
+    CHECK_EQ(added, 1);
+}
+
+void otherThreadsEmitWhileOwnerEdits() {
+    // Readers on other threads must keep their snapshot alive while the
+    // owner keeps replacing and freeing lists
+    Signal<int> signal;
+    std::atomic<u64> sum{0};
+    signal.connect([&](int value) { sum.fetch_add((u64)value, std::memory_order_relaxed); });
+
+    std::atomic<bool> done{false};
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 2; ++t) {
+        readers.emplace_back([&] {
+            while (!done.load()) {
+                signal.emit(1);
+            }
+        });
+    }
+    for (int i = 0; i < 2000; ++i) {
+        Connection connection = signal.connect([](int) {});
+        signal.disconnect(connection);
+    }
+    done = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    CHECK_EQ(signal.slotCount(), (size_t)1);
+    const u64 before = sum.load();
+    signal.emit(1);
+    CHECK_EQ(sum.load(), before + 1);
+}
+
+} // namespace
+
+int main() {
+    return Test::runTests({
+        {"Signal.SlotsMayDisconnectThemselves", slotsMayDisconnectThemselves},
+        {"Signal.SlotsConnectedDuringEmitRunNextTime", slotsConnectedDuringEmitRunNextTime},
+        {"Signal.OtherThreadsEmitWhileOwnerEdits", otherThreadsEmitWhileOwnerEdits},
+    });
+}
@@ -0,0 +1,164 @@
+// ============================================
+// tests/core/TimerTest.cpp
+// ============================================
+// TimerWheel on a synthetic clock: every wheel starts at time 0 and only
+// moves when advance() is called.
+#include "Check.hpp"
+#include <aurora/core/Timer.hpp>
+#include <vector>
+
+using namespace Aurora;
+
+namespace {
+
+constexpr u64 kMs = 1000000;
+constexpr u64 kTick = 1ull << 20;
+
+// Advance through nextDeadline() until nothing is left; returns the wakeups
+u32 drain(TimerWheel& wheel, u32 limit = 1000) {
+    u32 wakeups = 0;
+    while (wheel.activeCount() > 0 && wakeups < limit) {
+        const u64 deadline = wheel.nextDeadline();
+        CHECK(deadline != TimerWheel::kNoDeadline);
+        CHECK(deadline >= wheel.now());
+        wheel.advance(deadline);
+        ++wakeups;
+    }
+    return wakeups;
+}
+
+void firesOnTheFirstTickAfterTheDeadline() {
+    TimerWheel wheel(0);
+    u64 firedAt = 0;
+    wheel.schedule(0.010, [&] { firedAt = wheel.now(); });
+
+    for (u64 time = 0; time <= 20 * kMs && !firedAt; time += kMs / 10) {
+        wheel.advance(time);
+    }
+    CHECK(firedAt >= 10 * kMs);
+    CHECK(firedAt < 10 * kMs + kTick);
+    CHECK_EQ(wheel.activeCount(), 0u);
+}
+
+// One timer per level, plus one past the wheel's ~4.9 hour range that
+// has to park and cascade again
+void cascadesAcrossEveryLevel() {
+    TimerWheel wheel(0);
+    const f64 delays[] = {0.005, 0.5, 30.0, 1200.0, 20000.0};
+    std::vector<u64> firedAt(5, 0);
+    for (u32 i = 0; i < 5; ++i) {
+        wheel.schedule(delays[i], [&, i] { firedAt[i] = wheel.now(); });
+    }
+
+    const u32 wakeups = drain(wheel);
+    for (u32 i = 0; i < 5; ++i) {
+        const u64 deadline = (u64)(delays[i] * 1e9);
+        CHECK(firedAt[i] >= deadline);
+        CHECK(firedAt[i] < deadline + kTick);
+    }
+    // Empty stretches are skipped, not walked tick by tick
+    CHECK(wakeups < 100);
+}
+
+void repeatingKeepsItsPhaseAndSkipsStalls() {
+    TimerWheel wheel(0);
+    u32 count = 0;
+    const TimerId id = wheel.scheduleRepeating(0.010, [&] { ++count; });
+
+    // Deadlines at 10, 20 ... 90 ms; 100 ms rounds up to the next tick
+    for (u64 time = kMs; time <= 100 * kMs; time += kMs) {
+        wheel.advance(time);
+    }
+    CHECK_EQ(count, 9u);
+    CHECK(wheel.isActive(id));
+
+    // A one second stall fires once, then the period restarts from now
+    CHECK_EQ(wheel.advance(1100 * kMs), 1u);
+    CHECK_EQ(count, 10u);
+    CHECK_EQ(wheel.advance(1105 * kMs), 0u);
+    CHECK_EQ(wheel.advance(1111 * kMs), 1u);
+}
+
+void cancelDuringDispatch() {
+    // Two timers on one tick, each cancelling the other: whichever the
+    // slot runs first (order within a tick is unspecified) wins
+    TimerWheel wheel(0);
+    u32 fired = 0;
+    TimerId first = 0, second = 0;
+    first = wheel.schedule(0.010, [&] { ++fired; CHECK(wheel.cancel(second)); });
+    second = wheel.schedule(0.010, [&] { ++fired; CHECK(wheel.cancel(first)); });
+
+    u32 ticks = 0;
+    TimerId self = 0;
+    self = wheel.scheduleRepeating(0.002, [&] {
+        if (++ticks == 3) {
+            CHECK(wheel.cancel(self));
+        }
+    });
+
+    drain(wheel);
+    CHECK_EQ(fired, 1u);
+    CHECK(!wheel.isActive(first) && !wheel.isActive(second));
+    CHECK(!wheel.cancel(first) && !wheel.cancel(second));
+    CHECK_EQ(ticks, 3u);
+    CHECK(!wheel.isActive(self));
+    CHECK_EQ(wheel.activeCount(), 0u);
+}
+
+// Overlapping tolerance windows land on one aligned tick
+void toleranceCoalescesWakeups() {
+    TimerWheel wheel(0);
+    std::vector<u64> firedAt;
+    for (u64 ms : {10u, 11u, 13u}) {
+        wheel.schedule(ms * 1e-3, [&] { firedAt.push_back(wheel.now()); }, 0.020);
+    }
+
+    CHECK_EQ(drain(wheel), 1u);
+    REQUIRE(firedAt.size() == 3);
+    CHECK_EQ(firedAt[0], firedAt[1]);
+    CHECK_EQ(firedAt[1], firedAt[2]);
+    CHECK(firedAt[0] >= 13 * kMs);
+    CHECK(firedAt[0] <= 30 * kMs + kTick);
+
+    // Without tolerance each keeps its own tick
+    firedAt.clear();
+    TimerWheel exact(0);
+    for (u64 ms : {10u, 11u, 13u}) {
+        exact.schedule(ms * 1e-3, [&] { firedAt.push_back(exact.now()); });
+    }
+    CHECK_EQ(drain(exact), 3u);
+}
+
+void nextDeadlineNeverOversleeps() {
+    TimerWheel wheel(0);
+    CHECK_EQ(wheel.nextDeadline(), TimerWheel::kNoDeadline);
+
+    // Level 0: exactly the firing tick
+    wheel.schedule(0.005, [] {});
+    const u64 near = wheel.nextDeadline();
+    CHECK(near >= 5 * kMs && near < 5 * kMs + kTick);
+    CHECK_EQ(wheel.advance(near), 1u);
+    CHECK_EQ(wheel.nextDeadline(), TimerWheel::kNoDeadline);
+
+    // Higher levels report their cascade boundary, never past the expiry
+    const TimerId far = wheel.schedule(60.0, [] {});
+    CHECK(wheel.nextDeadline() <= wheel.now() + 60 * 1000 * kMs);
+    CHECK_EQ(wheel.advance(wheel.nextDeadline()), 0u);
+    CHECK(wheel.isActive(far));
+
+    wheel.cancel(far);
+    CHECK_EQ(wheel.nextDeadline(), TimerWheel::kNoDeadline);
+}
+
+} // namespace
+
+int main() {
+    return Test::runTests({
+        {"TimerWheel.FiresOnTheFirstTickAfterTheDeadline", firesOnTheFirstTickAfterTheDeadline},
+        {"TimerWheel.CascadesAcrossEveryLevel", cascadesAcrossEveryLevel},
+        {"TimerWheel.RepeatingKeepsItsPhaseAndSkipsStalls", repeatingKeepsItsPhaseAndSkipsStalls},
+        {"TimerWheel.CancelDuringDispatch", cancelDuringDispatch},
+        {"TimerWheel.ToleranceCoalescesWakeups", toleranceCoalescesWakeups},
+        {"TimerWheel.NextDeadlineNeverOversleeps", nextDeadlineNeverOversleeps},
+    });
+}
@@ -0,0 +1,133 @@
+// ============================================
+// tests/graphics/RenderTargetTest.cpp
+// ============================================
+// Per-context GL objects across shared headless contexts. Exits 77
+// (skipped) when the headless platform has no EGL.
+#include "Check.hpp"
+#include <aurora/graphics/GLContext.hpp>
+#include <aurora/graphics/Mesh.hpp>
+#include <aurora/graphics/RenderTarget.hpp>
+#include <aurora/platform/headless/HeadlessPlatform.hpp>
+#include <cstdio>
+
+using namespace Aurora;
+
+namespace {
+
+// Two shared contexts, each current on its own window
+struct Contexts {
+    HeadlessPlatform platform{config()};
+    Handle<Aurora::Window> windows[2];
+    void* contexts[2] = {};
+
+    static HeadlessPlatform::Config config() {
+        HeadlessPlatform::Config config;
+        config.shareContexts = true;
+        return config;
+    }
+
+    bool open() {
+        if (!platform.initialize() || !platform.hasGL()) {
+            return false;
+        }
+        Aurora::Window::Config windowConfig;
+        windowConfig.width = 64;
+        windowConfig.height = 64;
+        for (u32 i = 0; i < 2; ++i) {
+            windows[i] = platform.createWindow(windowConfig);
+            contexts[i] = platform.createGLContext(windows[i].get());
+            if (!contexts[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void use(u32 i) { platform.makeCurrent(windows[i].get(), contexts[i]); }
+
+    ~Contexts() {
+        for (void* context : contexts) {
+            if (context) {
+                platform.destroyGLContext(context);
+            }
+        }
+        platform.shutdown();
+    }
+};
+
+// Vertex array names are per context and handed out from 1
+u32 liveVertexArrays() {
+    u32 count = 0;
+    for (GLuint name = 1; name <= 64; ++name) {
+        count += glIsVertexArray(name) == GL_TRUE;
+    }
+    return count;
+}
+
+void eachContextGetsACompleteFramebuffer() {
+    Contexts gl;
+    REQUIRE(gl.open());
+
+    gl.use(0);
+    RenderTarget target(32, 32);
+    const GLuint first = target.framebufferId();
+    CHECK(target.isComplete());
+
+    gl.use(1);
+    const GLuint second = target.framebufferId();
+    CHECK(target.isComplete());
+    CHECK(glIsFramebuffer(second));
+    CHECK(first != 0);
+
+    // Resizing in one context reattaches the other's framebuffer on use
+    gl.use(0);
+    target.resize(48, 48);
+    CHECK(target.isComplete());
+    gl.use(1);
+    CHECK_EQ(target.framebufferId(), second);
+    CHECK(target.isComplete());
+}
+
+void otherContextsDeleteTheirObjectsWhenCurrent() {
+    Contexts gl;
+    REQUIRE(gl.open());
+
+    gl.use(0);
+    auto* target = new RenderTarget(32, 32);
+    auto* mesh = new Mesh();
+    const GLuint framebuffer0 = target->framebufferId();
+    mesh->draw();
+
+    gl.use(1);
+    const GLuint framebuffer1 = target->framebufferId();
+    mesh->draw();
+    CHECK(glIsFramebuffer(framebuffer1));
+    CHECK_EQ(liveVertexArrays(), 1u);
+
+    // Destroyed while context 0 is current: its names go at once, context
+    // 1's wait for it
+    gl.use(0);
+    delete target;
+    delete mesh;
+    CHECK(!glIsFramebuffer(framebuffer0));
+
+    gl.use(1);
+    CHECK(!glIsFramebuffer(framebuffer1));
+    CHECK_EQ(liveVertexArrays(), 0u);
+}
+
+} // namespace
+
+int main() {
+    {
+        Contexts probe;
+        if (!probe.open()) {
+            std::fprintf(stderr, "Headless GL is unavailable, skipping\n");
+            return 77;
+        }
+    }
+    return Test::runTests({
+        {"RenderTarget.EachContextGetsACompleteFramebuffer", eachContextGetsACompleteFramebuffer},
+        {"RenderTarget.OtherContextsDeleteTheirObjectsWhenCurrent", otherContextsDeleteTheirObjectsWhenCurrent},
+    });
+}
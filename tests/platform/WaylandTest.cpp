@@ -0,0 +1,95 @@
+// ============================================
+// tests/platform/WaylandTest.cpp
+// ============================================
+// Runs under a headless weston (see run_weston.sh). Only built with
+// AURORA_USE_WAYLAND, i.e. where the wayland headers and scanner exist.
+#include "Check.hpp"
+#include <aurora/platform/IPlatform.hpp>
+#include <aurora/platform/wayland/WaylandEvent.hpp>
+#include <linux/input-event-codes.h>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace Aurora;
+
+namespace {
+
+Unique<IPlatform> createPlatform() {
+    Unique<IPlatform> platform = IPlatform::create();
+    if (platform && !platform->initialize()) {
+        platform.reset();
+    }
+    return platform;
+}
+
+// Pump until the compositor lets the window present again, i.e. it has
+// configured the surface and answered the last frame callback
+bool waitForPresent(IPlatform& platform, Window* window) {
+    for (int i = 0; i < 200; ++i) {
+        platform.pumpEvents();
+        while (platform.hasEvents()) {
+            platform.nextEvent();
+        }
+        if (platform.canPresent(window)) {
+            return true;
+        }
+        platform.waitEvents(0.01);
+    }
+    return false;
+}
+
+void connectsToTheCompositor() {
+    Unique<IPlatform> platform = createPlatform();
+    REQUIRE(platform);
+    CHECK_EQ(platform->name(), std::string("Wayland"));
+    CHECK(platform->displayCount() >= 1);
+    CHECK(platform->displayRefreshRate(0) > 0.0);
+}
+
+// Each present goes out through the wl_shm pool; the compositor must
+// release a buffer and send the frame callback before the next one
+void presentPixelsCompletesFrames() {
+    Unique<IPlatform> platform = createPlatform();
+    REQUIRE(platform);
+
+    Window::Config config;
+    config.width = 64;
+    config.height = 48;
+    Handle<Window> window = platform->createWindow(config);
+    REQUIRE(window);
+    window->show();
+    REQUIRE(waitForPresent(*platform, window.get()));
+
+    std::vector<u32> pixels(config.width * config.height);
+    const u32 colors[] = {0xFFFF0000, 0xFF00FF00, 0xFF0000FF, 0xFFFFFFFF};
+    for (u32 color : colors) {
+        std::fill(pixels.begin(), pixels.end(), color);
+        CHECK(platform->presentPixels(window.get(), pixels.data(), config.width, config.height,
+                                      config.width));
+        CHECK(waitForPresent(*platform, window.get()));
+    }
+    platform->destroyWindow(window.get());
+}
+
+// Evdev codes are named by US key position (see WaylandEvent.hpp)
+void evdevTranslates() {
+    CHECK(evdevToKeyCode(KEY_A) == KeyCode::A);
+    CHECK(evdevToKeyCode(KEY_Q) == KeyCode::Q);
+    CHECK(evdevToKeyCode(KEY_1) == KeyCode::Num1);
+    CHECK(evdevToKeyCode(KEY_F12) == KeyCode::F12);
+    CHECK(evdevToKeyCode(KEY_LEFTMETA) == KeyCode::LeftSuper);
+    CHECK(evdevToMouseButton(BTN_LEFT) == MouseButton::Left);
+    CHECK(evdevToMouseButton(BTN_EXTRA) == MouseButton::X2);
+    CHECK_EQ(waylandModifiers(1u << 0 | 1u << 2), (u32)KeyModifiers::Shift | (u32)KeyModifiers::Ctrl);
+}
+
+} // namespace
+
+int main() {
+    return Test::runTests({
+        {"Wayland.ConnectsToTheCompositor", connectsToTheCompositor},
+        {"Wayland.PresentPixelsCompletesFrames", presentPixelsCompletesFrames},
+        {"Wayland.EvdevTranslates", evdevTranslates},
+    });
+}
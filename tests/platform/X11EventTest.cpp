@@ -0,0 +1,67 @@
+// ============================================
+// tests/platform/X11EventTest.cpp
+// ============================================
+// The parts of X11 input translation that need no server: keysym names,
+// modifier bits and server timestamps.
+#include "Check.hpp"
+#include <aurora/core/Timer.hpp>
+#include <aurora/platform/x11/X11Event.hpp>
+#include <X11/keysym.h>
+
+using namespace Aurora;
+
+namespace {
+
+void lettersIgnoreCase() {
+    CHECK(keysymToKeyCode(XK_a) == Aurora::KeyCode::A);
+    CHECK(keysymToKeyCode(XK_A) == Aurora::KeyCode::A);
+    CHECK(keysymToKeyCode(XK_z) == Aurora::KeyCode::Z);
+    CHECK(keysymToKeyCode(XK_7) == Aurora::KeyCode::Num7);
+    CHECK(keysymToKeyCode(XK_F12) == Aurora::KeyCode::F12);
+}
+
+void keypadAndLevelKeysShareNames() {
+    CHECK(keysymToKeyCode(XK_KP_Enter) == Aurora::KeyCode::Enter);
+    CHECK(keysymToKeyCode(XK_KP_Left) == Aurora::KeyCode::Left);
+    CHECK(keysymToKeyCode(XK_ISO_Left_Tab) == Aurora::KeyCode::Tab);
+    CHECK(keysymToKeyCode(XK_ISO_Level3_Shift) == Aurora::KeyCode::RightAlt);
+    CHECK(keysymToKeyCode(XK_eacute) == Aurora::KeyCode::Unknown);
+}
+
+void modifierMasksTranslate() {
+    CHECK_EQ(x11Modifiers(0), 0u);
+    CHECK_EQ(x11Modifiers(ShiftMask | Mod4Mask), (u32)KeyModifiers::Shift | (u32)KeyModifiers::Super);
+    CHECK_EQ(x11Modifiers(ControlMask | Mod1Mask), (u32)KeyModifiers::Ctrl | (u32)KeyModifiers::Alt);
+    // Caps and Num Lock are not modifiers for shortcuts
+    CHECK_EQ(x11Modifiers(LockMask | Mod2Mask), 0u);
+}
+
+// A local server stamps events with the steady clock in milliseconds
+void localStampsMapOntoTheSteadyClock() {
+    X11Clock clock;
+    const u64 now = TimerWheel::clock() / 1000000;
+    CHECK_NEAR(clock.toSeconds((Time)(u32)now), now * 1e-3, 0.05);
+    CHECK_NEAR(clock.toSeconds((Time)(u32)(now - 250)), (now - 250) * 1e-3, 0.05);
+}
+
+// Any other server is placed by the smallest delay seen so far
+void foreignStampsKeepTheirSpacing() {
+    X11Clock clock;
+    const f64 now = TimerWheel::clock() * 1e-9;
+    CHECK_NEAR(clock.toSeconds(12345), now, 0.05);
+    const f64 later = clock.toSeconds(13345);
+    CHECK_NEAR(later, TimerWheel::clock() * 1e-9, 0.05);
+    CHECK_NEAR(later - clock.toSeconds(12345), 1.0, 1e-6);
+}
+
+} // namespace
+
+int main() {
+    return Test::runTests({
+        {"X11Event.LettersIgnoreCase", lettersIgnoreCase},
+        {"X11Event.KeypadAndLevelKeysShareNames", keypadAndLevelKeysShareNames},
+        {"X11Event.ModifierMasksTranslate", modifierMasksTranslate},
+        {"X11Event.LocalStampsMapOntoTheSteadyClock", localStampsMapOntoTheSteadyClock},
+        {"X11Event.ForeignStampsKeepTheirSpacing", foreignStampsKeepTheirSpacing},
+    });
+}
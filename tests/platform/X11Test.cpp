@@ -0,0 +1,179 @@
+// ============================================
+// tests/platform/X11Test.cpp
+// ============================================
+// Runs under Xvfb (see run_xvfb.sh); talks to the server directly through
+// a second connection to check what the platform put there.
+#include "Check.hpp"
+#include <aurora/platform/IPlatform.hpp>
+#include <X11/Xlib.h>
+#include <X11/Xutil.h>
+#include <X11/keysym.h>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+using namespace Aurora;
+
+namespace {
+
+Unique<IPlatform> createPlatform() {
+    Unique<IPlatform> platform = IPlatform::create();
+    if (platform && !platform->initialize()) {
+        platform.reset();
+    }
+    return platform;
+}
+
+// Let the server finish requests queued by the platform's connection
+void settle(IPlatform& platform) {
+    for (int i = 0; i < 10; ++i) {
+        platform.pumpEvents();
+        while (platform.hasEvents()) {
+            platform.nextEvent();
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+}
+
+void presentPixelsReachesTheWindow() {
+    Unique<IPlatform> platform = createPlatform();
+    REQUIRE(platform);
+
+    Aurora::Window::Config config;
+    config.width = 64;
+    config.height = 48;
+    Handle<Aurora::Window> window = platform->createWindow(config);
+    REQUIRE(window);
+    window->show();
+    settle(*platform);
+
+    // Both buffers of the chain, then the first one again once the server
+    // has released it
+    const u32 colors[] = {0xFFFF0000, 0xFF00FF00, 0xFF0000FF};
+    std::vector<u32> pixels(config.width * config.height);
+    for (u32 color : colors) {
+        std::fill(pixels.begin(), pixels.end(), color);
+        CHECK(platform->presentPixels(window.get(), pixels.data(), config.width, config.height,
+                                      config.width));
+    }
+    settle(*platform);
+
+    Display* display = XOpenDisplay(nullptr);
+    REQUIRE(display);
+    XImage* image = XGetImage(display, reinterpret_cast<::Window>(window->nativeHandle()),
+                              0, 0, config.width, config.height, AllPlanes, ZPixmap);
+    CHECK(image);
+    if (image) {
+        CHECK_EQ(XGetPixel(image, 0, 0) & 0xFFFFFF, 0x0000FFul);
+        CHECK_EQ(XGetPixel(image, config.width - 1, config.height - 1) & 0xFFFFFF, 0x0000FFul);
+        XDestroyImage(image);
+    }
+    XCloseDisplay(display);
+}
+
+// Core events sent with XSendEvent arrive through the same pumpEvents()
+// path as device input (XInput2 builds still read core key events)
+void coreInputTranslates() {
+    Unique<IPlatform> platform = createPlatform();
+    REQUIRE(platform);
+
+    Aurora::Window::Config config;
+    Handle<Aurora::Window> window = platform->createWindow(config);
+    REQUIRE(window);
+    window->show();
+    settle(*platform);
+
+    Display* display = XOpenDisplay(nullptr);
+    REQUIRE(display);
+    const ::Window xwindow = reinterpret_cast<::Window>(window->nativeHandle());
+    auto send = [&](int type, unsigned int detail) {
+        XEvent xevent = {};
+        xevent.type = type;
+        if (type == KeyPress || type == KeyRelease) {
+            xevent.xkey.window = xwindow;
+            xevent.xkey.keycode = detail;
+            xevent.xkey.same_screen = True;
+            XSendEvent(display, xwindow, False, type == KeyPress ? KeyPressMask : KeyReleaseMask, &xevent);
+        } else {
+            xevent.xbutton.window = xwindow;
+            xevent.xbutton.button = detail;
+            xevent.xbutton.same_screen = True;
+            XSendEvent(display, xwindow, False,
+                       type == ButtonPress ? ButtonPressMask : ButtonReleaseMask, &xevent);
+        }
+    };
+    const unsigned int keyA = XKeysymToKeycode(display, XK_a);
+    send(KeyPress, keyA);
+    send(KeyPress, keyA);
+    send(KeyRelease, keyA);
+    send(ButtonPress, 4);
+    send(ButtonRelease, 1);
+    XSync(display, False);
+    XCloseDisplay(display);
+
+    std::vector<Event> events;
+    for (int i = 0; i < 10 && events.size() < 5; ++i) {
+        platform->pumpEvents();
+        while (platform->hasEvents()) {
+            Event event = platform->nextEvent();
+            if (event.type == EventType::KeyDown || event.type == EventType::KeyUp ||
+                event.type == EventType::MouseScroll || event.type == EventType::MouseUp) {
+                events.push_back(event);
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    REQUIRE(events.size() == 5);
+    CHECK(events[0].type == EventType::KeyDown && events[0].key.code == Aurora::KeyCode::A);
+    CHECK(!events[0].key.repeat);
+    CHECK(events[1].type == EventType::KeyDown && events[1].key.repeat);
+    CHECK(events[2].type == EventType::KeyUp && events[2].key.code == Aurora::KeyCode::A);
+    CHECK(events[3].type == EventType::MouseScroll);
+    CHECK_EQ(events[3].scroll.dy, 1.0f);
+    CHECK(events[4].type == EventType::MouseUp && events[4].mouseButton.button == MouseButton::Left);
+}
+
+// createWindow() takes its atoms from the cache filled in initialize()
+// and leaves its requests for the next flush, so a panel set costs no
+// round trips. The timings are printed for the record; no run has been
+// recorded yet (docs/KnownIssues.md, AUR-5)
+void twentyWindowsNeedNoRoundTrips() {
+    using Clock = std::chrono::steady_clock;
+    const Clock::time_point start = Clock::now();
+    Unique<IPlatform> platform = createPlatform();
+    REQUIRE(platform);
+    const Clock::time_point initialized = Clock::now();
+    const u64 startup = platform->roundTrips();
+
+    std::vector<Handle<Aurora::Window>> windows;
+    for (int i = 0; i < 20; ++i) {
+        Aurora::Window::Config config;
+        config.width = 200;
+        config.height = 40;
+        config.type = i % 2 ? Aurora::Window::Type::Panel : Aurora::Window::Type::Dock;
+        windows.push_back(platform->createWindow(config));
+        windows.back()->show();
+    }
+    platform->pumpEvents();
+    const Clock::time_point created = Clock::now();
+    const u64 windowTrips = platform->roundTrips() - startup;
+
+    auto ms = [](Clock::duration d) { return std::chrono::duration<double, std::milli>(d).count(); };
+    std::fprintf(stderr, "[X11] initialize: %.2f ms, %llu round trips; 20 windows: %.2f ms, %llu round trips\n",
+                 ms(initialized - start), (unsigned long long)startup,
+                 ms(created - initialized), (unsigned long long)windowTrips);
+    CHECK(startup > 0);
+    CHECK_EQ(windowTrips, 0ull);
+}
+
+} // namespace
+
+int main() {
+    return Test::runTests({
+        {"X11.PresentPixelsReachesTheWindow", presentPixelsReachesTheWindow},
+        {"X11.CoreInputTranslates", coreInputTranslates},
+        {"X11.TwentyWindowsNeedNoRoundTrips", twentyWindowsNeedNoRoundTrips},
+    });
+}
@@ -0,0 +1,38 @@
+#!/bin/sh
+# Runs a test binary against a private headless weston with
+# AURORA_PLATFORM=wayland. Exits 77, which ctest reports as skipped, when
+# weston is not installed.
+command -v weston >/dev/null 2>&1 || { echo "weston not found; skipping"; exit 77; }
+
+dir=$(mktemp -d)
+chmod 700 "$dir"
+socket=aurora-test-$$
+# Weston 10 and later name the backend "headless"; older releases want
+# the module file name
+for backend in headless headless-backend.so; do
+    XDG_RUNTIME_DIR="$dir" weston --backend=$backend --socket=$socket --idle-time=0 \
+        --width=1280 --height=800 >"$dir/log" 2>&1 &
+    server=$!
+
+    tries=0
+    while [ ! -S "$dir/$socket" ] && kill -0 $server 2>/dev/null && [ $tries -le 100 ]; do
+        tries=$((tries + 1))
+        sleep 0.1
+    done
+    [ -S "$dir/$socket" ] && break
+    kill $server 2>/dev/null; wait $server 2>/dev/null
+    server=
+done
+
+if [ -z "$server" ]; then
+    echo "weston did not start:"; cat "$dir/log"
+    rm -rf "$dir"
+    exit 1
+fi
+
+XDG_RUNTIME_DIR="$dir" WAYLAND_DISPLAY=$socket AURORA_PLATFORM=wayland "$@"
+status=$?
+
+kill $server; wait $server 2>/dev/null
+rm -rf "$dir"
+exit $status
@@ -0,0 +1,27 @@
+#!/bin/sh
+# Runs a test binary against a private Xvfb with AURORA_PLATFORM=x11.
+# Exits 77, which ctest reports as skipped, when Xvfb is not installed.
+command -v Xvfb >/dev/null 2>&1 || { echo "Xvfb not found; skipping"; exit 77; }
+
+dir=$(mktemp -d)
+# -displayfd picks a free display and writes its number once it is ready
+Xvfb -displayfd 3 -screen 0 1280x800x24 -nolisten tcp 3>"$dir/display" 2>"$dir/log" &
+server=$!
+
+tries=0
+while [ ! -s "$dir/display" ]; do
+    tries=$((tries + 1))
+    if [ $tries -gt 100 ] || ! kill -0 $server 2>/dev/null; then
+        echo "Xvfb did not start:"; cat "$dir/log"
+        kill $server 2>/dev/null; rm -rf "$dir"
+        exit 1
+    fi
+    sleep 0.1
+done
+
+DISPLAY=:$(cat "$dir/display") AURORA_PLATFORM=x11 "$@"
+status=$?
+
+kill $server; wait $server 2>/dev/null
+rm -rf "$dir"
+exit $status